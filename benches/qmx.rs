@@ -0,0 +1,188 @@
+//! Encode and decode throughput over synthetic (and, optionally, real) postings lists.
+//!
+//! `cargo bench` runs every distribution at every list length. To add real postings set `QMX_POSTINGS` to a file of
+//! lists each stored as a little-endian `u32` count followed by that many `u32` docids (the PISA / ds2i `.docs` layout,
+//! whose first list, the number of documents, is skipped). The bytes per integer of each list are printed as it's set up.
+use criterion::{black_box, criterion_group, criterion_main, BenchmarkId, Criterion, Throughput};
+use qmx_compression::{decode, decode_raw, encode, encode_raw, QmxEncoder};
+
+extern "C" {
+    fn cumulative_sum_256(data: *mut u32, length: usize);
+}
+
+//list lengths: shorter than a word, a typical short list, a typical block-sized list, and a long list
+const LENGTHS: [usize; 4] = [12, 128, 4096, 1 << 20];
+
+//xorshift64*, so that the lists are the same every run
+struct Random(u64);
+
+impl Random {
+    fn next(&mut self) -> u64 {
+        self.0 ^= self.0 >> 12;
+        self.0 ^= self.0 << 25;
+        self.0 ^= self.0 >> 27;
+        return self.0.wrapping_mul(0x2545_F491_4F6C_DD1D);
+    }
+
+    //uniform in [0, 1)
+    fn unit(&mut self) -> f64 {
+        return (self.next() >> 11) as f64 / (1u64 << 53) as f64;
+    }
+}
+
+//d-gaps with a Zipfian (power law) tail, so most are small and a few are very large
+fn zipfian(count: usize, exponent: f64, random: &mut Random) -> Vec<u32> {
+    let mut docid: u32 = 0;
+    return (0..count)
+        .map(|_| {
+            let gap = (1.0 - random.unit()).powf(-1.0 / (exponent - 1.0)).min((1u32 << 20) as f64) as u32;
+            docid = docid.wrapping_add(gap.max(1));
+            return docid;
+        })
+        .collect();
+}
+
+//put count docids in [from, to) by splitting the range at random and the docids at random between the halves, which clusters them
+fn cluster(output: &mut Vec<u32>, count: usize, from: u32, to: u32, random: &mut Random) {
+    let range = (to - from) as usize;
+    if count == 0 {
+        return;
+    }
+    if count == range {
+        output.extend(from..to);
+        return;
+    }
+    if count < 8 || range < 2 * count {
+        //few enough (or dense enough) to just pick
+        let mut picked: Vec<u32> = Vec::with_capacity(count);
+        while picked.len() < count {
+            let docid = from + (random.next() % range as u64) as u32;
+            if let Err(at) = picked.binary_search(&docid) {
+                picked.insert(at, docid);
+            }
+        }
+        output.extend_from_slice(&picked);
+        return;
+    }
+
+    let middle = from + (random.next() % range as u64) as u32;
+    let left = (count as u64 * (middle - from) as u64 / range as u64) as usize;
+    let left = left.min((middle - from) as usize).max(count.saturating_sub((to - middle) as usize));
+    cluster(output, left, from, middle, random);
+    cluster(output, count - left, middle, to, random);
+}
+
+fn clustered(count: usize, universe: u32, random: &mut Random) -> Vec<u32> {
+    let mut output = Vec::with_capacity(count);
+    cluster(&mut output, count, 0, universe.max(2 * count as u32), random);
+    return output;
+}
+
+//the postings lists in a PISA / ds2i .docs file, if there is one
+fn load_postings() -> Vec<(String, Vec<u32>)> {
+    let path = match std::env::var("QMX_POSTINGS") {
+        Ok(path) => path,
+        Err(_) => return vec![],
+    };
+    let data = std::fs::read(&path).expect("can't read QMX_POSTINGS");
+    let words: Vec<u32> = data.chunks_exact(4).map(|word| u32::from_le_bytes([word[0], word[1], word[2], word[3]])).collect();
+
+    //keep the longest list under each of LENGTHS
+    let mut best: Vec<Option<&[u32]>> = vec![None; LENGTHS.len()];
+    let mut at = 2;
+    while at < words.len() {
+        let length = words[at] as usize;
+        let list = &words[(at + 1).min(words.len())..(at + 1 + length).min(words.len())];
+        for (which, &limit) in LENGTHS.iter().enumerate() {
+            if list.len() <= limit && best[which].map_or(true, |found| list.len() > found.len()) {
+                best[which] = Some(list);
+            }
+        }
+        at += 1 + length;
+    }
+
+    return best.into_iter().flatten().map(|list| (format!("real/{}", list.len()), list.to_vec())).collect();
+}
+
+fn lists() -> Vec<(String, Vec<u32>)> {
+    let mut random = Random(0x9E37_79B9_7F4A_7C15);
+    let mut lists = vec![];
+    for &length in &LENGTHS {
+        lists.push((format!("zipf/{}", length), zipfian(length, 1.8, &mut random)));
+        lists.push((format!("clustered/{}", length), clustered(length, 64 * length as u32, &mut random)));
+    }
+    lists.extend(load_postings());
+
+    for (name, list) in &lists {
+        eprintln!("{}: {:.3} bytes/integer", name, encode(list).len() as f64 / list.len() as f64);
+    }
+    return lists;
+}
+
+fn d_gaps(docs: &[u32]) -> Vec<u32> {
+    let mut previous = 0;
+    return docs
+        .iter()
+        .map(|&docid| {
+            let gap = docid.wrapping_sub(previous);
+            previous = docid;
+            return gap;
+        })
+        .collect();
+}
+
+fn benchmarks(c: &mut Criterion) {
+    let lists = lists();
+
+    let mut group = c.benchmark_group("encode");
+    let mut encoder = QmxEncoder::new();
+    for (name, list) in &lists {
+        let mut output = Vec::with_capacity(qmx_compression::max_encoded_len(list.len()));
+        group.throughput(Throughput::Elements(list.len() as u64));
+        group.bench_with_input(BenchmarkId::from_parameter(name), list, |b, list| {
+            b.iter(|| {
+                output.clear();
+                encoder.encode_into(black_box(list), &mut output)
+            })
+        });
+    }
+    group.finish();
+
+    //decode() is the fused decode and prefix sum
+    let mut group = c.benchmark_group("decode");
+    for (name, list) in &lists {
+        let encoded = encode(list);
+        let mut output = vec![0u32; list.len() + 256];
+        group.throughput(Throughput::Elements(list.len() as u64));
+        group.bench_with_input(BenchmarkId::from_parameter(name), &encoded, |b, encoded| b.iter(|| decode(black_box(encoded), &mut output, list.len() as u32)));
+    }
+    group.finish();
+
+    //qmx_decode on its own (just the d-gaps, no prefix sum)
+    let mut group = c.benchmark_group("qmx_decode");
+    for (name, list) in &lists {
+        let encoded = encode_raw(&d_gaps(list));
+        let mut output = vec![0u32; list.len() + 256];
+        group.throughput(Throughput::Elements(list.len() as u64));
+        group.bench_with_input(BenchmarkId::from_parameter(name), &encoded, |b, encoded| b.iter(|| decode_raw(black_box(encoded), &mut output, list.len() as u32)));
+    }
+    group.finish();
+
+    //the separate prefix sum decode() used to do after qmx_decode
+    let mut group = c.benchmark_group("cumulative_sum_256");
+    for (name, list) in &lists {
+        let gaps = d_gaps(list);
+        let mut data = vec![0u32; list.len() + 8];
+        group.throughput(Throughput::Elements(list.len() as u64));
+        group.bench_with_input(BenchmarkId::from_parameter(name), &gaps, |b, gaps| {
+            b.iter(|| {
+                data[..gaps.len()].copy_from_slice(gaps);
+                unsafe { cumulative_sum_256(black_box(data.as_mut_ptr()), gaps.len()) };
+            })
+        });
+    }
+    group.finish();
+}
+
+criterion_group!(benches, benchmarks);
+criterion_main!(benches);
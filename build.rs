@@ -1,21 +1,54 @@
+use std::env;
+use std::fs;
+use std::path::PathBuf;
+use std::process::Command;
 
 fn main() {
 
     println!("cargo:rerun-if-changed=src");
-    
-    cc::Build::new()
+
+    //the kernels are SSE4.1, AVX2 and AVX-512 intrinsics with no portable fallback, say so rather than fail deep in the C++ build
+    let arch = env::var("CARGO_CFG_TARGET_ARCH").unwrap();
+    assert!(arch == "x86_64" || arch == "x86", "qmx_compression only builds for x86 and x86-64 (SSE4.1 or later), not {}", arch);
+
+    let out = PathBuf::from(env::var("OUT_DIR").unwrap());
+    let host = env::var("HOST").unwrap();
+
+    //the decoders are written by the generator in compress_integer_qmx_improved.cpp, build it for the machine doing the build and run it
+    let generator = out.join("make_decompress");
+    let compiler = cc::Build::new().cpp(true).host(&host).target(&host).opt_level(1).cargo_metadata(false).get_compiler();
+    let status = compiler.to_command()
+        .arg("-DMAKE_DECOMPRESS")
+        .arg("-msse4.1")
+        .arg("-w")
+        .arg("src/compress_integer_qmx_improved.cpp")
+        .arg("-o")
+        .arg(&generator)
+        .status()
+        .expect("can't run the C++ compiler to build the decoder generator");
+    assert!(status.success(), "the decoder generator didn't compile");
+
+    let generated = Command::new(&generator).arg("compact").output().expect("can't run the decoder generator");
+    assert!(generated.status.success(), "the decoder generator failed");
+    fs::write(out.join("compress_integer_qmx_improved_decoders.inc"), generated.stdout).unwrap();
+
+    let mut build = cc::Build::new();
+    build
         .file("src/jass.cpp")
-        .file("src/compress_integer_qmx_improved.h")
         .file("src/compress_integer_qmx_improved.cpp")
+        .include(&out)
         .cpp(true)
         .flag("-fPIC")
         .flag("-D_GLIBCXX_USE_CXX11_ABI=1")
         .flag("-Wno-implicit-fallthrough")
         .flag("-Wno-unused-parameter")
         // .flag("-g")
-        .flag("-march=native")
-        .flag("-mbmi")
-        .flag("-mavx2")
-        .compile("libjass.a");
+        //SSE4.1 is the least the kernels need, the AVX2 and AVX-512 ones are compiled with target attributes and chosen at runtime
+        .flag("-msse4.1");
+    //the trace feature counts what the decoders do (see trace_counters() in lib.rs), without it the counting isn't compiled in
+    if env::var_os("CARGO_FEATURE_TRACE").is_some() {
+        build.define("QMX_TRACE", None);
+    }
+    build.compile("libjass.a");
 
-}
\ No newline at end of file
+}
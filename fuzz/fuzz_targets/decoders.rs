@@ -0,0 +1,6 @@
+#![no_main]
+
+//any bytes at all, which the checked decoders must survive and every instruction set must decode the same way
+use libfuzzer_sys::fuzz_target;
+
+fuzz_target!(|data: &[u8]| qmx_compression::verify_decoders(data).unwrap());
@@ -0,0 +1,6 @@
+#![no_main]
+
+//any list of integers, which every encoder and decoder must give back unchanged
+use libfuzzer_sys::fuzz_target;
+
+fuzz_target!(|values: Vec<u32>| qmx_compression::verify_round_trip(&values).unwrap());
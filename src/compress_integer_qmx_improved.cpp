@@ -31,18 +31,22 @@
 
 	This way, all reads and writes are 128-bit word aligned, except addressing the selectors, which are byte aligned.
 
-	Note:  There is currently 1 unused encoding (i.e. 16 unused selecvtor values).  These might in the future be
-	used for encoding exceptions, much as PForDelta does.
+	Note:  The 16th encoding (selector values 0xF0-0xFF) is used for exceptions, much as PForDelta does, in the
+	Patched format version only.  See write_run() for the patch format.
 */
 #include <array>
+#include <algorithm>
+#include <atomic>
 #include <vector>
 #include <iostream>
+#include <random>
 
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <emmintrin.h>
 #include <smmintrin.h>
+#include <immintrin.h>
 
 // #include "asserts.h"
 #include "compress_integer_qmx_improved.h"
@@ -110,6 +114,23 @@ namespace JASS
 			return 32;
 		}
 
+	/*
+		BITS_FOR_LENGTH[]
+		-----------------
+	*/
+	/*!
+		@brief The number of QMX bits needed to store an integer (other than 1) indexed by its length in bits (i.e. 32 - lzcnt(value))
+	*/
+	static const uint8_t bits_for_length[] =
+		{
+		1, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 12, 12, 16, 16, 16, 16, 21, 21, 21, 21, 21, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32
+		};
+
+	/*!
+		@brief The number of 0-length integers shoved on the end of length_buffer to allow for overflow
+	*/
+	static const uint32_t WASTAGE = 512;
+
 	/*
 		STRUCT TYPE_AND_INTEGERS
 		------------------------
@@ -167,18 +188,122 @@ namespace JASS
 		{14, 4},	// size_in_bits == 32;
 		};
 
+	/*
+		BYTES_IN_WORD()
+		---------------
+	*/
+	/*!
+		@brief Return the number of payload bytes used by one word of the given size
+		@param size_in_bits [in] the size, in bits, of each integer in the word (an index into table[])
+		@return 0 for 0-bit integers, 32 for those packed into two 128-bit words, otherwise 16
+	*/
+	static uint32_t bytes_in_word(uint32_t size_in_bits)
+		{
+		switch (size_in_bits)
+			{
+			case 0:
+				return 0;
+			case 7:
+			case 9:
+			case 12:
+			case 21:
+				return 32;
+			default:
+				return 16;
+			}
+		}
+
+	/*
+		COMPRESS_INTEGER_QMX_IMPROVED::MAX_ENCODED_LENGTH()
+		---------------------------------------------------
+	*/
+	size_t compress_integer_qmx_improved::max_encoded_length(size_t source_integers)
+		{
+		uint32_t worst_bytes = 0, worst_integers = 1, largest_word = 0, fewest_integers = 256;
+
+		if (source_integers == 0)
+			return 0;
+
+		for (uint32_t size_in_bits = 0; size_in_bits <= 32; size_in_bits++)
+			{
+			if (table[size_in_bits].integers == 0)
+				continue;
+			uint32_t bytes = bytes_in_word(size_in_bits);
+			if (bytes * worst_integers > worst_bytes * table[size_in_bits].integers)
+				{
+				worst_bytes = bytes;
+				worst_integers = table[size_in_bits].integers;
+				}
+			largest_word = bytes > largest_word ? bytes : largest_word;
+			fewest_integers = table[size_in_bits].integers < fewest_integers ? table[size_in_bits].integers : fewest_integers;
+			}
+
+		size_t payload = (source_integers * worst_bytes + worst_integers - 1) / worst_integers + largest_word;
+		size_t keys = (source_integers + fewest_integers - 1) / fewest_integers + 1;
+
+		return payload + keys;
+		}
+
+	/*
+		PACK_SETS()
+		-----------
+	*/
+	/*!
+		@brief Pack 4-integer sets into the lanes of one 128-bit word, the way the decoders unpack them (integer i goes in lane i % 4)
+		@details Set s is shifted left by first_shift + s * bits and ORed in, bits lost off the top of a lane are the caller's problem.
+		Inlined with constant arguments the loop unrolls into one load, immediate shift, and OR per set.
+		@param source [in] the integers, 4 * sets of them
+		@param bits [in] the size (in bits) of each integer
+		@param sets [in] the number of 4-integer sets to pack
+		@param first_shift [in] where in each lane the first set goes
+		@return the packed word
+	*/
+	static inline __attribute__((always_inline)) __m128i pack_sets(const uint32_t *source, uint32_t bits, uint32_t sets, uint32_t first_shift)
+		{
+		__m128i word = _mm_setzero_si128();
+
+		for (uint32_t set = 0; set < sets; set++)
+			word = _mm_or_si128(word, _mm_slli_epi32(_mm_loadu_si128((const __m128i *)source + set), first_shift + set * bits));
+
+		return word;
+		}
+
+	/*
+		PACK_TWO_WORDS()
+		----------------
+	*/
+	/*!
+		@brief Pack the 7, 9, 12, and 21-bit selectors, whose integers take two 128-bit words: after the first word is full, the
+		rest of the set that straddles the two goes at the bottom of the second word, then the rest of the sets follow from
+		second_start
+		@param destination [out] where to write the 32 bytes
+		@param source [in] the integers
+		@param bits [in] the size (in bits) of each integer
+		@param straddle [in] the set that straddles the two words (the first word holds sets 0 to straddle)
+		@param sets [in] the total number of 4-integer sets
+		@param second_start [in] the bit of the second word the set after the straddling one starts at
+	*/
+	static inline __attribute__((always_inline)) void pack_two_words(uint8_t *destination, const uint32_t *source, uint32_t bits, uint32_t straddle, uint32_t sets, uint32_t second_start)
+		{
+		uint32_t carried = 32 - straddle * bits;			// the bits of the straddling set that made it into the first word
+		__m128i straddling = _mm_srli_epi32(_mm_loadu_si128((const __m128i *)source + straddle), carried);
+
+		_mm_storeu_si128((__m128i *)destination, pack_sets(source, bits, straddle + 1, 0));
+		_mm_storeu_si128((__m128i *)destination + 1, _mm_or_si128(straddling, pack_sets(source + 4 * (straddle + 1), bits, sets - straddle - 1, second_start)));
+		}
+
 	/*
 		COMPRESS_INTEGER_QMX_IMPROVED::WRITE_OUT()
 		------------------------------------------
-		write a sequence into the destination buffer
+		write a sequence into the destination buffer.  Each word is packed with SSE4.1, a set of 4 integers at a time (see pack_sets()),
+		except the short last word of the 8, 16, and 32-bit selectors which is written an integer at a time.
 	*/
 	void compress_integer_qmx_improved::write_out(uint8_t **buffer, uint32_t *source, uint32_t raw_count, uint32_t size_in_bits, uint8_t **length_buffer)
 		{
 		uint32_t current;
 		uint8_t *destination = *buffer;
 		uint8_t *key_store = *length_buffer;
-		uint32_t sequence_buffer[4];
-		uint32_t instance, value;
+		uint32_t instance;
 		uint8_t type;
 		uint32_t count;
 
@@ -219,152 +344,89 @@ namespace JASS
 						source += 256;
 						break;
 					case 1:		// 1 bit per integer
-						memset(sequence_buffer, 0, sizeof(sequence_buffer));
-						for (value = 0; value < 128; value++)
-							sequence_buffer[value & 0x03] |= source[value] << ((value / 4) * 1);
-
-						memcpy(destination, sequence_buffer, 16);
-						destination += 16;
-						source += 128;
-						break;
 					case 2:		// 2 bits per integer
-						memset(sequence_buffer, 0, sizeof(sequence_buffer));
-						for (value = 0; value < 64; value++)
-							sequence_buffer[value & 0x03] |= source[value] << ((value / 4) * 2);
-
-						memcpy(destination, sequence_buffer, 16);
-						destination += 16;
-						source += 64;
-						break;
 					case 3:		// 3 bits per integer
-						memset(sequence_buffer, 0, sizeof(sequence_buffer));
-						for (value = 0; value < 40; value++)
-							sequence_buffer[value & 0x03] |= source[value] << ((value / 4) * 3);
-
-						memcpy(destination, sequence_buffer, 16);
-						destination += 16;
-						source += 40;
-						break;
 					case 4:		// 4 bits per integer
-						memset(sequence_buffer, 0, sizeof(sequence_buffer));
-						for (value = 0; value < 32; value++)
-							sequence_buffer[value & 0x03] |= source[value] << ((value / 4) * 4);
-
-						memcpy(destination, sequence_buffer, 16);
-						destination += 16;
-						source += 32;
-						break;
 					case 5:		// 5 bits per integer
-						memset(sequence_buffer, 0, sizeof(sequence_buffer));
-						for (value = 0; value < 24; value++)
-							sequence_buffer[value & 0x03] |= source[value] << ((value / 4) * 5);
-
-						memcpy(destination, sequence_buffer, 16);
-						destination += 16;
-						source += 24;
-						break;
 					case 6:		// 6 bits per integer
-						memset(sequence_buffer, 0, sizeof(sequence_buffer));
-						for (value = 0; value < 20; value++)
-							sequence_buffer[value & 0x03] |= source[value] << ((value / 4) * 6);
-						memcpy(destination, sequence_buffer, 16);
+					case 10:		// 10 bits per integer
+						/*
+							Written out for each size so that pack_sets() unrolls with immediate shifts
+						*/
+						switch (size_in_bits)
+							{
+							case 1: _mm_storeu_si128((__m128i *)destination, pack_sets(source, 1, 32, 0)); break;
+							case 2: _mm_storeu_si128((__m128i *)destination, pack_sets(source, 2, 16, 0)); break;
+							case 3: _mm_storeu_si128((__m128i *)destination, pack_sets(source, 3, 10, 0)); break;
+							case 4: _mm_storeu_si128((__m128i *)destination, pack_sets(source, 4, 8, 0)); break;
+							case 5: _mm_storeu_si128((__m128i *)destination, pack_sets(source, 5, 6, 0)); break;
+							case 6: _mm_storeu_si128((__m128i *)destination, pack_sets(source, 6, 5, 0)); break;
+							case 10: _mm_storeu_si128((__m128i *)destination, pack_sets(source, 10, 3, 0)); break;
+							}
 						destination += 16;
-						source += 20;
+						source += table[size_in_bits].integers;
 						break;
 					case 7:		// 7 bits per integer
-						memset(sequence_buffer, 0, sizeof(sequence_buffer));
-						for (value = 0; value < 20; value++)
-							sequence_buffer[value & 0x03] |= source[value] << ((value / 4) * 7);
-						memcpy(destination, sequence_buffer, 16);
-						destination += 16;
-
-						memset(sequence_buffer, 0, sizeof(sequence_buffer));
-						for (value = 16; value < 20; value++)
-							sequence_buffer[value & 0x03] |= source[value] >> 4;
-						for (value = 20; value < 36; value++)
-							sequence_buffer[value & 0x03] |= source[value] << (((value - 20) / 4) * 7 + 3);
-						memcpy(destination, sequence_buffer, 16);
-
-						destination += 16;
+						pack_two_words(destination, source, 7, 4, 9, 3);
+						destination += 32;
 						source += 36;				// 36 in a double 128-bit word
 						break;
 					case 8:		// 8 bits per integer
-						for (instance = 0; instance < 16 && source < end; instance++)
-							*destination++ = (uint8_t)*source++;
+						if (end - source >= 16)
+							{
+							__m128i low = _mm_packus_epi32(_mm_loadu_si128((const __m128i *)source), _mm_loadu_si128((const __m128i *)source + 1));
+							__m128i high = _mm_packus_epi32(_mm_loadu_si128((const __m128i *)source + 2), _mm_loadu_si128((const __m128i *)source + 3));
+							_mm_storeu_si128((__m128i *)destination, _mm_packus_epi16(low, high));
+							destination += 16;
+							source += 16;
+							}
+						else
+							for (instance = 0; instance < 16 && source < end; instance++)
+								*destination++ = (uint8_t)*source++;
 						break;
 					case 9:		// 9 bits per integer
-						memset(sequence_buffer, 0, sizeof(sequence_buffer));
-						for (value = 0; value < 16; value++)
-							sequence_buffer[value & 0x03] |= source[value] << ((value / 4) * 9);
-						memcpy(destination, sequence_buffer, 16);
-						destination += 16;
-
-						memset(sequence_buffer, 0, sizeof(sequence_buffer));
-						for (value = 12; value < 16; value++)
-							sequence_buffer[value & 0x03] |= source[value] >> 5;
-						for (value = 16; value < 28; value++)
-							sequence_buffer[value & 0x03] |= source[value] << (((value - 16) / 4) * 9 + 4);
-						memcpy(destination, sequence_buffer, 16);
-
-						destination += 16;
+						pack_two_words(destination, source, 9, 3, 7, 4);
+						destination += 32;
 						source += 28;				// 28 in a double 128-bit word
 						break;
-					case 10:		// 10 bits per integer
-						memset(sequence_buffer, 0, sizeof(sequence_buffer));
-						for (value = 0; value < 12; value++)
-							sequence_buffer[value & 0x03] |= source[value] << ((value / 4) * 10);
-
-						memcpy(destination, sequence_buffer, 16);
-						destination += 16;
-						source += 12;
-						break;
 					case 12:		// 12 bit integers
-						memset(sequence_buffer, 0, sizeof(sequence_buffer));
-						for (value = 0; value < 12; value++)
-							sequence_buffer[value & 0x03] |= source[value] << ((value / 4) * 12);
-						memcpy(destination, sequence_buffer, 16);
-						destination += 16;
-
-						memset(sequence_buffer, 0, sizeof(sequence_buffer));
-						for (value = 8; value < 12; value++)
-							sequence_buffer[value & 0x03] |= source[value] >> 8;
-						for (value = 12; value < 20; value++)
-							sequence_buffer[value & 0x03] |= source[value] << (((value - 12) / 4) * 12 + 8);
-						memcpy(destination, sequence_buffer, 16);
-
-						destination += 16;
+						pack_two_words(destination, source, 12, 2, 5, 8);
+						destination += 32;
 						source += 20;				// 20 in a double 128-bit word
 						break;
 					case 16:		// 16 bits per integer
-						for (instance = 0; instance < 8 && source < end; instance++)
+						if (end - source >= 8)
 							{
-							*(uint16_t *)destination = (uint16_t)*source++;
-							destination += 2;
+							_mm_storeu_si128((__m128i *)destination, _mm_packus_epi32(_mm_loadu_si128((const __m128i *)source), _mm_loadu_si128((const __m128i *)source + 1)));
+							destination += 16;
+							source += 8;
 							}
+						else
+							for (instance = 0; instance < 8 && source < end; instance++)
+								{
+								uint16_t value = (uint16_t)*source++;
+								memcpy(destination, &value, sizeof(value));
+								destination += 2;
+								}
 						break;
 					case 21:		// 21 bits per integer
-						memset(sequence_buffer, 0, sizeof(sequence_buffer));
-						for (value = 0; value < 8; value++)
-							sequence_buffer[value & 0x03] |= source[value] << ((value / 4) * 21);
-						memcpy(destination, sequence_buffer, 16);
-						destination += 16;
-
-						memset(sequence_buffer, 0, sizeof(sequence_buffer));
-						for (value = 4; value < 8; value++)
-							sequence_buffer[value & 0x03] |= source[value] >> 11;
-						for (value = 8; value < 12; value++)
-							sequence_buffer[value & 0x03] |= source[value] << (((value - 8) / 4) * 21 + 11);
-						memcpy(destination, sequence_buffer, 16);
-
-						destination += 16;
+						pack_two_words(destination, source, 21, 1, 3, 11);
+						destination += 32;
 						source += 12;				// 12 in a double 128-bit word
 						break;
 					case 32:		// 32 bits per integer
-						for (instance = 0; instance < 4 && source < end; instance++)
+						if (end - source >= 4)
 							{
-							*(uint32_t *)destination = (uint32_t)*source++;
-							destination += 4;
+							memcpy(destination, source, 16);
+							destination += 16;
+							source += 4;
 							}
+						else
+							for (instance = 0; instance < 4 && source < end; instance++)
+								{
+								memcpy(destination, source++, 4);
+								destination += 4;
+								}
 						break;
 					}
 				}
@@ -373,6 +435,51 @@ namespace JASS
 		*length_buffer = key_store;
 		}
 
+	/*
+		COMPRESS_INTEGER_QMX_IMPROVED::WRITE_RUN()
+		------------------------------------------
+		A patch key is 0xF0 | ~(patches - 1) & 0x0F and each patch is one byte (how far back from the end of the word it
+		patches, less one) and the 32-bit value to add.  Patches come straight after the word they patch (so as the decoders
+		decode they are always in the last 256 integers), so a key has to end at each word with an exception.
+	*/
+	void compress_integer_qmx_improved::write_run(uint8_t **buffer, const integer *source, size_t start, size_t raw_count, uint32_t size_in_bits, uint8_t **keys)
+		{
+		size_t per_word = table[size_in_bits].integers;
+
+		while (next_exception < exceptions.size() && exceptions[next_exception].at < start + raw_count)
+			{
+			size_t words = (exceptions[next_exception].at - start) / per_word + 1;
+			size_t count = std::min(words * per_word, raw_count);
+			size_t end_of_word = start + words * per_word;
+
+			write_out(buffer, (uint32_t *)source + start, (uint32_t)count, size_in_bits, keys);
+
+			uint8_t *destination = *buffer;
+			while (next_exception < exceptions.size() && exceptions[next_exception].at < start + count)
+				{
+				size_t last = std::min(exceptions.size(), next_exception + 16);
+				size_t patches = 0;
+				while (next_exception + patches < last && exceptions[next_exception + patches].at < start + count)
+					patches++;
+
+				*(*keys)++ = (15 << 4) | (~(patches - 1) & 0x0F);
+				for (; patches > 0; patches--, next_exception++)
+					{
+					*destination++ = (uint8_t)(end_of_word - exceptions[next_exception].at - 1);
+					memcpy(destination, &exceptions[next_exception].add, sizeof(exceptions[next_exception].add));
+					destination += sizeof(exceptions[next_exception].add);
+					}
+				}
+			*buffer = destination;
+
+			start += count;
+			raw_count -= count;
+			}
+
+		if (raw_count > 0)
+			write_out(buffer, (uint32_t *)source + start, (uint32_t)raw_count, size_in_bits, keys);
+		}
+
 	/*
 		MAXIMUM()
 		---------
@@ -399,17 +506,81 @@ namespace JASS
 		return maximum(maximum(a, b), maximum(c, d));
 		}
 
+	/*!
+		@brief An outlier must need at least this many more bits than the integers around it to be made an exception
+	*/
+	static const uint32_t EXCEPTION_GAIN = 4;
+
+	/*!
+		@brief Exceptions are only made in groups this wide or narrower (so a patch always saves more than it costs)
+	*/
+	static const uint32_t EXCEPTION_WIDEST_CONTEXT = 10;
+
+	/*
+		COMPRESS_INTEGER_QMX_IMPROVED::FIND_EXCEPTIONS()
+		------------------------------------------------
+		A group is narrowed to the widest of its other integers and its neighbouring groups (the context) if its widest
+		integer needs EXCEPTION_GAIN more bits than that.  The last 16 integers are left alone because an 8, 16, or 32-bit
+		word at the very end is written short, so nothing can follow it in the payload.
+	*/
+	void compress_integer_qmx_improved::find_exceptions(integer *values, size_t source_integers)
+		{
+		exceptions.clear();
+		next_exception = 0;
+
+		if (format < PATCHED)
+			return;
+
+		for (size_t group = 0; group * 4 + 4 + 16 <= source_integers; group++)
+			{
+			integer *value = values + group * 4;
+			uint8_t *width = length_buffer + group * 4;
+			uint8_t widest = 0, rest = 0;
+			uint32_t outlier = 0;
+
+			for (uint32_t which = 0; which < 4; which++)
+				{
+				uint8_t bits = bits_needed_for(value[which]);
+				if (bits > widest)
+					{
+					rest = maximum(rest, widest);
+					widest = bits;
+					outlier = which;
+					}
+				else
+					rest = maximum(rest, bits);
+				}
+
+			uint8_t context = maximum(maximum(rest, group == 0 ? (uint8_t)0 : *(width - 4)), *(width + 4));
+			if (context > EXCEPTION_WIDEST_CONTEXT || widest < context + EXCEPTION_GAIN)
+				continue;
+
+			integer low = context == 0 ? 1 : value[outlier] & ((1U << context) - 1);
+			exceptions.push_back({group * 4 + outlier, value[outlier] - low});
+			value[outlier] = low;
+			width[0] = width[1] = width[2] = width[3] = maximum(rest, bits_needed_for(low));
+			}
+		}
+
 	/*
 		COMPRESS_INTEGER_QMX_IMPROVED::ENCODE()
 		---------------------------------------
 	*/
 	size_t compress_integer_qmx_improved::encode(void *into_as_void, size_t encoded_buffer_length, const integer *source, size_t source_integers)
 		{
-		uint32_t *into = static_cast<uint32_t *>(into_as_void);
-		const uint32_t WASTAGE = 512;
-		uint8_t *current_length, *destination = (uint8_t *)into, *keys;
-		uint32_t *current, run_length, bits, wastage;
-		uint32_t block, largest;
+		uint8_t *current_length;
+		const uint32_t *current;
+		uint32_t wastage;
+
+		/*
+			An empty sequence encodes as an empty string (and the decoder decodes nothing from it)
+		*/
+		if (source_integers == 0)
+			{
+			if (collecting)
+				tally((const uint8_t *)into_as_void, 0, source, 0);
+			return 0;
+			}
 
 		/*
 			make sure we have enough room to store the lengths
@@ -424,7 +595,7 @@ namespace JASS
 			Get the lengths of the integers
 		*/
 		current_length = length_buffer;
-		for (current = (uint32_t *)source; current < source + source_integers; current++)
+		for (current = source; current < source + source_integers; current++)
 			*current_length++ = bits_needed_for(*current);
 
 		/*
@@ -441,6 +612,188 @@ namespace JASS
 		for (current_length = length_buffer; current_length < length_buffer + source_integers + 4; current_length += 4)
 			*current_length = *(current_length + 1) = *(current_length + 2) = *(current_length + 3) = maximum(*current_length, *(current_length + 1), *(current_length + 2), *(current_length + 3));
 
+		/*
+			Exceptions change the integers, so work on a copy
+		*/
+		if (format >= PATCHED)
+			{
+			if (gap_buffer_length < source_integers)
+				{
+				delete [] gap_buffer;
+				gap_buffer = new uint32_t [(size_t)(gap_buffer_length = source_integers)];
+				}
+			memcpy(gap_buffer, source, source_integers * sizeof(*source));
+			source = gap_buffer;
+			}
+		find_exceptions(gap_buffer, source_integers);
+
+		size_t used = optimal ? write_optimal_sequence(into_as_void, source, source_integers) : write_sequence(into_as_void, source, source_integers);
+		if (collecting)
+			tally((const uint8_t *)into_as_void, used, source, source_integers);
+
+		return used;
+		}
+
+	/*
+		DIFFERENCE_AND_CLASSIFY_SSE41()
+		-------------------------------
+	*/
+	/*!
+		@brief Compute the d-gaps of 4 integers at a time and the (4-wide maximised) number of bits each needs
+		@details A 4-integer block is 0 bits wide only if all 4 d-gaps are 1, otherwise (because bits_needed_for() is monotonic from 1 upwards)
+		it is the number of QMX bits needed for the largest d-gap in the block, which is a lookup on its bit length.
+		@param source [in] The sorted integers.
+		@param source_integers [in] The number of integers in source.
+		@param previous [in] The integer before source[0].
+		@param gap [out] The d-gaps.
+		@param length [out] The number of bits needed for each d-gap.
+		@return The number of integers done (a multiple of 4), the caller does the rest.
+	*/
+	static size_t difference_and_classify_sse41(const uint32_t *source, size_t source_integers, uint32_t previous, uint32_t *gap, uint8_t *length)
+		{
+		const __m128i ones = _mm_set1_epi32(1);
+		__m128i carry = _mm_set1_epi32(previous);
+		size_t done;
+
+		for (done = 0; done + 4 <= source_integers; done += 4)
+			{
+			__m128i docids = _mm_loadu_si128((__m128i *)(source + done));
+			__m128i gaps = _mm_sub_epi32(docids, _mm_alignr_epi8(docids, carry, 12));
+			_mm_storeu_si128((__m128i *)(gap + done), gaps);
+			carry = docids;
+
+			__m128i largest = _mm_max_epu32(gaps, _mm_shuffle_epi32(gaps, _MM_SHUFFLE(2, 3, 0, 1)));
+			largest = _mm_max_epu32(largest, _mm_shuffle_epi32(largest, _MM_SHUFFLE(1, 0, 3, 2)));
+			uint32_t widest = _mm_cvtsi128_si32(largest);
+
+			uint32_t bits = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(gaps, ones))) == 0x0F ? 0 : bits_for_length[widest == 0 ? 0 : 32 - __builtin_clz(widest)];
+			uint32_t lengths = bits * 0x01010101;
+			memcpy(length + done, &lengths, sizeof(lengths));
+			}
+
+		return done;
+		}
+
+	/*
+		DIFFERENCE_AND_CLASSIFY_AVX2()
+		------------------------------
+	*/
+	/*!
+		@brief difference_and_classify_sse41() 8 integers at a time using AVX2 (the CPU must support AVX2 and LZCNT)
+		@param source [in] The sorted integers.
+		@param source_integers [in] The number of integers in source.
+		@param previous [in] The integer before source[0].
+		@param gap [out] The d-gaps.
+		@param length [out] The number of bits needed for each d-gap.
+		@return The number of integers done (a multiple of 8), the caller does the rest.
+	*/
+	__attribute__((target("avx2,lzcnt"))) static size_t difference_and_classify_avx2(const uint32_t *source, size_t source_integers, uint32_t previous, uint32_t *gap, uint8_t *length)
+		{
+		const __m256i ones = _mm256_set1_epi32(1);
+		const __m256i rotate = _mm256_setr_epi32(7, 0, 1, 2, 3, 4, 5, 6);
+		__m256i carry = _mm256_set1_epi32(previous);
+		size_t done;
+
+		for (done = 0; done + 8 <= source_integers; done += 8)
+			{
+			__m256i docids = _mm256_loadu_si256((__m256i *)(source + done));
+			__m256i rotated = _mm256_permutevar8x32_epi32(docids, rotate);
+			__m256i gaps = _mm256_sub_epi32(docids, _mm256_blend_epi32(rotated, carry, 0x01));
+			_mm256_storeu_si256((__m256i *)(gap + done), gaps);
+			carry = rotated;
+
+			__m256i largest = _mm256_max_epu32(gaps, _mm256_shuffle_epi32(gaps, _MM_SHUFFLE(2, 3, 0, 1)));
+			largest = _mm256_max_epu32(largest, _mm256_shuffle_epi32(largest, _MM_SHUFFLE(1, 0, 3, 2)));
+			uint32_t all_ones = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(gaps, ones)));
+
+			uint32_t low = (all_ones & 0x0F) == 0x0F ? 0 : bits_for_length[32 - _lzcnt_u32(_mm_cvtsi128_si32(_mm256_castsi256_si128(largest)))];
+			uint32_t high = (all_ones & 0xF0) == 0xF0 ? 0 : bits_for_length[32 - _lzcnt_u32(_mm256_extract_epi32(largest, 4))];
+			uint32_t lengths[2] = {low * 0x01010101, high * 0x01010101};
+			memcpy(length + done, lengths, sizeof(lengths));
+			}
+
+		return done;
+		}
+
+	/*
+		COMPRESS_INTEGER_QMX_IMPROVED::ENCODE_D1()
+		------------------------------------------
+	*/
+	size_t compress_integer_qmx_improved::encode_d1(void *into_as_void, size_t encoded_buffer_length, const integer *source, size_t source_integers, integer previous)
+		{
+		uint8_t *current_length;
+		const uint32_t *current;
+		uint32_t *gap;
+		uint32_t wastage;
+		size_t done;
+
+		if (source_integers == 0)
+			{
+			if (collecting)
+				tally((const uint8_t *)into_as_void, 0, source, 0);
+			return 0;
+			}
+
+		/*
+			make sure we have enough room to store the lengths and the d-gaps
+		*/
+		if (length_buffer_length < source_integers)
+			{
+			delete [] length_buffer;
+			length_buffer = new uint8_t [(size_t)((length_buffer_length = source_integers) + WASTAGE)];
+			}
+		if (gap_buffer_length < source_integers)
+			{
+			delete [] gap_buffer;
+			gap_buffer = new uint32_t [(size_t)(gap_buffer_length = source_integers)];
+			}
+
+		/*
+			Difference, classify, and take the 4-wide maximum of as many integers as the widest kernel can, then
+			the last few are done one at a time, exactly as encode() does them
+		*/
+		if (active_instruction_set() >= AVX2)
+			done = difference_and_classify_avx2(source, source_integers, previous, gap_buffer, length_buffer);
+		else
+			done = difference_and_classify_sse41(source, source_integers, previous, gap_buffer, length_buffer);
+
+		current_length = length_buffer + done;
+		gap = gap_buffer + done;
+		uint8_t *tail = current_length;
+		integer last = done == 0 ? previous : source[done - 1];
+		for (current = source + done; current < source + source_integers; current++, gap++)
+			{
+			*gap = *current - last;
+			last = *current;
+			*current_length++ = bits_needed_for(*gap);
+			}
+
+		for (wastage = 0; wastage < WASTAGE; wastage++)
+			*current_length++ = 0;
+
+		for (current_length = tail; current_length < length_buffer + source_integers + 4; current_length += 4)
+			*current_length = *(current_length + 1) = *(current_length + 2) = *(current_length + 3) = maximum(*current_length, *(current_length + 1), *(current_length + 2), *(current_length + 3));
+
+		find_exceptions(gap_buffer, source_integers);
+
+		size_t used = optimal ? write_optimal_sequence(into_as_void, gap_buffer, source_integers) : write_sequence(into_as_void, gap_buffer, source_integers);
+		if (collecting)
+			tally((const uint8_t *)into_as_void, used, gap_buffer, source_integers);
+
+		return used;
+		}
+
+	/*
+		COMPRESS_INTEGER_QMX_IMPROVED::WRITE_SEQUENCE()
+		-----------------------------------------------
+	*/
+	size_t compress_integer_qmx_improved::write_sequence(void *into_as_void, const integer *source, size_t source_integers)
+		{
+		uint32_t *into = static_cast<uint32_t *>(into_as_void);
+		uint8_t *current_length, *destination = (uint8_t *)into, *keys;
+		uint32_t *current, run_length, bits;
+		uint32_t block, largest;
+
 		/*
 			This code makes sure we can do aligned reads, promoting to larger integers if necessary
 		*/
@@ -677,12 +1030,12 @@ namespace JASS
 				run_length++;
 			else
 				{
-				write_out(&destination, (uint32_t *)current - run_length, run_length, bits, &keys);
+				write_run(&destination, source, current - source - run_length, run_length, bits, &keys);
 				bits = new_needed;
 				run_length = 1;
 				}
 			}
-		write_out(&destination, (uint32_t *)current - run_length, run_length, bits, &keys);
+		write_run(&destination, source, current - source - run_length, run_length, bits, &keys);
 
 		/*
 			Copy the lengths to the end, backwards
@@ -700,5866 +1053,1998 @@ namespace JASS
 		}
 
 	/*
-		COMPRESS_INTEGER_QMX_IMPROVED::UNITTEST_ONE()
-		---------------------------------------------
+		SELECTOR_BITS[]
+		---------------
 	*/
-	// void compress_integer_qmx_improved::unittest_one(const std::vector<uint32_t> &sequence)
-	// 	{
-	// 	compress_integer_qmx_improved *compressor = new compress_integer_qmx_improved;
-	// 	std::vector<uint32_t>compressed(sequence.size() * 2);
-	// 	std::vector<uint32_t>decompressed(sequence.size() + 256);
-
-	// 	auto size_once_compressed = compressor->encode(&compressed[0], compressed.size() * sizeof(compressed[0]), &sequence[0], sequence.size());
-	// 	compressor->decode(&decompressed[0], sequence.size(), &compressed[0], size_once_compressed);
-	// 	decompressed.resize(sequence.size());
-	// 	JASS_assert(decompressed == sequence);
-	// 	delete compressor;
-	// 	}
-
-	}	// end the namespace
-
-#ifdef MAKE_DECOMPRESS
-	/*
-		The following program generates the source code for compress_runlength::decodeArray()
+	/*!
+		@brief The width (in bits) of the integers stored by each selector, an index into table[]
 	*/
+	static const uint8_t selector_bits[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 12, 16, 21, 32};
 
 	/*
-		MAIN()
-		------
-		This version assumes SSE4.1 and so it is *not* portable to non X86 architectures
+		COMPRESS_INTEGER_QMX_IMPROVED::WRITE_OPTIMAL_SEQUENCE()
+		-------------------------------------------------------
+		Every payload word holds a multiple of 4 integers so words start on 4-integer groups.  Working back from the end,
+		the cheapest encoding from group g on is the cheapest over all selectors (whose integers all fit, found from the
+		run of groups that fit each selector) and word counts (1 to 16, one key byte) of that key plus the cheapest
+		encoding from where it ends.  Only the last word can be short: the 8, 16, and 32-bit words store just the integers
+		there are, the rest are zero-padded.
 	*/
-	int main(void)
+	size_t compress_integer_qmx_improved::write_optimal_sequence(void *into_as_void, const integer *source, size_t source_integers)
 		{
-		printf("namespace JASS\n");
-		printf("\t{\n");
-		printf("\talignas(16) static uint32_t static_mask_21[]  = {0x1fffff, 0x1fffff, 0x1fffff, 0x1fffff};\n");
-		printf("\talignas(16) static uint32_t static_mask_12[]  = {0xfff, 0xfff, 0xfff, 0xfff};\n");
-		printf("\talignas(16) static uint32_t static_mask_10[] = {0x3ff, 0x3ff, 0x3ff, 0x3ff};\n");
-		printf("\talignas(16) static uint32_t static_mask_9[]  = {0x1ff, 0x1ff, 0x1ff, 0x1ff};\n");
-		printf("\talignas(16) static uint32_t static_mask_7[]  = {0x7f, 0x7f, 0x7f, 0x7f};\n");
-		printf("\talignas(16) static uint32_t static_mask_6[]  = {0x3f, 0x3f, 0x3f, 0x3f};\n");
-		printf("\talignas(16) static uint32_t static_mask_5[]  = {0x1f, 0x1f, 0x1f, 0x1f};\n");
-		printf("\talignas(16) static uint32_t static_mask_4[]  = {0x0f, 0x0f, 0x0f, 0x0f};\n");
-		printf("\talignas(16) static uint32_t static_mask_3[]  = {0x07, 0x07, 0x07, 0x07};\n");
-		printf("\talignas(16) static uint32_t static_mask_2[]  = {0x03, 0x03, 0x03, 0x03};\n");
-		printf("\talignas(16) static uint32_t static_mask_1[]  = {0x01, 0x01, 0x01, 0x01};\n");
-		printf("\n");
-		printf("\tvoid compress_integer_qmx_improved::decode(integer *to, size_t destination_integers, const void *source, size_t len)\n");
-		printf("\t\t{\n");
-		printf("\t\t__m128i byte_stream, byte_stream_2, tmp, tmp2, mask_21, mask_12, mask_10, mask_9, mask_7, mask_6, mask_5, mask_4, mask_3, mask_2, mask_1;\n");
-		printf("\t\tuint8_t *in = (uint8_t *)source;\n");
-		printf("\t\tuint8_t *keys = ((uint8_t *)source) + len - 1;\n");
-
-		printf("\n");
-		printf("\t\tmask_21 = _mm_loadu_si128((__m128i *)static_mask_21);\n");
-		printf("\t\tmask_12 = _mm_loadu_si128((__m128i *)static_mask_12);\n");
-		printf("\t\tmask_10 = _mm_loadu_si128((__m128i *)static_mask_10);\n");
-		printf("\t\tmask_9 = _mm_loadu_si128((__m128i *)static_mask_9);\n");
-		printf("\t\tmask_7 = _mm_loadu_si128((__m128i *)static_mask_7);\n");
-		printf("\t\tmask_6 = _mm_loadu_si128((__m128i *)static_mask_6);\n");
-		printf("\t\tmask_5 = _mm_loadu_si128((__m128i *)static_mask_5);\n");
-		printf("\t\tmask_4 = _mm_loadu_si128((__m128i *)static_mask_4);\n");
-		printf("\t\tmask_3 = _mm_loadu_si128((__m128i *)static_mask_3);\n");
-		printf("\t\tmask_2 = _mm_loadu_si128((__m128i *)static_mask_2);\n");
-		printf("\t\tmask_1 = _mm_loadu_si128((__m128i *)static_mask_1);\n");
-		printf("\n");
+		uint8_t *destination = (uint8_t *)into_as_void;
+		uint8_t *keys;
+		size_t groups = (source_integers + 3) / 4;
+		size_t fits[sizeof(selector_bits)] = {};				// the number of groups from here on that fit in each selector
 
-		printf("\t\twhile (in <= keys)                      // <= because there can be a boundary case where the final key is 255*0 bit integers\n");
-		printf("\t\t\t{\n");
-		printf("\t\t\tswitch (*keys--)\n");
-		printf("\t\t\t\t{\n");
+		if (cost_buffer_length < groups + 1)
+			{
+			delete [] cost_buffer;
+			delete [] choice_buffer;
+			cost_buffer = new uint64_t [(size_t)(cost_buffer_length = groups + 1)];
+			choice_buffer = new uint8_t [(size_t)cost_buffer_length];
+			}
 
-		for (uint32_t instance = 0; instance <= 0xFF; instance++)
+		cost_buffer[groups] = 0;
+		for (size_t group = groups; group-- > 0;)
 			{
-			printf("\t\t\t\tcase 0x%02x:\n", instance);
-			if ((instance >> 4) == 0)
+			uint8_t width = length_buffer[group * 4];
+			uint64_t best = UINT64_MAX;
+			uint8_t choice = 0;
+
+			for (uint32_t selector = 0; selector < sizeof(selector_bits); selector++)
 				{
-				/*
-					256 0-bit integers
-				*/
-				printf("\t\t\t\t\ttmp = _mm_loadu_si128((__m128i *)static_mask_1);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to, tmp);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 1, tmp);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 2, tmp);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 3, tmp);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 4, tmp);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 5, tmp);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 6, tmp);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 7, tmp);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 8, tmp);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 9, tmp);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 10, tmp);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 11, tmp);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 12, tmp);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 13, tmp);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 14, tmp);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 15, tmp);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 16, tmp);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 17, tmp);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 18, tmp);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 19, tmp);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 20, tmp);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 21, tmp);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 22, tmp);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 23, tmp);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 24, tmp);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 25, tmp);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 26, tmp);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 27, tmp);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 28, tmp);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 29, tmp);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 30, tmp);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 31, tmp);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 32, tmp);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 33, tmp);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 34, tmp);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 35, tmp);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 36, tmp);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 37, tmp);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 38, tmp);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 39, tmp);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 40, tmp);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 41, tmp);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 42, tmp);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 43, tmp);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 44, tmp);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 45, tmp);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 46, tmp);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 47, tmp);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 48, tmp);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 49, tmp);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 50, tmp);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 51, tmp);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 52, tmp);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 53, tmp);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 54, tmp);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 55, tmp);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 56, tmp);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 57, tmp);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 58, tmp);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 59, tmp);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 60, tmp);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 61, tmp);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 62, tmp);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 63, tmp);\n");
-				printf("\t\t\t\t\tto += 256;\n");		// becomes 256 integers
+				uint32_t bits = selector_bits[selector];
+				fits[selector] = (bits == 0 ? width == 0 : width <= bits) ? fits[selector] + 1 : 0;
+
+				uint32_t per_word = table[bits].integers;
+				for (uint32_t words = 1; words <= 16; words++)
+					{
+					size_t start = group * 4 + (words - 1) * per_word;
+					size_t end = start + per_word;
+					if (end >= source_integers)
+						{
+						/*
+							This key goes to the end so its last word may be short
+						*/
+						if (fits[selector] < groups - group)
+							break;
+						uint64_t last = (bits == 8 || bits == 16 || bits == 32) ? (source_integers - start) * bits / 8 : bytes_in_word(bits);
+						uint64_t cost = (words - 1) * bytes_in_word(bits) + last + 1;
+						if (cost < best)
+							{
+							best = cost;
+							choice = (selector << 4) | (words - 1);
+							}
+						break;
+						}
+					if (fits[selector] < end / 4 - group)
+						break;
+					uint64_t cost = words * bytes_in_word(bits) + 1 + cost_buffer[end / 4];
+					if (cost < best)
+						{
+						best = cost;
+						choice = (selector << 4) | (words - 1);
+						}
+					}
 				}
-			else if (instance >> 4 == 1)
-				{
-				/*
-					128 * 1-bit integers
-				*/
-				printf("\t\t\t\t\tbyte_stream = _mm_loadu_si128((__m128i *)in);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_1));\n");
-				printf("\t\t\t\t\tbyte_stream = _mm_srli_epi64(byte_stream, 1);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_1));\n");
-				printf("\t\t\t\t\tbyte_stream = _mm_srli_epi64(byte_stream, 1);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_1));\n");
-				printf("\t\t\t\t\tbyte_stream = _mm_srli_epi64(byte_stream, 1);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_1));\n");
-				printf("\t\t\t\t\tbyte_stream = _mm_srli_epi64(byte_stream, 1);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_1));\n");
-				printf("\t\t\t\t\tbyte_stream = _mm_srli_epi64(byte_stream, 1);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_1));\n");
-				printf("\t\t\t\t\tbyte_stream = _mm_srli_epi64(byte_stream, 1);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_1));\n");
-				printf("\t\t\t\t\tbyte_stream = _mm_srli_epi64(byte_stream, 1);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_1));\n");
-				printf("\t\t\t\t\tbyte_stream = _mm_srli_epi64(byte_stream, 1);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_1));\n");
-				printf("\t\t\t\t\tbyte_stream = _mm_srli_epi64(byte_stream, 1);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 9, _mm_and_si128(byte_stream, mask_1));\n");
-				printf("\t\t\t\t\tbyte_stream = _mm_srli_epi64(byte_stream, 1);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 10, _mm_and_si128(byte_stream, mask_1));\n");
-				printf("\t\t\t\t\tbyte_stream = _mm_srli_epi64(byte_stream, 1);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 11, _mm_and_si128(byte_stream, mask_1));\n");
-				printf("\t\t\t\t\tbyte_stream = _mm_srli_epi64(byte_stream, 1);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 12, _mm_and_si128(byte_stream, mask_1));\n");
-				printf("\t\t\t\t\tbyte_stream = _mm_srli_epi64(byte_stream, 1);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 13, _mm_and_si128(byte_stream, mask_1));\n");
-				printf("\t\t\t\t\tbyte_stream = _mm_srli_epi64(byte_stream, 1);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 14, _mm_and_si128(byte_stream, mask_1));\n");
-				printf("\t\t\t\t\tbyte_stream = _mm_srli_epi64(byte_stream, 1);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 15, _mm_and_si128(byte_stream, mask_1));\n");
-				printf("\t\t\t\t\tbyte_stream = _mm_srli_epi64(byte_stream, 1);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 16, _mm_and_si128(byte_stream, mask_1));\n");
-				printf("\t\t\t\t\tbyte_stream = _mm_srli_epi64(byte_stream, 1);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 17, _mm_and_si128(byte_stream, mask_1));\n");
-				printf("\t\t\t\t\tbyte_stream = _mm_srli_epi64(byte_stream, 1);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 18, _mm_and_si128(byte_stream, mask_1));\n");
-				printf("\t\t\t\t\tbyte_stream = _mm_srli_epi64(byte_stream, 1);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 19, _mm_and_si128(byte_stream, mask_1));\n");
-				printf("\t\t\t\t\tbyte_stream = _mm_srli_epi64(byte_stream, 1);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 20, _mm_and_si128(byte_stream, mask_1));\n");
-				printf("\t\t\t\t\tbyte_stream = _mm_srli_epi64(byte_stream, 1);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 21, _mm_and_si128(byte_stream, mask_1));\n");
-				printf("\t\t\t\t\tbyte_stream = _mm_srli_epi64(byte_stream, 1);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 22, _mm_and_si128(byte_stream, mask_1));\n");
-				printf("\t\t\t\t\tbyte_stream = _mm_srli_epi64(byte_stream, 1);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 23, _mm_and_si128(byte_stream, mask_1));\n");
-				printf("\t\t\t\t\tbyte_stream = _mm_srli_epi64(byte_stream, 1);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 24, _mm_and_si128(byte_stream, mask_1));\n");
-				printf("\t\t\t\t\tbyte_stream = _mm_srli_epi64(byte_stream, 1);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 25, _mm_and_si128(byte_stream, mask_1));\n");
-				printf("\t\t\t\t\tbyte_stream = _mm_srli_epi64(byte_stream, 1);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 26, _mm_and_si128(byte_stream, mask_1));\n");
-				printf("\t\t\t\t\tbyte_stream = _mm_srli_epi64(byte_stream, 1);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 27, _mm_and_si128(byte_stream, mask_1));\n");
-				printf("\t\t\t\t\tbyte_stream = _mm_srli_epi64(byte_stream, 1);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 28, _mm_and_si128(byte_stream, mask_1));\n");
-				printf("\t\t\t\t\tbyte_stream = _mm_srli_epi64(byte_stream, 1);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 29, _mm_and_si128(byte_stream, mask_1));\n");
-				printf("\t\t\t\t\tbyte_stream = _mm_srli_epi64(byte_stream, 1);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 30, _mm_and_si128(byte_stream, mask_1));\n");
-				printf("\t\t\t\t\tbyte_stream = _mm_srli_epi64(byte_stream, 1);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 31, _mm_and_si128(byte_stream, mask_1));\n");
-
-				printf("\t\t\t\t\tin += 16;\n");		// 16 bytes
-				printf("\t\t\t\t\tto += 128;\n");		// becomes 128 integers
-				}
-			else if (instance >> 4 == 2)
-				{
-				/*
-					64 * 2-bit integers
-				*/
-				printf("\t\t\t\t\tbyte_stream = _mm_loadu_si128((__m128i *)in);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_2));\n");
-				printf("\t\t\t\t\tbyte_stream = _mm_srli_epi64(byte_stream, 2);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_2));\n");
-				printf("\t\t\t\t\tbyte_stream = _mm_srli_epi64(byte_stream, 2);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_2));\n");
-				printf("\t\t\t\t\tbyte_stream = _mm_srli_epi64(byte_stream, 2);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_2));\n");
-				printf("\t\t\t\t\tbyte_stream = _mm_srli_epi64(byte_stream, 2);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_2));\n");
-				printf("\t\t\t\t\tbyte_stream = _mm_srli_epi64(byte_stream, 2);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_2));\n");
-				printf("\t\t\t\t\tbyte_stream = _mm_srli_epi64(byte_stream, 2);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_2));\n");
-				printf("\t\t\t\t\tbyte_stream = _mm_srli_epi64(byte_stream, 2);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_2));\n");
-				printf("\t\t\t\t\tbyte_stream = _mm_srli_epi64(byte_stream, 2);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_2));\n");
-				printf("\t\t\t\t\tbyte_stream = _mm_srli_epi64(byte_stream, 2);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 9, _mm_and_si128(byte_stream, mask_2));\n");
-				printf("\t\t\t\t\tbyte_stream = _mm_srli_epi64(byte_stream, 2);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 10, _mm_and_si128(byte_stream, mask_2));\n");
-				printf("\t\t\t\t\tbyte_stream = _mm_srli_epi64(byte_stream, 2);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 11, _mm_and_si128(byte_stream, mask_2));\n");
-				printf("\t\t\t\t\tbyte_stream = _mm_srli_epi64(byte_stream, 2);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 12, _mm_and_si128(byte_stream, mask_2));\n");
-				printf("\t\t\t\t\tbyte_stream = _mm_srli_epi64(byte_stream, 2);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 13, _mm_and_si128(byte_stream, mask_2));\n");
-				printf("\t\t\t\t\tbyte_stream = _mm_srli_epi64(byte_stream, 2);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 14, _mm_and_si128(byte_stream, mask_2));\n");
-				printf("\t\t\t\t\tbyte_stream = _mm_srli_epi64(byte_stream, 2);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 15, _mm_and_si128(byte_stream, mask_2));\n");
-
-				printf("\t\t\t\t\tin += 16;\n");		// 16 bytes
-				printf("\t\t\t\t\tto += 64;\n");		// becomes 64 integers
-				}
-			else if (instance >> 4 == 3)
-				{
-				/*
-					40 * 3-bit integers
-				*/
-				printf("\t\t\t\t\tbyte_stream = _mm_loadu_si128((__m128i *)in);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_3));\n");
-				printf("\t\t\t\t\tbyte_stream = _mm_srli_epi64(byte_stream, 3);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_3));\n");
-				printf("\t\t\t\t\tbyte_stream = _mm_srli_epi64(byte_stream, 3);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_3));\n");
-				printf("\t\t\t\t\tbyte_stream = _mm_srli_epi64(byte_stream, 3);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_3));\n");
-				printf("\t\t\t\t\tbyte_stream = _mm_srli_epi64(byte_stream, 3);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_3));\n");
-				printf("\t\t\t\t\tbyte_stream = _mm_srli_epi64(byte_stream, 3);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_3));\n");
-				printf("\t\t\t\t\tbyte_stream = _mm_srli_epi64(byte_stream, 3);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_3));\n");
-				printf("\t\t\t\t\tbyte_stream = _mm_srli_epi64(byte_stream, 3);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_3));\n");
-				printf("\t\t\t\t\tbyte_stream = _mm_srli_epi64(byte_stream, 3);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_3));\n");
-				printf("\t\t\t\t\tbyte_stream = _mm_srli_epi64(byte_stream, 3);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 9, _mm_and_si128(byte_stream, mask_3));\n");
-
-				printf("\t\t\t\t\tin += 16;\n");		// 16 bytes
-				printf("\t\t\t\t\tto += 40;\n");		// becomes 40 integers
-				}
-			else if (instance >> 4 == 4)
-				{
-				/*
-					32 * 4-bit integers
-				*/
-				printf("\t\t\t\t\tbyte_stream = _mm_loadu_si128((__m128i *)in);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_4));\n");
-				printf("\t\t\t\t\tbyte_stream = _mm_srli_epi64(byte_stream, 4);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_4));\n");
-				printf("\t\t\t\t\tbyte_stream = _mm_srli_epi64(byte_stream, 4);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_4));\n");
-				printf("\t\t\t\t\tbyte_stream = _mm_srli_epi64(byte_stream, 4);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_4));\n");
-				printf("\t\t\t\t\tbyte_stream = _mm_srli_epi64(byte_stream, 4);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_4));\n");
-				printf("\t\t\t\t\tbyte_stream = _mm_srli_epi64(byte_stream, 4);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_4));\n");
-				printf("\t\t\t\t\tbyte_stream = _mm_srli_epi64(byte_stream, 4);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_4));\n");
-				printf("\t\t\t\t\tbyte_stream = _mm_srli_epi64(byte_stream, 4);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_4));\n");
-
-				printf("\t\t\t\t\tin += 16;\n");		// 16 bytes
-				printf("\t\t\t\t\tto += 32;\n");		// becomes 32 integers
-				}
-			else if (instance >> 4 == 5)
-				{
-				/*
-					24 * 5-bit integers
-				*/
-				printf("\t\t\t\t\tbyte_stream = _mm_loadu_si128((__m128i *)in);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_5));\n");
-				printf("\t\t\t\t\tbyte_stream = _mm_srli_epi64(byte_stream, 5);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_5));\n");
-				printf("\t\t\t\t\tbyte_stream = _mm_srli_epi64(byte_stream, 5);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_5));\n");
-				printf("\t\t\t\t\tbyte_stream = _mm_srli_epi64(byte_stream, 5);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_5));\n");
-				printf("\t\t\t\t\tbyte_stream = _mm_srli_epi64(byte_stream, 5);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_5));\n");
-				printf("\t\t\t\t\tbyte_stream = _mm_srli_epi64(byte_stream, 5);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_5));\n");
-
-				printf("\t\t\t\t\tin += 16;\n");		// 16 bytes
-				printf("\t\t\t\t\tto += 24;\n");		// becomes 24 integers
-				}
-			else if (instance >> 4 == 6)
-				{
-				/*
-					20 * 6-bit integers
-				*/
-				printf("\t\t\t\t\tbyte_stream = _mm_loadu_si128((__m128i *)in);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_6));\n");
-				printf("\t\t\t\t\tbyte_stream = _mm_srli_epi64(byte_stream, 6);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_6));\n");
-				printf("\t\t\t\t\tbyte_stream = _mm_srli_epi64(byte_stream, 6);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_6));\n");
-				printf("\t\t\t\t\tbyte_stream = _mm_srli_epi64(byte_stream, 6);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_6));\n");
-				printf("\t\t\t\t\tbyte_stream = _mm_srli_epi64(byte_stream, 6);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_6));\n");
-
-				printf("\t\t\t\t\tin += 16;\n");		// 16 bytes
-				printf("\t\t\t\t\tto += 20;\n");		// becomes 20 integers
-				}
-			else if (instance >> 4 == 7)
-				{
-				/*
-					36 * 7 bit integers (in two 128-bit words)
-				*/
-				printf("\t\t\t\t\tbyte_stream = _mm_loadu_si128((__m128i *)in);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_7));\n");
-				printf("\t\t\t\t\tbyte_stream = _mm_srli_epi32(byte_stream, 7);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_7));\n");
-				printf("\t\t\t\t\tbyte_stream = _mm_srli_epi32(byte_stream, 7);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_7));\n");
-				printf("\t\t\t\t\tbyte_stream = _mm_srli_epi32(byte_stream, 7);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_7));\n");
-
-				printf("\t\t\t\t\tbyte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 4), _mm_srli_epi32(byte_stream, 7)), mask_7));\n");
-				printf("\t\t\t\t\tbyte_stream = _mm_srli_epi32(byte_stream_2, 3);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_7));\n");
-				printf("\t\t\t\t\tbyte_stream = _mm_srli_epi32(byte_stream, 7);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_7));\n");
-				printf("\t\t\t\t\tbyte_stream = _mm_srli_epi32(byte_stream, 7);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_7));\n");
-				printf("\t\t\t\t\tbyte_stream = _mm_srli_epi32(byte_stream, 7);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_7));\n");
-
-				printf("\t\t\t\t\tin += 32;\n");		// 32 bytes
-				printf("\t\t\t\t\tto += 36;\n");		// becomes 36 integers
-				}
-			else if (instance >> 4 == 8)
+			cost_buffer[group] = best;
+			choice_buffer[group] = choice;
+			}
+
+		/*
+			Write the keys in the order chosen, re-using length_buffer for the keys as write_sequence() does
+		*/
+		keys = length_buffer;
+		for (size_t group = 0; group < groups;)
+			{
+			uint32_t bits = selector_bits[choice_buffer[group] >> 4];
+			uint32_t words = (choice_buffer[group] & 0x0F) + 1;
+			size_t start = group * 4;
+			size_t count = std::min((size_t)words * table[bits].integers, source_integers - start);
+
+			write_run(&destination, source, start, count, bits, &keys);
+			group += (count + 3) / 4;
+			}
+
+		/*
+			Copy the keys to the end, backwards
+		*/
+		for (size_t key = keys - length_buffer; key-- > 0;)
+			*destination++ = length_buffer[key];
+
+		return destination - (uint8_t *)into_as_void;
+		}
+
+	/*
+		COMPRESS_INTEGER_QMX_IMPROVED::TALLY()
+		--------------------------------------
+		Walk the keys as the decoder does, measuring each word against the widths of the integers in it
+	*/
+	void compress_integer_qmx_improved::tally(const uint8_t *encoded, size_t encoded_length, const integer *source, size_t source_integers)
+		{
+		stats.sequences++;
+		stats.integers += source_integers;
+		if (encoded_length == 0)
+			return;
+
+		/*
+			The cost of storing each group of 4 at its widest
+		*/
+		for (size_t group = 0; group < source_integers; group += 4)
+			{
+			size_t in_group = std::min((size_t)4, source_integers - group);
+			uint32_t widest = 0, sum = 0;
+			for (size_t which = group; which < group + in_group; which++)
 				{
-				/*
-					16 * 8-bit integers
-				*/
-				printf("\t\t\t\t\ttmp = _mm_loadu_si128((__m128i *)in);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to, _mm_cvtepu8_epi32(tmp));\n");
-				printf("\t\t\t\t\ttmp2 = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp), 0x01));\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 1, _mm_cvtepu8_epi32(tmp2));\n");
-				printf("\t\t\t\t\ttmp = _mm_castps_si128(_mm_movehl_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp)));\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 2, _mm_cvtepu8_epi32(tmp));\n");
-				printf("\t\t\t\t\ttmp2 = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp), 0x01));\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 3, _mm_cvtepu8_epi32(tmp2));\n");
-
-				printf("\t\t\t\t\tin += 16;\n");		// 16 bytes
-				printf("\t\t\t\t\tto += 16;\n");		// becomes 16 integers
+				widest = std::max(widest, (uint32_t)bits_needed_for(source[which]));
+				sum += bits_needed_for(source[which]);
 				}
-			else if (instance >> 4 == 9)
+			stats.grouping_bits += widest * in_group - sum;
+			}
+
+		const uint8_t *in = encoded;
+		const uint8_t *keys = encoded + encoded_length - 1;
+		size_t done = 0;
+		while (in <= keys)
+			{
+			uint32_t type = *keys >> 4;
+			uint32_t words = 16 - (*keys & 0x0F);
+			keys--;
+			stats.key_bytes++;
+
+			if (type == 15)
 				{
-				/*
-					28 * 9-bit ingtegers (in two 128-bit words)
-				*/
-				printf("\t\t\t\t\tbyte_stream = _mm_loadu_si128((__m128i *)in);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_9));\n");
-				printf("\t\t\t\t\tbyte_stream = _mm_srli_epi32(byte_stream, 9);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_9));\n");
-				printf("\t\t\t\t\tbyte_stream = _mm_srli_epi32(byte_stream, 9);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_9));\n");
-				printf("\t\t\t\t\tbyte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 5), _mm_srli_epi32(byte_stream, 9)), mask_9));\n");
-				printf("\t\t\t\t\tbyte_stream = _mm_srli_epi32(byte_stream_2, 4);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_9));\n");
-				printf("\t\t\t\t\tbyte_stream = _mm_srli_epi32(byte_stream, 9);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_9));\n");
-				printf("\t\t\t\t\tbyte_stream = _mm_srli_epi32(byte_stream, 9);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_9));\n");
-				printf("\t\t\t\t\tin += 32;\n");		// 32 bytes
-				printf("\t\t\t\t\tto += 28;\n");		// becomes 28 integers
+				stats.words[15] += words;
+				stats.patch_bytes += words * 5;
+				in += words * 5;
+				continue;
 				}
-			else if (instance >> 4 == 10)
+
+			uint32_t bits = selector_bits[type];
+			for (uint32_t word = 0; word < words; word++)
 				{
 				/*
-					12 * 10-bit integers
+					A short last word holds as many integers as its bytes can
 				*/
-				printf("\t\t\t\t\tbyte_stream = _mm_loadu_si128((__m128i *)in);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_10));\n");
-				printf("\t\t\t\t\tbyte_stream = _mm_srli_epi64(byte_stream, 10);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_10));\n");
-				printf("\t\t\t\t\tbyte_stream = _mm_srli_epi64(byte_stream, 10);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_10));\n");
-
-				printf("\t\t\t\t\tin += 16;\n");		// 16 bytes
-				printf("\t\t\t\t\tto += 12;\n");		// becomes 12 integers
+				size_t bytes = std::min((size_t)bytes_in_word(bits), (size_t)(keys + 1 - in));
+				size_t capacity = bits == 0 ? table[bits].integers : std::min((size_t)table[bits].integers, bytes * 8 / bits);
+				size_t count = std::min(capacity, source_integers - done);
+				bool last = done + count == source_integers;
+
+				stats.words[type]++;
+				stats.payload_bytes += bytes;
+				stats.padding_integers += capacity - count;
+				for (size_t group = done; group < done + count; group += 4)
+					{
+					uint32_t widest = 0;
+					for (size_t which = group; which < std::min(group + 4, source_integers); which++)
+						widest = std::max(widest, (uint32_t)bits_needed_for(source[which]));
+					uint64_t lost = bits > widest ? (bits - widest) * std::min((size_t)4, done + count - group) : 0;
+					(last ? stats.tail_bits : stats.promotion_bits) += lost;
+					}
+
+				in += bytes;
+				done += count;
 				}
-			else if (instance >> 4 == 11)
+			}
+		}
+
+	/*
+		ACTIVE()
+		--------
+	*/
+	/*!
+		@brief Return the instruction set the kernels are chosen for, initially the widest this CPU supports
+	*/
+	static std::atomic<compress_integer_qmx_improved::instruction_set> &active(void)
+		{
+		static std::atomic<compress_integer_qmx_improved::instruction_set> chosen(compress_integer_qmx_improved::supported_instruction_set());
+
+		return chosen;
+		}
+
+	/*
+		COMPRESS_INTEGER_QMX_IMPROVED::SUPPORTED_INSTRUCTION_SET()
+		----------------------------------------------------------
+	*/
+	compress_integer_qmx_improved::instruction_set compress_integer_qmx_improved::supported_instruction_set(void)
+		{
+		__builtin_cpu_init();
+		if (__builtin_cpu_supports("avx512f"))
+			return AVX512;
+		if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("lzcnt"))
+			return AVX2;
+		return SSE41;
+		}
+
+	/*
+		COMPRESS_INTEGER_QMX_IMPROVED::ACTIVE_INSTRUCTION_SET()
+		-------------------------------------------------------
+	*/
+	compress_integer_qmx_improved::instruction_set compress_integer_qmx_improved::active_instruction_set(void)
+		{
+		return active().load(std::memory_order_relaxed);
+		}
+
+	/*
+		COMPRESS_INTEGER_QMX_IMPROVED::USE_INSTRUCTION_SET()
+		----------------------------------------------------
+	*/
+	compress_integer_qmx_improved::instruction_set compress_integer_qmx_improved::use_instruction_set(instruction_set requested)
+		{
+		instruction_set supported = supported_instruction_set();
+		instruction_set chosen = requested < supported ? requested : supported;
+
+		active().store(chosen, std::memory_order_relaxed);
+		return chosen;
+		}
+
+#ifndef MAKE_DECOMPRESS
+	/*
+		COMPRESS_INTEGER_QMX_IMPROVED::DECODE()
+		---------------------------------------
+		The decoders are generated for each instruction set, use the active one
+	*/
+	size_t compress_integer_qmx_improved::decode(integer *to, size_t destination_integers, const void *source, size_t len)
+		{
+		switch (active_instruction_set())
+			{
+			case AVX512:
+				return decode_avx512(to, destination_integers, source, len);
+			case AVX2:
+				return decode_avx2(to, destination_integers, source, len);
+			default:
+				return decode_sse41(to, destination_integers, source, len);
+			}
+		}
+
+	/*
+		COMPRESS_INTEGER_QMX_IMPROVED::DECODE_D1()
+		------------------------------------------
+	*/
+	size_t compress_integer_qmx_improved::decode_d1(integer *to, size_t destination_integers, const void *source, size_t len, integer previous)
+		{
+		switch (active_instruction_set())
+			{
+			case AVX512:
+				return decode_d1_avx512(to, destination_integers, source, len, previous);
+			case AVX2:
+				return decode_d1_avx2(to, destination_integers, source, len, previous);
+			default:
+				return decode_d1_sse41(to, destination_integers, source, len, previous);
+			}
+		}
+
+	/*
+		INTEGERS_FOR_SELECTOR[] and BYTES_FOR_SELECTOR[]
+		------------------------------------------------
+		The number of integers in (and the size of) one payload word of each selector type (type 15 is a 5-byte patch)
+	*/
+	static const uint32_t integers_for_selector[] = {256, 128, 64, 40, 32, 24, 20, 36, 16, 28, 12, 20, 8, 12, 4, 0};
+	static const uint32_t bytes_for_selector[] = {0, 16, 16, 16, 16, 16, 16, 32, 16, 32, 16, 32, 16, 32, 16, 5};
+
+	/*
+		KEY_FITS()
+		----------
+		Whether the fast decoders can decode the key at keys: its integers fit before end, its words (or patches) end no more
+		than 16 bytes past the key (so no load reads more than 15 bytes past the last key), and each patch counts back no
+		further than the decoded integers already written.  Every byte of a short last word is before the key, so this holds
+		for every valid encoding.
+	*/
+	static inline bool key_fits(const uint8_t *keys, const uint8_t *in, const uint32_t *to, const uint32_t *end, size_t decoded)
+		{
+		uint32_t type = *keys >> 4;
+		uint32_t words = 16 - (*keys & 0x0F);
+
+		if ((size_t)(end - to) < words * integers_for_selector[type] || (size_t)(keys - in) + 16 < words * bytes_for_selector[type])
+			return false;
+		for (uint32_t patch = 0; type == 15 && patch < words; patch++)
+			if (in[patch * 5] >= decoded)
+				return false;
+
+		return true;
+		}
+
+	/*
+		COMPRESS_INTEGER_QMX_IMPROVED::DECODE_CHECKED_KEYS()
+		----------------------------------------------------
+		Decode the longest run of keys whose integers fit in the output, whose words are all inside the input, and whose
+		patches only patch integers already decoded with the fast decoder, then decode what remains one word at a time into
+		a local buffer (zero-padded to a whole word) and copy out as much of each word as fits.
+	*/
+	size_t compress_integer_qmx_improved::decode_checked_keys(integer *to, size_t integers_to_decode, const void *source, size_t len, bool cumulative, integer previous)
+		{
+		if (len == 0)
+			return 0;
+
+		const uint8_t *in = (const uint8_t *)source;
+		const uint8_t *keys = in + len - 1;
+		integer *start = to;
+		integer *end = to + integers_to_decode;
+
+		/*
+			Find the last key the fast decoder can safely get to
+		*/
+		const uint8_t *stop = keys + 1;
+		const uint8_t *payload = in;
+		size_t integers = 0;
+		for (const uint8_t *key = keys; payload <= key; key--)
+			{
+			uint32_t type = *key >> 4;
+			uint32_t words = 16 - (*key & 0x0F);
+			uint32_t bytes = words * bytes_for_selector[type];
+
+			if (integers + words * integers_for_selector[type] > integers_to_decode || bytes > (size_t)(key - payload))
+				break;
+
+			bool patches_decoded = true;
+			for (uint32_t patch = 0; type == 15 && patch < words; patch++)
+				patches_decoded = patches_decoded && payload[patch * 5] < integers;
+			if (!patches_decoded)
+				break;
+
+			integers += words * integers_for_selector[type];
+			payload += bytes;
+			stop = key;
+			}
+
+		instruction_set isa = active_instruction_set();
+		if (stop <= keys)
+			{
+			if (!cumulative)
+				isa == AVX512 ? decode_keys_avx512(&to, end, &in, &keys, stop) : isa == AVX2 ? decode_keys_avx2(&to, end, &in, &keys, stop) : decode_keys_sse41(&to, end, &in, &keys, stop);
+			else
 				{
-				/*
-					20 * 12-bit ingtegers (in two 128-bit words)
-				*/
-				printf("\t\t\t\t\tbyte_stream = _mm_loadu_si128((__m128i *)in);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_12));\n");
-				printf("\t\t\t\t\tbyte_stream = _mm_srli_epi32(byte_stream, 12);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_12));\n");
-				printf("\t\t\t\t\tbyte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 8), _mm_srli_epi32(byte_stream, 12)), mask_12));\n");
-				printf("\t\t\t\t\tbyte_stream = _mm_srli_epi32(byte_stream_2, 8);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_12));\n");
-				printf("\t\t\t\t\tbyte_stream = _mm_srli_epi32(byte_stream, 12);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_12));\n");
-
-				printf("\t\t\t\t\tin += 32;\n");		// 32 bytes
-				printf("\t\t\t\t\tto += 20;\n");		// becomes 20 integers
+				isa == AVX512 ? decode_d1_keys_avx512(&to, end, &in, &keys, stop, previous) : isa == AVX2 ? decode_d1_keys_avx2(&to, end, &in, &keys, stop, previous) : decode_d1_keys_sse41(&to, end, &in, &keys, stop, previous);
+				if (to > start)
+					previous = to[-1];
 				}
-			else if (instance >> 4 == 12)
-				{
-				/*
-					16-bit integers
-				*/
-				printf("\t\t\t\t\ttmp = _mm_loadu_si128((__m128i *)in);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to, _mm_cvtepu16_epi32(tmp));\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 1, _mm_cvtepu16_epi32(_mm_castps_si128(_mm_movehl_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp)))));\n");
+			}
 
-				printf("\t\t\t\t\tin += 16;\n");		// 16 bytes
-				printf("\t\t\t\t\tto += 8;\n");			// becomes 8 integers
-				}
-			else if (instance >> 4 == 13)
+		/*
+			The rest, a word at a time
+		*/
+		integer buffer[256];
+		size_t dropped = 0;				// integers decoded since the last copy that there wasn't room for
+		while (in <= keys)
+			{
+			uint32_t type = *keys >> 4;
+			uint32_t words = 16 - (*keys & 0x0F);
+
+			if (type == 15)
 				{
 				/*
-					12 * 21-bit ingtegers (in two 128-bit words)
+					Patch what was copied out, skipping patches to integers there wasn't room for (or that don't exist)
 				*/
-				printf("\t\t\t\t\tbyte_stream = _mm_loadu_si128((__m128i *)in);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_21));\n");
-				printf("\t\t\t\t\tbyte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 11), _mm_srli_epi32(byte_stream, 21)), mask_21));\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(_mm_srli_epi32(byte_stream_2, 11), mask_21));\n");
-
-				printf("\t\t\t\t\tin += 32;\n");			// 32 bytes
-				printf("\t\t\t\t\tto += 12;\n");			// becomes 8 integers
+				keys--;
+				for (uint32_t patch = 0; patch < words && in + 5 <= keys + 1; patch++, in += 5)
+					{
+					size_t back = (size_t)*in + 1;
+					uint32_t add;
+					memcpy(&add, in + 1, sizeof(add));
+					if (back <= dropped || back - dropped > (size_t)(to - start))
+						continue;
+					if (!cumulative)
+						*(to - (back - dropped)) += add;
+					else
+						{
+						for (integer *at = to - (back - dropped); at < to; at++)
+							*at += add;
+						previous += add;
+						}
+					}
+				continue;
 				}
-			else if (instance >> 4 == 14)
-				{
-				/*
-					32-bit integers
-				*/
-				printf("\t\t\t\t\ttmp = _mm_loadu_si128((__m128i *)in);\n");
-				printf("\t\t\t\t\t_mm_storeu_si128((__m128i *)to, tmp);\n");
 
-				printf("\t\t\t\t\tin += 16;\n");		// 16 bytes
-				printf("\t\t\t\t\tto += 4;\n");			// becomes 4 integers
-				}
-			else
+			if (to == end)
+				break;
+			keys--;
+
+			size_t copied = 0;
+			uint32_t word;
+			for (word = 0; word < words && to < end; word++)
 				{
-				printf("\t\t\t\t\tin++;// LCOV_EXCL_LINE\n");			// dummy, can't occur
+				uint8_t padded[33] = {};			// the longest word then its (batch of one) key
+				size_t available = std::min((size_t)bytes_for_selector[type], (size_t)(keys + 1 - in));
+				memcpy(padded, in, available);
+				padded[32] = (uint8_t)((type << 4) | 0x0F);
+
+				integer *into = buffer;
+				const uint8_t *word_payload = padded;
+				const uint8_t *word_key = padded + 32;
+				if (!cumulative)
+					isa == AVX512 ? decode_keys_avx512(&into, buffer + 256, &word_payload, &word_key, padded + 32) : isa == AVX2 ? decode_keys_avx2(&into, buffer + 256, &word_payload, &word_key, padded + 32) : decode_keys_sse41(&into, buffer + 256, &word_payload, &word_key, padded + 32);
+				else
+					isa == AVX512 ? decode_d1_keys_avx512(&into, buffer + 256, &word_payload, &word_key, padded + 32, previous) : isa == AVX2 ? decode_d1_keys_avx2(&into, buffer + 256, &word_payload, &word_key, padded + 32, previous) : decode_d1_keys_sse41(&into, buffer + 256, &word_payload, &word_key, padded + 32, previous);
+
+				size_t count = std::min((size_t)integers_for_selector[type], (size_t)(end - to));
+				memcpy(to, buffer, count * sizeof(*to));
+				to += count;
+				copied += count;
+				previous = to[-1];
+				in += available;
 				}
-			if ((instance & 0xF) == 0xF)
-				printf("\t\t\t\t\tbreak;\n");		// every 32 instances we break (its the end of the fall through)
+			dropped = words * integers_for_selector[type] - copied;
+
+			/*
+				Step over the words there wasn't room for, to any patches after them
+			*/
+			in += std::min((size_t)(words - word) * bytes_for_selector[type], (size_t)(keys + 1 - in));
 			}
-		printf("\t\t\t\t}\n");
-		printf("\t\t\t}\n");
-		printf("\t\t}\n");
-		printf("\t}\n");
 
-		return 0;
+		return to - start;
 		}
-#endif
 
 	/*
-		COMPRESS_INTEGER_QMX_IMPROVED::DECODEARRAY()
+		COMPRESS_INTEGER_QMX_IMPROVED::DECODE_CHECKED()
+		-----------------------------------------------
+	*/
+	size_t compress_integer_qmx_improved::decode_checked(integer *to, size_t destination_integers, const void *source, size_t len)
+		{
+		return decode_checked_keys(to, destination_integers, source, len, false, 0);
+		}
+
+	/*
+		COMPRESS_INTEGER_QMX_IMPROVED::DECODE_D1_CHECKED()
+		--------------------------------------------------
+	*/
+	size_t compress_integer_qmx_improved::decode_d1_checked(integer *to, size_t destination_integers, const void *source, size_t len, integer previous)
+		{
+		return decode_checked_keys(to, destination_integers, source, len, true, previous);
+		}
+
+	/*
+		COMPRESS_INTEGER_QMX_IMPROVED::DECODE_NEXT()
 		--------------------------------------------
-		this code was generated by the method above.
+		Decode as many of the words of one key as make at most 256 integers (one word of 0-bit integers, sixteen of 32-bit
+		ones) and, with its last word, the patch keys after it.  The fast decoder reads them straight from source if the
+		words are whole and before the keys and the key is decoded whole, otherwise from a local copy of what is left of the
+		words (zero padded) followed by a key for just those words and the patch keys.
 	*/
-namespace JASS
-	{
-	alignas(16) static uint32_t static_mask_21[]  = {0x1fffff, 0x1fffff, 0x1fffff, 0x1fffff};			///< AND mask for 21-bit integers
-	alignas(16) static uint32_t static_mask_12[]  = {0xfff, 0xfff, 0xfff, 0xfff};							///< AND mask for 12-bit integers
-	alignas(16) static uint32_t static_mask_10[] = {0x3ff, 0x3ff, 0x3ff, 0x3ff};							///< AND mask for 10-bit integers
-	alignas(16) static uint32_t static_mask_9[]  = {0x1ff, 0x1ff, 0x1ff, 0x1ff};							///< AND mask for 9-bit integers
-	alignas(16) static uint32_t static_mask_7[]  = {0x7f, 0x7f, 0x7f, 0x7f};								///< AND mask for 7-bit integers
-	alignas(16) static uint32_t static_mask_6[]  = {0x3f, 0x3f, 0x3f, 0x3f};								///< AND mask for 6-bit integers
-	alignas(16) static uint32_t static_mask_5[]  = {0x1f, 0x1f, 0x1f, 0x1f};								///< AND mask for 5-bit integers
-	alignas(16) static uint32_t static_mask_4[]  = {0x0f, 0x0f, 0x0f, 0x0f};								///< AND mask for 4-bit integers
-	alignas(16) static uint32_t static_mask_3[]  = {0x07, 0x07, 0x07, 0x07};								///< AND mask for 3-bit integers
-	alignas(16) static uint32_t static_mask_2[]  = {0x03, 0x03, 0x03, 0x03};								///< AND mask for 2-bit integers
-	alignas(16) static uint32_t static_mask_1[]  = {0x01, 0x01, 0x01, 0x01};								///< AND mask for 1-bit integers
-
-	void compress_integer_qmx_improved::decode(integer *to, size_t destination_integers, const void *source, size_t len)
+	size_t compress_integer_qmx_improved::decode_next(integer *to, const void *source, size_t len, size_t *payload_offset, size_t *key_offset, size_t *word_offset, bool cumulative, integer previous)
 		{
-		__m128i byte_stream, byte_stream_2, tmp, tmp2, mask_21, mask_12, mask_10, mask_9, mask_7, mask_6, mask_5, mask_4, mask_3, mask_2, mask_1;
-		uint8_t *in = (uint8_t *)source;
-		uint8_t *keys = ((uint8_t *)source) + len - 1;
-
-		mask_21 = _mm_loadu_si128((__m128i *)static_mask_21);
-		mask_12 = _mm_loadu_si128((__m128i *)static_mask_12);
-		mask_10 = _mm_loadu_si128((__m128i *)static_mask_10);
-		mask_9 = _mm_loadu_si128((__m128i *)static_mask_9);
-		mask_7 = _mm_loadu_si128((__m128i *)static_mask_7);
-		mask_6 = _mm_loadu_si128((__m128i *)static_mask_6);
-		mask_5 = _mm_loadu_si128((__m128i *)static_mask_5);
-		mask_4 = _mm_loadu_si128((__m128i *)static_mask_4);
-		mask_3 = _mm_loadu_si128((__m128i *)static_mask_3);
-		mask_2 = _mm_loadu_si128((__m128i *)static_mask_2);
-		mask_1 = _mm_loadu_si128((__m128i *)static_mask_1);
-
-		while (in <= keys)                      // <= because there can be a boundary case where the final key is 255*0 bit integers
+		if (*payload_offset >= len || *key_offset >= len - *payload_offset)
+			return 0;
+
+		const uint8_t *in = (const uint8_t *)source + *payload_offset;
+		const uint8_t *keys = (const uint8_t *)source + len - 1 - *key_offset;
+		integer *start = to;
+
+		uint32_t type = *keys >> 4;
+		uint32_t words = 16 - (*keys & 0x0F);
+		if (type == 15 || *word_offset >= words)
+			return 0;				// a patch before anything it could patch (or a word_offset this didn't give)
+		uint32_t chunk = std::min(words - (uint32_t)*word_offset, MAX_INTEGERS_PER_CALL / integers_for_selector[type]);
+		bool last = *word_offset + chunk == words;
+		size_t integers = chunk * integers_for_selector[type];
+		size_t bytes = chunk * bytes_for_selector[type];
+
+		/*
+			The byte before the last key might be payload that just looks like a patch key, so only count it as one if the words
+			and all the patches fit before it
+		*/
+		const uint8_t *stop = keys;
+		size_t patches = 0;
+		while (last && stop - 1 >= in && (*(stop - 1) >> 4) == 15 && bytes + (patches + 16 - (*(stop - 1) & 0x0F)) * 5 <= (size_t)(stop - 1 - in))
+			patches += 16 - (*--stop & 0x0F);
+		size_t total = bytes + patches * 5;
+		size_t available = std::min(total, (size_t)(stop - in));
+
+		/*
+			Part of a key, or the last key: its words (zero padded) then a key for them then the patch keys
+		*/
+		uint8_t padded[2048];				// 16 words of 32 bytes, patches to 256 integers, and their keys
+		const uint8_t *from = in;
+		const uint8_t *from_keys = keys;
+		const uint8_t *from_stop = stop;
+		if (available < total || chunk < words)
 			{
-			switch (*keys--)
-				{
-				case 0x00:
-					tmp = _mm_loadu_si128((__m128i *)static_mask_1);
-					_mm_storeu_si128((__m128i *)to, tmp);
-					_mm_storeu_si128((__m128i *)to + 1, tmp);
-					_mm_storeu_si128((__m128i *)to + 2, tmp);
-					_mm_storeu_si128((__m128i *)to + 3, tmp);
-					_mm_storeu_si128((__m128i *)to + 4, tmp);
-					_mm_storeu_si128((__m128i *)to + 5, tmp);
-					_mm_storeu_si128((__m128i *)to + 6, tmp);
-					_mm_storeu_si128((__m128i *)to + 7, tmp);
-					_mm_storeu_si128((__m128i *)to + 8, tmp);
-					_mm_storeu_si128((__m128i *)to + 9, tmp);
-					_mm_storeu_si128((__m128i *)to + 10, tmp);
-					_mm_storeu_si128((__m128i *)to + 11, tmp);
-					_mm_storeu_si128((__m128i *)to + 12, tmp);
-					_mm_storeu_si128((__m128i *)to + 13, tmp);
-					_mm_storeu_si128((__m128i *)to + 14, tmp);
-					_mm_storeu_si128((__m128i *)to + 15, tmp);
-					_mm_storeu_si128((__m128i *)to + 16, tmp);
-					_mm_storeu_si128((__m128i *)to + 17, tmp);
-					_mm_storeu_si128((__m128i *)to + 18, tmp);
-					_mm_storeu_si128((__m128i *)to + 19, tmp);
-					_mm_storeu_si128((__m128i *)to + 20, tmp);
-					_mm_storeu_si128((__m128i *)to + 21, tmp);
-					_mm_storeu_si128((__m128i *)to + 22, tmp);
-					_mm_storeu_si128((__m128i *)to + 23, tmp);
-					_mm_storeu_si128((__m128i *)to + 24, tmp);
-					_mm_storeu_si128((__m128i *)to + 25, tmp);
-					_mm_storeu_si128((__m128i *)to + 26, tmp);
-					_mm_storeu_si128((__m128i *)to + 27, tmp);
-					_mm_storeu_si128((__m128i *)to + 28, tmp);
-					_mm_storeu_si128((__m128i *)to + 29, tmp);
-					_mm_storeu_si128((__m128i *)to + 30, tmp);
-					_mm_storeu_si128((__m128i *)to + 31, tmp);
-					_mm_storeu_si128((__m128i *)to + 32, tmp);
-					_mm_storeu_si128((__m128i *)to + 33, tmp);
-					_mm_storeu_si128((__m128i *)to + 34, tmp);
-					_mm_storeu_si128((__m128i *)to + 35, tmp);
-					_mm_storeu_si128((__m128i *)to + 36, tmp);
-					_mm_storeu_si128((__m128i *)to + 37, tmp);
-					_mm_storeu_si128((__m128i *)to + 38, tmp);
-					_mm_storeu_si128((__m128i *)to + 39, tmp);
-					_mm_storeu_si128((__m128i *)to + 40, tmp);
-					_mm_storeu_si128((__m128i *)to + 41, tmp);
-					_mm_storeu_si128((__m128i *)to + 42, tmp);
-					_mm_storeu_si128((__m128i *)to + 43, tmp);
-					_mm_storeu_si128((__m128i *)to + 44, tmp);
-					_mm_storeu_si128((__m128i *)to + 45, tmp);
-					_mm_storeu_si128((__m128i *)to + 46, tmp);
-					_mm_storeu_si128((__m128i *)to + 47, tmp);
-					_mm_storeu_si128((__m128i *)to + 48, tmp);
-					_mm_storeu_si128((__m128i *)to + 49, tmp);
-					_mm_storeu_si128((__m128i *)to + 50, tmp);
-					_mm_storeu_si128((__m128i *)to + 51, tmp);
-					_mm_storeu_si128((__m128i *)to + 52, tmp);
-					_mm_storeu_si128((__m128i *)to + 53, tmp);
-					_mm_storeu_si128((__m128i *)to + 54, tmp);
-					_mm_storeu_si128((__m128i *)to + 55, tmp);
-					_mm_storeu_si128((__m128i *)to + 56, tmp);
-					_mm_storeu_si128((__m128i *)to + 57, tmp);
-					_mm_storeu_si128((__m128i *)to + 58, tmp);
-					_mm_storeu_si128((__m128i *)to + 59, tmp);
-					_mm_storeu_si128((__m128i *)to + 60, tmp);
-					_mm_storeu_si128((__m128i *)to + 61, tmp);
-					_mm_storeu_si128((__m128i *)to + 62, tmp);
-					_mm_storeu_si128((__m128i *)to + 63, tmp);
-					to += 256;
-				case 0x01:
-					tmp = _mm_loadu_si128((__m128i *)static_mask_1);
-					_mm_storeu_si128((__m128i *)to, tmp);
-					_mm_storeu_si128((__m128i *)to + 1, tmp);
-					_mm_storeu_si128((__m128i *)to + 2, tmp);
-					_mm_storeu_si128((__m128i *)to + 3, tmp);
-					_mm_storeu_si128((__m128i *)to + 4, tmp);
-					_mm_storeu_si128((__m128i *)to + 5, tmp);
-					_mm_storeu_si128((__m128i *)to + 6, tmp);
-					_mm_storeu_si128((__m128i *)to + 7, tmp);
-					_mm_storeu_si128((__m128i *)to + 8, tmp);
-					_mm_storeu_si128((__m128i *)to + 9, tmp);
-					_mm_storeu_si128((__m128i *)to + 10, tmp);
-					_mm_storeu_si128((__m128i *)to + 11, tmp);
-					_mm_storeu_si128((__m128i *)to + 12, tmp);
-					_mm_storeu_si128((__m128i *)to + 13, tmp);
-					_mm_storeu_si128((__m128i *)to + 14, tmp);
-					_mm_storeu_si128((__m128i *)to + 15, tmp);
-					_mm_storeu_si128((__m128i *)to + 16, tmp);
-					_mm_storeu_si128((__m128i *)to + 17, tmp);
-					_mm_storeu_si128((__m128i *)to + 18, tmp);
-					_mm_storeu_si128((__m128i *)to + 19, tmp);
-					_mm_storeu_si128((__m128i *)to + 20, tmp);
-					_mm_storeu_si128((__m128i *)to + 21, tmp);
-					_mm_storeu_si128((__m128i *)to + 22, tmp);
-					_mm_storeu_si128((__m128i *)to + 23, tmp);
-					_mm_storeu_si128((__m128i *)to + 24, tmp);
-					_mm_storeu_si128((__m128i *)to + 25, tmp);
-					_mm_storeu_si128((__m128i *)to + 26, tmp);
-					_mm_storeu_si128((__m128i *)to + 27, tmp);
-					_mm_storeu_si128((__m128i *)to + 28, tmp);
-					_mm_storeu_si128((__m128i *)to + 29, tmp);
-					_mm_storeu_si128((__m128i *)to + 30, tmp);
-					_mm_storeu_si128((__m128i *)to + 31, tmp);
-					_mm_storeu_si128((__m128i *)to + 32, tmp);
-					_mm_storeu_si128((__m128i *)to + 33, tmp);
-					_mm_storeu_si128((__m128i *)to + 34, tmp);
-					_mm_storeu_si128((__m128i *)to + 35, tmp);
-					_mm_storeu_si128((__m128i *)to + 36, tmp);
-					_mm_storeu_si128((__m128i *)to + 37, tmp);
-					_mm_storeu_si128((__m128i *)to + 38, tmp);
-					_mm_storeu_si128((__m128i *)to + 39, tmp);
-					_mm_storeu_si128((__m128i *)to + 40, tmp);
-					_mm_storeu_si128((__m128i *)to + 41, tmp);
-					_mm_storeu_si128((__m128i *)to + 42, tmp);
-					_mm_storeu_si128((__m128i *)to + 43, tmp);
-					_mm_storeu_si128((__m128i *)to + 44, tmp);
-					_mm_storeu_si128((__m128i *)to + 45, tmp);
-					_mm_storeu_si128((__m128i *)to + 46, tmp);
-					_mm_storeu_si128((__m128i *)to + 47, tmp);
-					_mm_storeu_si128((__m128i *)to + 48, tmp);
-					_mm_storeu_si128((__m128i *)to + 49, tmp);
-					_mm_storeu_si128((__m128i *)to + 50, tmp);
-					_mm_storeu_si128((__m128i *)to + 51, tmp);
-					_mm_storeu_si128((__m128i *)to + 52, tmp);
-					_mm_storeu_si128((__m128i *)to + 53, tmp);
-					_mm_storeu_si128((__m128i *)to + 54, tmp);
-					_mm_storeu_si128((__m128i *)to + 55, tmp);
-					_mm_storeu_si128((__m128i *)to + 56, tmp);
-					_mm_storeu_si128((__m128i *)to + 57, tmp);
-					_mm_storeu_si128((__m128i *)to + 58, tmp);
-					_mm_storeu_si128((__m128i *)to + 59, tmp);
-					_mm_storeu_si128((__m128i *)to + 60, tmp);
-					_mm_storeu_si128((__m128i *)to + 61, tmp);
-					_mm_storeu_si128((__m128i *)to + 62, tmp);
-					_mm_storeu_si128((__m128i *)to + 63, tmp);
-					to += 256;
-				case 0x02:
-					tmp = _mm_loadu_si128((__m128i *)static_mask_1);
-					_mm_storeu_si128((__m128i *)to, tmp);
-					_mm_storeu_si128((__m128i *)to + 1, tmp);
-					_mm_storeu_si128((__m128i *)to + 2, tmp);
-					_mm_storeu_si128((__m128i *)to + 3, tmp);
-					_mm_storeu_si128((__m128i *)to + 4, tmp);
-					_mm_storeu_si128((__m128i *)to + 5, tmp);
-					_mm_storeu_si128((__m128i *)to + 6, tmp);
-					_mm_storeu_si128((__m128i *)to + 7, tmp);
-					_mm_storeu_si128((__m128i *)to + 8, tmp);
-					_mm_storeu_si128((__m128i *)to + 9, tmp);
-					_mm_storeu_si128((__m128i *)to + 10, tmp);
-					_mm_storeu_si128((__m128i *)to + 11, tmp);
-					_mm_storeu_si128((__m128i *)to + 12, tmp);
-					_mm_storeu_si128((__m128i *)to + 13, tmp);
-					_mm_storeu_si128((__m128i *)to + 14, tmp);
-					_mm_storeu_si128((__m128i *)to + 15, tmp);
-					_mm_storeu_si128((__m128i *)to + 16, tmp);
-					_mm_storeu_si128((__m128i *)to + 17, tmp);
-					_mm_storeu_si128((__m128i *)to + 18, tmp);
-					_mm_storeu_si128((__m128i *)to + 19, tmp);
-					_mm_storeu_si128((__m128i *)to + 20, tmp);
-					_mm_storeu_si128((__m128i *)to + 21, tmp);
-					_mm_storeu_si128((__m128i *)to + 22, tmp);
-					_mm_storeu_si128((__m128i *)to + 23, tmp);
-					_mm_storeu_si128((__m128i *)to + 24, tmp);
-					_mm_storeu_si128((__m128i *)to + 25, tmp);
-					_mm_storeu_si128((__m128i *)to + 26, tmp);
-					_mm_storeu_si128((__m128i *)to + 27, tmp);
-					_mm_storeu_si128((__m128i *)to + 28, tmp);
-					_mm_storeu_si128((__m128i *)to + 29, tmp);
-					_mm_storeu_si128((__m128i *)to + 30, tmp);
-					_mm_storeu_si128((__m128i *)to + 31, tmp);
-					_mm_storeu_si128((__m128i *)to + 32, tmp);
-					_mm_storeu_si128((__m128i *)to + 33, tmp);
-					_mm_storeu_si128((__m128i *)to + 34, tmp);
-					_mm_storeu_si128((__m128i *)to + 35, tmp);
-					_mm_storeu_si128((__m128i *)to + 36, tmp);
-					_mm_storeu_si128((__m128i *)to + 37, tmp);
-					_mm_storeu_si128((__m128i *)to + 38, tmp);
-					_mm_storeu_si128((__m128i *)to + 39, tmp);
-					_mm_storeu_si128((__m128i *)to + 40, tmp);
-					_mm_storeu_si128((__m128i *)to + 41, tmp);
-					_mm_storeu_si128((__m128i *)to + 42, tmp);
-					_mm_storeu_si128((__m128i *)to + 43, tmp);
-					_mm_storeu_si128((__m128i *)to + 44, tmp);
-					_mm_storeu_si128((__m128i *)to + 45, tmp);
-					_mm_storeu_si128((__m128i *)to + 46, tmp);
-					_mm_storeu_si128((__m128i *)to + 47, tmp);
-					_mm_storeu_si128((__m128i *)to + 48, tmp);
-					_mm_storeu_si128((__m128i *)to + 49, tmp);
-					_mm_storeu_si128((__m128i *)to + 50, tmp);
-					_mm_storeu_si128((__m128i *)to + 51, tmp);
-					_mm_storeu_si128((__m128i *)to + 52, tmp);
-					_mm_storeu_si128((__m128i *)to + 53, tmp);
-					_mm_storeu_si128((__m128i *)to + 54, tmp);
-					_mm_storeu_si128((__m128i *)to + 55, tmp);
-					_mm_storeu_si128((__m128i *)to + 56, tmp);
-					_mm_storeu_si128((__m128i *)to + 57, tmp);
-					_mm_storeu_si128((__m128i *)to + 58, tmp);
-					_mm_storeu_si128((__m128i *)to + 59, tmp);
-					_mm_storeu_si128((__m128i *)to + 60, tmp);
-					_mm_storeu_si128((__m128i *)to + 61, tmp);
-					_mm_storeu_si128((__m128i *)to + 62, tmp);
-					_mm_storeu_si128((__m128i *)to + 63, tmp);
-					to += 256;
-				case 0x03:
-					tmp = _mm_loadu_si128((__m128i *)static_mask_1);
-					_mm_storeu_si128((__m128i *)to, tmp);
-					_mm_storeu_si128((__m128i *)to + 1, tmp);
-					_mm_storeu_si128((__m128i *)to + 2, tmp);
-					_mm_storeu_si128((__m128i *)to + 3, tmp);
-					_mm_storeu_si128((__m128i *)to + 4, tmp);
-					_mm_storeu_si128((__m128i *)to + 5, tmp);
-					_mm_storeu_si128((__m128i *)to + 6, tmp);
-					_mm_storeu_si128((__m128i *)to + 7, tmp);
-					_mm_storeu_si128((__m128i *)to + 8, tmp);
-					_mm_storeu_si128((__m128i *)to + 9, tmp);
-					_mm_storeu_si128((__m128i *)to + 10, tmp);
-					_mm_storeu_si128((__m128i *)to + 11, tmp);
-					_mm_storeu_si128((__m128i *)to + 12, tmp);
-					_mm_storeu_si128((__m128i *)to + 13, tmp);
-					_mm_storeu_si128((__m128i *)to + 14, tmp);
-					_mm_storeu_si128((__m128i *)to + 15, tmp);
-					_mm_storeu_si128((__m128i *)to + 16, tmp);
-					_mm_storeu_si128((__m128i *)to + 17, tmp);
-					_mm_storeu_si128((__m128i *)to + 18, tmp);
-					_mm_storeu_si128((__m128i *)to + 19, tmp);
-					_mm_storeu_si128((__m128i *)to + 20, tmp);
-					_mm_storeu_si128((__m128i *)to + 21, tmp);
-					_mm_storeu_si128((__m128i *)to + 22, tmp);
-					_mm_storeu_si128((__m128i *)to + 23, tmp);
-					_mm_storeu_si128((__m128i *)to + 24, tmp);
-					_mm_storeu_si128((__m128i *)to + 25, tmp);
-					_mm_storeu_si128((__m128i *)to + 26, tmp);
-					_mm_storeu_si128((__m128i *)to + 27, tmp);
-					_mm_storeu_si128((__m128i *)to + 28, tmp);
-					_mm_storeu_si128((__m128i *)to + 29, tmp);
-					_mm_storeu_si128((__m128i *)to + 30, tmp);
-					_mm_storeu_si128((__m128i *)to + 31, tmp);
-					_mm_storeu_si128((__m128i *)to + 32, tmp);
-					_mm_storeu_si128((__m128i *)to + 33, tmp);
-					_mm_storeu_si128((__m128i *)to + 34, tmp);
-					_mm_storeu_si128((__m128i *)to + 35, tmp);
-					_mm_storeu_si128((__m128i *)to + 36, tmp);
-					_mm_storeu_si128((__m128i *)to + 37, tmp);
-					_mm_storeu_si128((__m128i *)to + 38, tmp);
-					_mm_storeu_si128((__m128i *)to + 39, tmp);
-					_mm_storeu_si128((__m128i *)to + 40, tmp);
-					_mm_storeu_si128((__m128i *)to + 41, tmp);
-					_mm_storeu_si128((__m128i *)to + 42, tmp);
-					_mm_storeu_si128((__m128i *)to + 43, tmp);
-					_mm_storeu_si128((__m128i *)to + 44, tmp);
-					_mm_storeu_si128((__m128i *)to + 45, tmp);
-					_mm_storeu_si128((__m128i *)to + 46, tmp);
-					_mm_storeu_si128((__m128i *)to + 47, tmp);
-					_mm_storeu_si128((__m128i *)to + 48, tmp);
-					_mm_storeu_si128((__m128i *)to + 49, tmp);
-					_mm_storeu_si128((__m128i *)to + 50, tmp);
-					_mm_storeu_si128((__m128i *)to + 51, tmp);
-					_mm_storeu_si128((__m128i *)to + 52, tmp);
-					_mm_storeu_si128((__m128i *)to + 53, tmp);
-					_mm_storeu_si128((__m128i *)to + 54, tmp);
-					_mm_storeu_si128((__m128i *)to + 55, tmp);
-					_mm_storeu_si128((__m128i *)to + 56, tmp);
-					_mm_storeu_si128((__m128i *)to + 57, tmp);
-					_mm_storeu_si128((__m128i *)to + 58, tmp);
-					_mm_storeu_si128((__m128i *)to + 59, tmp);
-					_mm_storeu_si128((__m128i *)to + 60, tmp);
-					_mm_storeu_si128((__m128i *)to + 61, tmp);
-					_mm_storeu_si128((__m128i *)to + 62, tmp);
-					_mm_storeu_si128((__m128i *)to + 63, tmp);
-					to += 256;
-				case 0x04:
-					tmp = _mm_loadu_si128((__m128i *)static_mask_1);
-					_mm_storeu_si128((__m128i *)to, tmp);
-					_mm_storeu_si128((__m128i *)to + 1, tmp);
-					_mm_storeu_si128((__m128i *)to + 2, tmp);
-					_mm_storeu_si128((__m128i *)to + 3, tmp);
-					_mm_storeu_si128((__m128i *)to + 4, tmp);
-					_mm_storeu_si128((__m128i *)to + 5, tmp);
-					_mm_storeu_si128((__m128i *)to + 6, tmp);
-					_mm_storeu_si128((__m128i *)to + 7, tmp);
-					_mm_storeu_si128((__m128i *)to + 8, tmp);
-					_mm_storeu_si128((__m128i *)to + 9, tmp);
-					_mm_storeu_si128((__m128i *)to + 10, tmp);
-					_mm_storeu_si128((__m128i *)to + 11, tmp);
-					_mm_storeu_si128((__m128i *)to + 12, tmp);
-					_mm_storeu_si128((__m128i *)to + 13, tmp);
-					_mm_storeu_si128((__m128i *)to + 14, tmp);
-					_mm_storeu_si128((__m128i *)to + 15, tmp);
-					_mm_storeu_si128((__m128i *)to + 16, tmp);
-					_mm_storeu_si128((__m128i *)to + 17, tmp);
-					_mm_storeu_si128((__m128i *)to + 18, tmp);
-					_mm_storeu_si128((__m128i *)to + 19, tmp);
-					_mm_storeu_si128((__m128i *)to + 20, tmp);
-					_mm_storeu_si128((__m128i *)to + 21, tmp);
-					_mm_storeu_si128((__m128i *)to + 22, tmp);
-					_mm_storeu_si128((__m128i *)to + 23, tmp);
-					_mm_storeu_si128((__m128i *)to + 24, tmp);
-					_mm_storeu_si128((__m128i *)to + 25, tmp);
-					_mm_storeu_si128((__m128i *)to + 26, tmp);
-					_mm_storeu_si128((__m128i *)to + 27, tmp);
-					_mm_storeu_si128((__m128i *)to + 28, tmp);
-					_mm_storeu_si128((__m128i *)to + 29, tmp);
-					_mm_storeu_si128((__m128i *)to + 30, tmp);
-					_mm_storeu_si128((__m128i *)to + 31, tmp);
-					_mm_storeu_si128((__m128i *)to + 32, tmp);
-					_mm_storeu_si128((__m128i *)to + 33, tmp);
-					_mm_storeu_si128((__m128i *)to + 34, tmp);
-					_mm_storeu_si128((__m128i *)to + 35, tmp);
-					_mm_storeu_si128((__m128i *)to + 36, tmp);
-					_mm_storeu_si128((__m128i *)to + 37, tmp);
-					_mm_storeu_si128((__m128i *)to + 38, tmp);
-					_mm_storeu_si128((__m128i *)to + 39, tmp);
-					_mm_storeu_si128((__m128i *)to + 40, tmp);
-					_mm_storeu_si128((__m128i *)to + 41, tmp);
-					_mm_storeu_si128((__m128i *)to + 42, tmp);
-					_mm_storeu_si128((__m128i *)to + 43, tmp);
-					_mm_storeu_si128((__m128i *)to + 44, tmp);
-					_mm_storeu_si128((__m128i *)to + 45, tmp);
-					_mm_storeu_si128((__m128i *)to + 46, tmp);
-					_mm_storeu_si128((__m128i *)to + 47, tmp);
-					_mm_storeu_si128((__m128i *)to + 48, tmp);
-					_mm_storeu_si128((__m128i *)to + 49, tmp);
-					_mm_storeu_si128((__m128i *)to + 50, tmp);
-					_mm_storeu_si128((__m128i *)to + 51, tmp);
-					_mm_storeu_si128((__m128i *)to + 52, tmp);
-					_mm_storeu_si128((__m128i *)to + 53, tmp);
-					_mm_storeu_si128((__m128i *)to + 54, tmp);
-					_mm_storeu_si128((__m128i *)to + 55, tmp);
-					_mm_storeu_si128((__m128i *)to + 56, tmp);
-					_mm_storeu_si128((__m128i *)to + 57, tmp);
-					_mm_storeu_si128((__m128i *)to + 58, tmp);
-					_mm_storeu_si128((__m128i *)to + 59, tmp);
-					_mm_storeu_si128((__m128i *)to + 60, tmp);
-					_mm_storeu_si128((__m128i *)to + 61, tmp);
-					_mm_storeu_si128((__m128i *)to + 62, tmp);
-					_mm_storeu_si128((__m128i *)to + 63, tmp);
-					to += 256;
-				case 0x05:
-					tmp = _mm_loadu_si128((__m128i *)static_mask_1);
-					_mm_storeu_si128((__m128i *)to, tmp);
-					_mm_storeu_si128((__m128i *)to + 1, tmp);
-					_mm_storeu_si128((__m128i *)to + 2, tmp);
-					_mm_storeu_si128((__m128i *)to + 3, tmp);
-					_mm_storeu_si128((__m128i *)to + 4, tmp);
-					_mm_storeu_si128((__m128i *)to + 5, tmp);
-					_mm_storeu_si128((__m128i *)to + 6, tmp);
-					_mm_storeu_si128((__m128i *)to + 7, tmp);
-					_mm_storeu_si128((__m128i *)to + 8, tmp);
-					_mm_storeu_si128((__m128i *)to + 9, tmp);
-					_mm_storeu_si128((__m128i *)to + 10, tmp);
-					_mm_storeu_si128((__m128i *)to + 11, tmp);
-					_mm_storeu_si128((__m128i *)to + 12, tmp);
-					_mm_storeu_si128((__m128i *)to + 13, tmp);
-					_mm_storeu_si128((__m128i *)to + 14, tmp);
-					_mm_storeu_si128((__m128i *)to + 15, tmp);
-					_mm_storeu_si128((__m128i *)to + 16, tmp);
-					_mm_storeu_si128((__m128i *)to + 17, tmp);
-					_mm_storeu_si128((__m128i *)to + 18, tmp);
-					_mm_storeu_si128((__m128i *)to + 19, tmp);
-					_mm_storeu_si128((__m128i *)to + 20, tmp);
-					_mm_storeu_si128((__m128i *)to + 21, tmp);
-					_mm_storeu_si128((__m128i *)to + 22, tmp);
-					_mm_storeu_si128((__m128i *)to + 23, tmp);
-					_mm_storeu_si128((__m128i *)to + 24, tmp);
-					_mm_storeu_si128((__m128i *)to + 25, tmp);
-					_mm_storeu_si128((__m128i *)to + 26, tmp);
-					_mm_storeu_si128((__m128i *)to + 27, tmp);
-					_mm_storeu_si128((__m128i *)to + 28, tmp);
-					_mm_storeu_si128((__m128i *)to + 29, tmp);
-					_mm_storeu_si128((__m128i *)to + 30, tmp);
-					_mm_storeu_si128((__m128i *)to + 31, tmp);
-					_mm_storeu_si128((__m128i *)to + 32, tmp);
-					_mm_storeu_si128((__m128i *)to + 33, tmp);
-					_mm_storeu_si128((__m128i *)to + 34, tmp);
-					_mm_storeu_si128((__m128i *)to + 35, tmp);
-					_mm_storeu_si128((__m128i *)to + 36, tmp);
-					_mm_storeu_si128((__m128i *)to + 37, tmp);
-					_mm_storeu_si128((__m128i *)to + 38, tmp);
-					_mm_storeu_si128((__m128i *)to + 39, tmp);
-					_mm_storeu_si128((__m128i *)to + 40, tmp);
-					_mm_storeu_si128((__m128i *)to + 41, tmp);
-					_mm_storeu_si128((__m128i *)to + 42, tmp);
-					_mm_storeu_si128((__m128i *)to + 43, tmp);
-					_mm_storeu_si128((__m128i *)to + 44, tmp);
-					_mm_storeu_si128((__m128i *)to + 45, tmp);
-					_mm_storeu_si128((__m128i *)to + 46, tmp);
-					_mm_storeu_si128((__m128i *)to + 47, tmp);
-					_mm_storeu_si128((__m128i *)to + 48, tmp);
-					_mm_storeu_si128((__m128i *)to + 49, tmp);
-					_mm_storeu_si128((__m128i *)to + 50, tmp);
-					_mm_storeu_si128((__m128i *)to + 51, tmp);
-					_mm_storeu_si128((__m128i *)to + 52, tmp);
-					_mm_storeu_si128((__m128i *)to + 53, tmp);
-					_mm_storeu_si128((__m128i *)to + 54, tmp);
-					_mm_storeu_si128((__m128i *)to + 55, tmp);
-					_mm_storeu_si128((__m128i *)to + 56, tmp);
-					_mm_storeu_si128((__m128i *)to + 57, tmp);
-					_mm_storeu_si128((__m128i *)to + 58, tmp);
-					_mm_storeu_si128((__m128i *)to + 59, tmp);
-					_mm_storeu_si128((__m128i *)to + 60, tmp);
-					_mm_storeu_si128((__m128i *)to + 61, tmp);
-					_mm_storeu_si128((__m128i *)to + 62, tmp);
-					_mm_storeu_si128((__m128i *)to + 63, tmp);
-					to += 256;
-				case 0x06:
-					tmp = _mm_loadu_si128((__m128i *)static_mask_1);
-					_mm_storeu_si128((__m128i *)to, tmp);
-					_mm_storeu_si128((__m128i *)to + 1, tmp);
-					_mm_storeu_si128((__m128i *)to + 2, tmp);
-					_mm_storeu_si128((__m128i *)to + 3, tmp);
-					_mm_storeu_si128((__m128i *)to + 4, tmp);
-					_mm_storeu_si128((__m128i *)to + 5, tmp);
-					_mm_storeu_si128((__m128i *)to + 6, tmp);
-					_mm_storeu_si128((__m128i *)to + 7, tmp);
-					_mm_storeu_si128((__m128i *)to + 8, tmp);
-					_mm_storeu_si128((__m128i *)to + 9, tmp);
-					_mm_storeu_si128((__m128i *)to + 10, tmp);
-					_mm_storeu_si128((__m128i *)to + 11, tmp);
-					_mm_storeu_si128((__m128i *)to + 12, tmp);
-					_mm_storeu_si128((__m128i *)to + 13, tmp);
-					_mm_storeu_si128((__m128i *)to + 14, tmp);
-					_mm_storeu_si128((__m128i *)to + 15, tmp);
-					_mm_storeu_si128((__m128i *)to + 16, tmp);
-					_mm_storeu_si128((__m128i *)to + 17, tmp);
-					_mm_storeu_si128((__m128i *)to + 18, tmp);
-					_mm_storeu_si128((__m128i *)to + 19, tmp);
-					_mm_storeu_si128((__m128i *)to + 20, tmp);
-					_mm_storeu_si128((__m128i *)to + 21, tmp);
-					_mm_storeu_si128((__m128i *)to + 22, tmp);
-					_mm_storeu_si128((__m128i *)to + 23, tmp);
-					_mm_storeu_si128((__m128i *)to + 24, tmp);
-					_mm_storeu_si128((__m128i *)to + 25, tmp);
-					_mm_storeu_si128((__m128i *)to + 26, tmp);
-					_mm_storeu_si128((__m128i *)to + 27, tmp);
-					_mm_storeu_si128((__m128i *)to + 28, tmp);
-					_mm_storeu_si128((__m128i *)to + 29, tmp);
-					_mm_storeu_si128((__m128i *)to + 30, tmp);
-					_mm_storeu_si128((__m128i *)to + 31, tmp);
-					_mm_storeu_si128((__m128i *)to + 32, tmp);
-					_mm_storeu_si128((__m128i *)to + 33, tmp);
-					_mm_storeu_si128((__m128i *)to + 34, tmp);
-					_mm_storeu_si128((__m128i *)to + 35, tmp);
-					_mm_storeu_si128((__m128i *)to + 36, tmp);
-					_mm_storeu_si128((__m128i *)to + 37, tmp);
-					_mm_storeu_si128((__m128i *)to + 38, tmp);
-					_mm_storeu_si128((__m128i *)to + 39, tmp);
-					_mm_storeu_si128((__m128i *)to + 40, tmp);
-					_mm_storeu_si128((__m128i *)to + 41, tmp);
-					_mm_storeu_si128((__m128i *)to + 42, tmp);
-					_mm_storeu_si128((__m128i *)to + 43, tmp);
-					_mm_storeu_si128((__m128i *)to + 44, tmp);
-					_mm_storeu_si128((__m128i *)to + 45, tmp);
-					_mm_storeu_si128((__m128i *)to + 46, tmp);
-					_mm_storeu_si128((__m128i *)to + 47, tmp);
-					_mm_storeu_si128((__m128i *)to + 48, tmp);
-					_mm_storeu_si128((__m128i *)to + 49, tmp);
-					_mm_storeu_si128((__m128i *)to + 50, tmp);
-					_mm_storeu_si128((__m128i *)to + 51, tmp);
-					_mm_storeu_si128((__m128i *)to + 52, tmp);
-					_mm_storeu_si128((__m128i *)to + 53, tmp);
-					_mm_storeu_si128((__m128i *)to + 54, tmp);
-					_mm_storeu_si128((__m128i *)to + 55, tmp);
-					_mm_storeu_si128((__m128i *)to + 56, tmp);
-					_mm_storeu_si128((__m128i *)to + 57, tmp);
-					_mm_storeu_si128((__m128i *)to + 58, tmp);
-					_mm_storeu_si128((__m128i *)to + 59, tmp);
-					_mm_storeu_si128((__m128i *)to + 60, tmp);
-					_mm_storeu_si128((__m128i *)to + 61, tmp);
-					_mm_storeu_si128((__m128i *)to + 62, tmp);
-					_mm_storeu_si128((__m128i *)to + 63, tmp);
-					to += 256;
-				case 0x07:
-					tmp = _mm_loadu_si128((__m128i *)static_mask_1);
-					_mm_storeu_si128((__m128i *)to, tmp);
-					_mm_storeu_si128((__m128i *)to + 1, tmp);
-					_mm_storeu_si128((__m128i *)to + 2, tmp);
-					_mm_storeu_si128((__m128i *)to + 3, tmp);
-					_mm_storeu_si128((__m128i *)to + 4, tmp);
-					_mm_storeu_si128((__m128i *)to + 5, tmp);
-					_mm_storeu_si128((__m128i *)to + 6, tmp);
-					_mm_storeu_si128((__m128i *)to + 7, tmp);
-					_mm_storeu_si128((__m128i *)to + 8, tmp);
-					_mm_storeu_si128((__m128i *)to + 9, tmp);
-					_mm_storeu_si128((__m128i *)to + 10, tmp);
-					_mm_storeu_si128((__m128i *)to + 11, tmp);
-					_mm_storeu_si128((__m128i *)to + 12, tmp);
-					_mm_storeu_si128((__m128i *)to + 13, tmp);
-					_mm_storeu_si128((__m128i *)to + 14, tmp);
-					_mm_storeu_si128((__m128i *)to + 15, tmp);
-					_mm_storeu_si128((__m128i *)to + 16, tmp);
-					_mm_storeu_si128((__m128i *)to + 17, tmp);
-					_mm_storeu_si128((__m128i *)to + 18, tmp);
-					_mm_storeu_si128((__m128i *)to + 19, tmp);
-					_mm_storeu_si128((__m128i *)to + 20, tmp);
-					_mm_storeu_si128((__m128i *)to + 21, tmp);
-					_mm_storeu_si128((__m128i *)to + 22, tmp);
-					_mm_storeu_si128((__m128i *)to + 23, tmp);
-					_mm_storeu_si128((__m128i *)to + 24, tmp);
-					_mm_storeu_si128((__m128i *)to + 25, tmp);
-					_mm_storeu_si128((__m128i *)to + 26, tmp);
-					_mm_storeu_si128((__m128i *)to + 27, tmp);
-					_mm_storeu_si128((__m128i *)to + 28, tmp);
-					_mm_storeu_si128((__m128i *)to + 29, tmp);
-					_mm_storeu_si128((__m128i *)to + 30, tmp);
-					_mm_storeu_si128((__m128i *)to + 31, tmp);
-					_mm_storeu_si128((__m128i *)to + 32, tmp);
-					_mm_storeu_si128((__m128i *)to + 33, tmp);
-					_mm_storeu_si128((__m128i *)to + 34, tmp);
-					_mm_storeu_si128((__m128i *)to + 35, tmp);
-					_mm_storeu_si128((__m128i *)to + 36, tmp);
-					_mm_storeu_si128((__m128i *)to + 37, tmp);
-					_mm_storeu_si128((__m128i *)to + 38, tmp);
-					_mm_storeu_si128((__m128i *)to + 39, tmp);
-					_mm_storeu_si128((__m128i *)to + 40, tmp);
-					_mm_storeu_si128((__m128i *)to + 41, tmp);
-					_mm_storeu_si128((__m128i *)to + 42, tmp);
-					_mm_storeu_si128((__m128i *)to + 43, tmp);
-					_mm_storeu_si128((__m128i *)to + 44, tmp);
-					_mm_storeu_si128((__m128i *)to + 45, tmp);
-					_mm_storeu_si128((__m128i *)to + 46, tmp);
-					_mm_storeu_si128((__m128i *)to + 47, tmp);
-					_mm_storeu_si128((__m128i *)to + 48, tmp);
-					_mm_storeu_si128((__m128i *)to + 49, tmp);
-					_mm_storeu_si128((__m128i *)to + 50, tmp);
-					_mm_storeu_si128((__m128i *)to + 51, tmp);
-					_mm_storeu_si128((__m128i *)to + 52, tmp);
-					_mm_storeu_si128((__m128i *)to + 53, tmp);
-					_mm_storeu_si128((__m128i *)to + 54, tmp);
-					_mm_storeu_si128((__m128i *)to + 55, tmp);
-					_mm_storeu_si128((__m128i *)to + 56, tmp);
-					_mm_storeu_si128((__m128i *)to + 57, tmp);
-					_mm_storeu_si128((__m128i *)to + 58, tmp);
-					_mm_storeu_si128((__m128i *)to + 59, tmp);
-					_mm_storeu_si128((__m128i *)to + 60, tmp);
-					_mm_storeu_si128((__m128i *)to + 61, tmp);
-					_mm_storeu_si128((__m128i *)to + 62, tmp);
-					_mm_storeu_si128((__m128i *)to + 63, tmp);
-					to += 256;
-				case 0x08:
-					tmp = _mm_loadu_si128((__m128i *)static_mask_1);
-					_mm_storeu_si128((__m128i *)to, tmp);
-					_mm_storeu_si128((__m128i *)to + 1, tmp);
-					_mm_storeu_si128((__m128i *)to + 2, tmp);
-					_mm_storeu_si128((__m128i *)to + 3, tmp);
-					_mm_storeu_si128((__m128i *)to + 4, tmp);
-					_mm_storeu_si128((__m128i *)to + 5, tmp);
-					_mm_storeu_si128((__m128i *)to + 6, tmp);
-					_mm_storeu_si128((__m128i *)to + 7, tmp);
-					_mm_storeu_si128((__m128i *)to + 8, tmp);
-					_mm_storeu_si128((__m128i *)to + 9, tmp);
-					_mm_storeu_si128((__m128i *)to + 10, tmp);
-					_mm_storeu_si128((__m128i *)to + 11, tmp);
-					_mm_storeu_si128((__m128i *)to + 12, tmp);
-					_mm_storeu_si128((__m128i *)to + 13, tmp);
-					_mm_storeu_si128((__m128i *)to + 14, tmp);
-					_mm_storeu_si128((__m128i *)to + 15, tmp);
-					_mm_storeu_si128((__m128i *)to + 16, tmp);
-					_mm_storeu_si128((__m128i *)to + 17, tmp);
-					_mm_storeu_si128((__m128i *)to + 18, tmp);
-					_mm_storeu_si128((__m128i *)to + 19, tmp);
-					_mm_storeu_si128((__m128i *)to + 20, tmp);
-					_mm_storeu_si128((__m128i *)to + 21, tmp);
-					_mm_storeu_si128((__m128i *)to + 22, tmp);
-					_mm_storeu_si128((__m128i *)to + 23, tmp);
-					_mm_storeu_si128((__m128i *)to + 24, tmp);
-					_mm_storeu_si128((__m128i *)to + 25, tmp);
-					_mm_storeu_si128((__m128i *)to + 26, tmp);
-					_mm_storeu_si128((__m128i *)to + 27, tmp);
-					_mm_storeu_si128((__m128i *)to + 28, tmp);
-					_mm_storeu_si128((__m128i *)to + 29, tmp);
-					_mm_storeu_si128((__m128i *)to + 30, tmp);
-					_mm_storeu_si128((__m128i *)to + 31, tmp);
-					_mm_storeu_si128((__m128i *)to + 32, tmp);
-					_mm_storeu_si128((__m128i *)to + 33, tmp);
-					_mm_storeu_si128((__m128i *)to + 34, tmp);
-					_mm_storeu_si128((__m128i *)to + 35, tmp);
-					_mm_storeu_si128((__m128i *)to + 36, tmp);
-					_mm_storeu_si128((__m128i *)to + 37, tmp);
-					_mm_storeu_si128((__m128i *)to + 38, tmp);
-					_mm_storeu_si128((__m128i *)to + 39, tmp);
-					_mm_storeu_si128((__m128i *)to + 40, tmp);
-					_mm_storeu_si128((__m128i *)to + 41, tmp);
-					_mm_storeu_si128((__m128i *)to + 42, tmp);
-					_mm_storeu_si128((__m128i *)to + 43, tmp);
-					_mm_storeu_si128((__m128i *)to + 44, tmp);
-					_mm_storeu_si128((__m128i *)to + 45, tmp);
-					_mm_storeu_si128((__m128i *)to + 46, tmp);
-					_mm_storeu_si128((__m128i *)to + 47, tmp);
-					_mm_storeu_si128((__m128i *)to + 48, tmp);
-					_mm_storeu_si128((__m128i *)to + 49, tmp);
-					_mm_storeu_si128((__m128i *)to + 50, tmp);
-					_mm_storeu_si128((__m128i *)to + 51, tmp);
-					_mm_storeu_si128((__m128i *)to + 52, tmp);
-					_mm_storeu_si128((__m128i *)to + 53, tmp);
-					_mm_storeu_si128((__m128i *)to + 54, tmp);
-					_mm_storeu_si128((__m128i *)to + 55, tmp);
-					_mm_storeu_si128((__m128i *)to + 56, tmp);
-					_mm_storeu_si128((__m128i *)to + 57, tmp);
-					_mm_storeu_si128((__m128i *)to + 58, tmp);
-					_mm_storeu_si128((__m128i *)to + 59, tmp);
-					_mm_storeu_si128((__m128i *)to + 60, tmp);
-					_mm_storeu_si128((__m128i *)to + 61, tmp);
-					_mm_storeu_si128((__m128i *)to + 62, tmp);
-					_mm_storeu_si128((__m128i *)to + 63, tmp);
-					to += 256;
-				case 0x09:
-					tmp = _mm_loadu_si128((__m128i *)static_mask_1);
-					_mm_storeu_si128((__m128i *)to, tmp);
-					_mm_storeu_si128((__m128i *)to + 1, tmp);
-					_mm_storeu_si128((__m128i *)to + 2, tmp);
-					_mm_storeu_si128((__m128i *)to + 3, tmp);
-					_mm_storeu_si128((__m128i *)to + 4, tmp);
-					_mm_storeu_si128((__m128i *)to + 5, tmp);
-					_mm_storeu_si128((__m128i *)to + 6, tmp);
-					_mm_storeu_si128((__m128i *)to + 7, tmp);
-					_mm_storeu_si128((__m128i *)to + 8, tmp);
-					_mm_storeu_si128((__m128i *)to + 9, tmp);
-					_mm_storeu_si128((__m128i *)to + 10, tmp);
-					_mm_storeu_si128((__m128i *)to + 11, tmp);
-					_mm_storeu_si128((__m128i *)to + 12, tmp);
-					_mm_storeu_si128((__m128i *)to + 13, tmp);
-					_mm_storeu_si128((__m128i *)to + 14, tmp);
-					_mm_storeu_si128((__m128i *)to + 15, tmp);
-					_mm_storeu_si128((__m128i *)to + 16, tmp);
-					_mm_storeu_si128((__m128i *)to + 17, tmp);
-					_mm_storeu_si128((__m128i *)to + 18, tmp);
-					_mm_storeu_si128((__m128i *)to + 19, tmp);
-					_mm_storeu_si128((__m128i *)to + 20, tmp);
-					_mm_storeu_si128((__m128i *)to + 21, tmp);
-					_mm_storeu_si128((__m128i *)to + 22, tmp);
-					_mm_storeu_si128((__m128i *)to + 23, tmp);
-					_mm_storeu_si128((__m128i *)to + 24, tmp);
-					_mm_storeu_si128((__m128i *)to + 25, tmp);
-					_mm_storeu_si128((__m128i *)to + 26, tmp);
-					_mm_storeu_si128((__m128i *)to + 27, tmp);
-					_mm_storeu_si128((__m128i *)to + 28, tmp);
-					_mm_storeu_si128((__m128i *)to + 29, tmp);
-					_mm_storeu_si128((__m128i *)to + 30, tmp);
-					_mm_storeu_si128((__m128i *)to + 31, tmp);
-					_mm_storeu_si128((__m128i *)to + 32, tmp);
-					_mm_storeu_si128((__m128i *)to + 33, tmp);
-					_mm_storeu_si128((__m128i *)to + 34, tmp);
-					_mm_storeu_si128((__m128i *)to + 35, tmp);
-					_mm_storeu_si128((__m128i *)to + 36, tmp);
-					_mm_storeu_si128((__m128i *)to + 37, tmp);
-					_mm_storeu_si128((__m128i *)to + 38, tmp);
-					_mm_storeu_si128((__m128i *)to + 39, tmp);
-					_mm_storeu_si128((__m128i *)to + 40, tmp);
-					_mm_storeu_si128((__m128i *)to + 41, tmp);
-					_mm_storeu_si128((__m128i *)to + 42, tmp);
-					_mm_storeu_si128((__m128i *)to + 43, tmp);
-					_mm_storeu_si128((__m128i *)to + 44, tmp);
-					_mm_storeu_si128((__m128i *)to + 45, tmp);
-					_mm_storeu_si128((__m128i *)to + 46, tmp);
-					_mm_storeu_si128((__m128i *)to + 47, tmp);
-					_mm_storeu_si128((__m128i *)to + 48, tmp);
-					_mm_storeu_si128((__m128i *)to + 49, tmp);
-					_mm_storeu_si128((__m128i *)to + 50, tmp);
-					_mm_storeu_si128((__m128i *)to + 51, tmp);
-					_mm_storeu_si128((__m128i *)to + 52, tmp);
-					_mm_storeu_si128((__m128i *)to + 53, tmp);
-					_mm_storeu_si128((__m128i *)to + 54, tmp);
-					_mm_storeu_si128((__m128i *)to + 55, tmp);
-					_mm_storeu_si128((__m128i *)to + 56, tmp);
-					_mm_storeu_si128((__m128i *)to + 57, tmp);
-					_mm_storeu_si128((__m128i *)to + 58, tmp);
-					_mm_storeu_si128((__m128i *)to + 59, tmp);
-					_mm_storeu_si128((__m128i *)to + 60, tmp);
-					_mm_storeu_si128((__m128i *)to + 61, tmp);
-					_mm_storeu_si128((__m128i *)to + 62, tmp);
-					_mm_storeu_si128((__m128i *)to + 63, tmp);
-					to += 256;
-				case 0x0a:
-					tmp = _mm_loadu_si128((__m128i *)static_mask_1);
-					_mm_storeu_si128((__m128i *)to, tmp);
-					_mm_storeu_si128((__m128i *)to + 1, tmp);
-					_mm_storeu_si128((__m128i *)to + 2, tmp);
-					_mm_storeu_si128((__m128i *)to + 3, tmp);
-					_mm_storeu_si128((__m128i *)to + 4, tmp);
-					_mm_storeu_si128((__m128i *)to + 5, tmp);
-					_mm_storeu_si128((__m128i *)to + 6, tmp);
-					_mm_storeu_si128((__m128i *)to + 7, tmp);
-					_mm_storeu_si128((__m128i *)to + 8, tmp);
-					_mm_storeu_si128((__m128i *)to + 9, tmp);
-					_mm_storeu_si128((__m128i *)to + 10, tmp);
-					_mm_storeu_si128((__m128i *)to + 11, tmp);
-					_mm_storeu_si128((__m128i *)to + 12, tmp);
-					_mm_storeu_si128((__m128i *)to + 13, tmp);
-					_mm_storeu_si128((__m128i *)to + 14, tmp);
-					_mm_storeu_si128((__m128i *)to + 15, tmp);
-					_mm_storeu_si128((__m128i *)to + 16, tmp);
-					_mm_storeu_si128((__m128i *)to + 17, tmp);
-					_mm_storeu_si128((__m128i *)to + 18, tmp);
-					_mm_storeu_si128((__m128i *)to + 19, tmp);
-					_mm_storeu_si128((__m128i *)to + 20, tmp);
-					_mm_storeu_si128((__m128i *)to + 21, tmp);
-					_mm_storeu_si128((__m128i *)to + 22, tmp);
-					_mm_storeu_si128((__m128i *)to + 23, tmp);
-					_mm_storeu_si128((__m128i *)to + 24, tmp);
-					_mm_storeu_si128((__m128i *)to + 25, tmp);
-					_mm_storeu_si128((__m128i *)to + 26, tmp);
-					_mm_storeu_si128((__m128i *)to + 27, tmp);
-					_mm_storeu_si128((__m128i *)to + 28, tmp);
-					_mm_storeu_si128((__m128i *)to + 29, tmp);
-					_mm_storeu_si128((__m128i *)to + 30, tmp);
-					_mm_storeu_si128((__m128i *)to + 31, tmp);
-					_mm_storeu_si128((__m128i *)to + 32, tmp);
-					_mm_storeu_si128((__m128i *)to + 33, tmp);
-					_mm_storeu_si128((__m128i *)to + 34, tmp);
-					_mm_storeu_si128((__m128i *)to + 35, tmp);
-					_mm_storeu_si128((__m128i *)to + 36, tmp);
-					_mm_storeu_si128((__m128i *)to + 37, tmp);
-					_mm_storeu_si128((__m128i *)to + 38, tmp);
-					_mm_storeu_si128((__m128i *)to + 39, tmp);
-					_mm_storeu_si128((__m128i *)to + 40, tmp);
-					_mm_storeu_si128((__m128i *)to + 41, tmp);
-					_mm_storeu_si128((__m128i *)to + 42, tmp);
-					_mm_storeu_si128((__m128i *)to + 43, tmp);
-					_mm_storeu_si128((__m128i *)to + 44, tmp);
-					_mm_storeu_si128((__m128i *)to + 45, tmp);
-					_mm_storeu_si128((__m128i *)to + 46, tmp);
-					_mm_storeu_si128((__m128i *)to + 47, tmp);
-					_mm_storeu_si128((__m128i *)to + 48, tmp);
-					_mm_storeu_si128((__m128i *)to + 49, tmp);
-					_mm_storeu_si128((__m128i *)to + 50, tmp);
-					_mm_storeu_si128((__m128i *)to + 51, tmp);
-					_mm_storeu_si128((__m128i *)to + 52, tmp);
-					_mm_storeu_si128((__m128i *)to + 53, tmp);
-					_mm_storeu_si128((__m128i *)to + 54, tmp);
-					_mm_storeu_si128((__m128i *)to + 55, tmp);
-					_mm_storeu_si128((__m128i *)to + 56, tmp);
-					_mm_storeu_si128((__m128i *)to + 57, tmp);
-					_mm_storeu_si128((__m128i *)to + 58, tmp);
-					_mm_storeu_si128((__m128i *)to + 59, tmp);
-					_mm_storeu_si128((__m128i *)to + 60, tmp);
-					_mm_storeu_si128((__m128i *)to + 61, tmp);
-					_mm_storeu_si128((__m128i *)to + 62, tmp);
-					_mm_storeu_si128((__m128i *)to + 63, tmp);
-					to += 256;
-				case 0x0b:
-					tmp = _mm_loadu_si128((__m128i *)static_mask_1);
-					_mm_storeu_si128((__m128i *)to, tmp);
-					_mm_storeu_si128((__m128i *)to + 1, tmp);
-					_mm_storeu_si128((__m128i *)to + 2, tmp);
-					_mm_storeu_si128((__m128i *)to + 3, tmp);
-					_mm_storeu_si128((__m128i *)to + 4, tmp);
-					_mm_storeu_si128((__m128i *)to + 5, tmp);
-					_mm_storeu_si128((__m128i *)to + 6, tmp);
-					_mm_storeu_si128((__m128i *)to + 7, tmp);
-					_mm_storeu_si128((__m128i *)to + 8, tmp);
-					_mm_storeu_si128((__m128i *)to + 9, tmp);
-					_mm_storeu_si128((__m128i *)to + 10, tmp);
-					_mm_storeu_si128((__m128i *)to + 11, tmp);
-					_mm_storeu_si128((__m128i *)to + 12, tmp);
-					_mm_storeu_si128((__m128i *)to + 13, tmp);
-					_mm_storeu_si128((__m128i *)to + 14, tmp);
-					_mm_storeu_si128((__m128i *)to + 15, tmp);
-					_mm_storeu_si128((__m128i *)to + 16, tmp);
-					_mm_storeu_si128((__m128i *)to + 17, tmp);
-					_mm_storeu_si128((__m128i *)to + 18, tmp);
-					_mm_storeu_si128((__m128i *)to + 19, tmp);
-					_mm_storeu_si128((__m128i *)to + 20, tmp);
-					_mm_storeu_si128((__m128i *)to + 21, tmp);
-					_mm_storeu_si128((__m128i *)to + 22, tmp);
-					_mm_storeu_si128((__m128i *)to + 23, tmp);
-					_mm_storeu_si128((__m128i *)to + 24, tmp);
-					_mm_storeu_si128((__m128i *)to + 25, tmp);
-					_mm_storeu_si128((__m128i *)to + 26, tmp);
-					_mm_storeu_si128((__m128i *)to + 27, tmp);
-					_mm_storeu_si128((__m128i *)to + 28, tmp);
-					_mm_storeu_si128((__m128i *)to + 29, tmp);
-					_mm_storeu_si128((__m128i *)to + 30, tmp);
-					_mm_storeu_si128((__m128i *)to + 31, tmp);
-					_mm_storeu_si128((__m128i *)to + 32, tmp);
-					_mm_storeu_si128((__m128i *)to + 33, tmp);
-					_mm_storeu_si128((__m128i *)to + 34, tmp);
-					_mm_storeu_si128((__m128i *)to + 35, tmp);
-					_mm_storeu_si128((__m128i *)to + 36, tmp);
-					_mm_storeu_si128((__m128i *)to + 37, tmp);
-					_mm_storeu_si128((__m128i *)to + 38, tmp);
-					_mm_storeu_si128((__m128i *)to + 39, tmp);
-					_mm_storeu_si128((__m128i *)to + 40, tmp);
-					_mm_storeu_si128((__m128i *)to + 41, tmp);
-					_mm_storeu_si128((__m128i *)to + 42, tmp);
-					_mm_storeu_si128((__m128i *)to + 43, tmp);
-					_mm_storeu_si128((__m128i *)to + 44, tmp);
-					_mm_storeu_si128((__m128i *)to + 45, tmp);
-					_mm_storeu_si128((__m128i *)to + 46, tmp);
-					_mm_storeu_si128((__m128i *)to + 47, tmp);
-					_mm_storeu_si128((__m128i *)to + 48, tmp);
-					_mm_storeu_si128((__m128i *)to + 49, tmp);
-					_mm_storeu_si128((__m128i *)to + 50, tmp);
-					_mm_storeu_si128((__m128i *)to + 51, tmp);
-					_mm_storeu_si128((__m128i *)to + 52, tmp);
-					_mm_storeu_si128((__m128i *)to + 53, tmp);
-					_mm_storeu_si128((__m128i *)to + 54, tmp);
-					_mm_storeu_si128((__m128i *)to + 55, tmp);
-					_mm_storeu_si128((__m128i *)to + 56, tmp);
-					_mm_storeu_si128((__m128i *)to + 57, tmp);
-					_mm_storeu_si128((__m128i *)to + 58, tmp);
-					_mm_storeu_si128((__m128i *)to + 59, tmp);
-					_mm_storeu_si128((__m128i *)to + 60, tmp);
-					_mm_storeu_si128((__m128i *)to + 61, tmp);
-					_mm_storeu_si128((__m128i *)to + 62, tmp);
-					_mm_storeu_si128((__m128i *)to + 63, tmp);
-					to += 256;
-				case 0x0c:
-					tmp = _mm_loadu_si128((__m128i *)static_mask_1);
-					_mm_storeu_si128((__m128i *)to, tmp);
-					_mm_storeu_si128((__m128i *)to + 1, tmp);
-					_mm_storeu_si128((__m128i *)to + 2, tmp);
-					_mm_storeu_si128((__m128i *)to + 3, tmp);
-					_mm_storeu_si128((__m128i *)to + 4, tmp);
-					_mm_storeu_si128((__m128i *)to + 5, tmp);
-					_mm_storeu_si128((__m128i *)to + 6, tmp);
-					_mm_storeu_si128((__m128i *)to + 7, tmp);
-					_mm_storeu_si128((__m128i *)to + 8, tmp);
-					_mm_storeu_si128((__m128i *)to + 9, tmp);
-					_mm_storeu_si128((__m128i *)to + 10, tmp);
-					_mm_storeu_si128((__m128i *)to + 11, tmp);
-					_mm_storeu_si128((__m128i *)to + 12, tmp);
-					_mm_storeu_si128((__m128i *)to + 13, tmp);
-					_mm_storeu_si128((__m128i *)to + 14, tmp);
-					_mm_storeu_si128((__m128i *)to + 15, tmp);
-					_mm_storeu_si128((__m128i *)to + 16, tmp);
-					_mm_storeu_si128((__m128i *)to + 17, tmp);
-					_mm_storeu_si128((__m128i *)to + 18, tmp);
-					_mm_storeu_si128((__m128i *)to + 19, tmp);
-					_mm_storeu_si128((__m128i *)to + 20, tmp);
-					_mm_storeu_si128((__m128i *)to + 21, tmp);
-					_mm_storeu_si128((__m128i *)to + 22, tmp);
-					_mm_storeu_si128((__m128i *)to + 23, tmp);
-					_mm_storeu_si128((__m128i *)to + 24, tmp);
-					_mm_storeu_si128((__m128i *)to + 25, tmp);
-					_mm_storeu_si128((__m128i *)to + 26, tmp);
-					_mm_storeu_si128((__m128i *)to + 27, tmp);
-					_mm_storeu_si128((__m128i *)to + 28, tmp);
-					_mm_storeu_si128((__m128i *)to + 29, tmp);
-					_mm_storeu_si128((__m128i *)to + 30, tmp);
-					_mm_storeu_si128((__m128i *)to + 31, tmp);
-					_mm_storeu_si128((__m128i *)to + 32, tmp);
-					_mm_storeu_si128((__m128i *)to + 33, tmp);
-					_mm_storeu_si128((__m128i *)to + 34, tmp);
-					_mm_storeu_si128((__m128i *)to + 35, tmp);
-					_mm_storeu_si128((__m128i *)to + 36, tmp);
-					_mm_storeu_si128((__m128i *)to + 37, tmp);
-					_mm_storeu_si128((__m128i *)to + 38, tmp);
-					_mm_storeu_si128((__m128i *)to + 39, tmp);
-					_mm_storeu_si128((__m128i *)to + 40, tmp);
-					_mm_storeu_si128((__m128i *)to + 41, tmp);
-					_mm_storeu_si128((__m128i *)to + 42, tmp);
-					_mm_storeu_si128((__m128i *)to + 43, tmp);
-					_mm_storeu_si128((__m128i *)to + 44, tmp);
-					_mm_storeu_si128((__m128i *)to + 45, tmp);
-					_mm_storeu_si128((__m128i *)to + 46, tmp);
-					_mm_storeu_si128((__m128i *)to + 47, tmp);
-					_mm_storeu_si128((__m128i *)to + 48, tmp);
-					_mm_storeu_si128((__m128i *)to + 49, tmp);
-					_mm_storeu_si128((__m128i *)to + 50, tmp);
-					_mm_storeu_si128((__m128i *)to + 51, tmp);
-					_mm_storeu_si128((__m128i *)to + 52, tmp);
-					_mm_storeu_si128((__m128i *)to + 53, tmp);
-					_mm_storeu_si128((__m128i *)to + 54, tmp);
-					_mm_storeu_si128((__m128i *)to + 55, tmp);
-					_mm_storeu_si128((__m128i *)to + 56, tmp);
-					_mm_storeu_si128((__m128i *)to + 57, tmp);
-					_mm_storeu_si128((__m128i *)to + 58, tmp);
-					_mm_storeu_si128((__m128i *)to + 59, tmp);
-					_mm_storeu_si128((__m128i *)to + 60, tmp);
-					_mm_storeu_si128((__m128i *)to + 61, tmp);
-					_mm_storeu_si128((__m128i *)to + 62, tmp);
-					_mm_storeu_si128((__m128i *)to + 63, tmp);
-					to += 256;
-				case 0x0d:
-					tmp = _mm_loadu_si128((__m128i *)static_mask_1);
-					_mm_storeu_si128((__m128i *)to, tmp);
-					_mm_storeu_si128((__m128i *)to + 1, tmp);
-					_mm_storeu_si128((__m128i *)to + 2, tmp);
-					_mm_storeu_si128((__m128i *)to + 3, tmp);
-					_mm_storeu_si128((__m128i *)to + 4, tmp);
-					_mm_storeu_si128((__m128i *)to + 5, tmp);
-					_mm_storeu_si128((__m128i *)to + 6, tmp);
-					_mm_storeu_si128((__m128i *)to + 7, tmp);
-					_mm_storeu_si128((__m128i *)to + 8, tmp);
-					_mm_storeu_si128((__m128i *)to + 9, tmp);
-					_mm_storeu_si128((__m128i *)to + 10, tmp);
-					_mm_storeu_si128((__m128i *)to + 11, tmp);
-					_mm_storeu_si128((__m128i *)to + 12, tmp);
-					_mm_storeu_si128((__m128i *)to + 13, tmp);
-					_mm_storeu_si128((__m128i *)to + 14, tmp);
-					_mm_storeu_si128((__m128i *)to + 15, tmp);
-					_mm_storeu_si128((__m128i *)to + 16, tmp);
-					_mm_storeu_si128((__m128i *)to + 17, tmp);
-					_mm_storeu_si128((__m128i *)to + 18, tmp);
-					_mm_storeu_si128((__m128i *)to + 19, tmp);
-					_mm_storeu_si128((__m128i *)to + 20, tmp);
-					_mm_storeu_si128((__m128i *)to + 21, tmp);
-					_mm_storeu_si128((__m128i *)to + 22, tmp);
-					_mm_storeu_si128((__m128i *)to + 23, tmp);
-					_mm_storeu_si128((__m128i *)to + 24, tmp);
-					_mm_storeu_si128((__m128i *)to + 25, tmp);
-					_mm_storeu_si128((__m128i *)to + 26, tmp);
-					_mm_storeu_si128((__m128i *)to + 27, tmp);
-					_mm_storeu_si128((__m128i *)to + 28, tmp);
-					_mm_storeu_si128((__m128i *)to + 29, tmp);
-					_mm_storeu_si128((__m128i *)to + 30, tmp);
-					_mm_storeu_si128((__m128i *)to + 31, tmp);
-					_mm_storeu_si128((__m128i *)to + 32, tmp);
-					_mm_storeu_si128((__m128i *)to + 33, tmp);
-					_mm_storeu_si128((__m128i *)to + 34, tmp);
-					_mm_storeu_si128((__m128i *)to + 35, tmp);
-					_mm_storeu_si128((__m128i *)to + 36, tmp);
-					_mm_storeu_si128((__m128i *)to + 37, tmp);
-					_mm_storeu_si128((__m128i *)to + 38, tmp);
-					_mm_storeu_si128((__m128i *)to + 39, tmp);
-					_mm_storeu_si128((__m128i *)to + 40, tmp);
-					_mm_storeu_si128((__m128i *)to + 41, tmp);
-					_mm_storeu_si128((__m128i *)to + 42, tmp);
-					_mm_storeu_si128((__m128i *)to + 43, tmp);
-					_mm_storeu_si128((__m128i *)to + 44, tmp);
-					_mm_storeu_si128((__m128i *)to + 45, tmp);
-					_mm_storeu_si128((__m128i *)to + 46, tmp);
-					_mm_storeu_si128((__m128i *)to + 47, tmp);
-					_mm_storeu_si128((__m128i *)to + 48, tmp);
-					_mm_storeu_si128((__m128i *)to + 49, tmp);
-					_mm_storeu_si128((__m128i *)to + 50, tmp);
-					_mm_storeu_si128((__m128i *)to + 51, tmp);
-					_mm_storeu_si128((__m128i *)to + 52, tmp);
-					_mm_storeu_si128((__m128i *)to + 53, tmp);
-					_mm_storeu_si128((__m128i *)to + 54, tmp);
-					_mm_storeu_si128((__m128i *)to + 55, tmp);
-					_mm_storeu_si128((__m128i *)to + 56, tmp);
-					_mm_storeu_si128((__m128i *)to + 57, tmp);
-					_mm_storeu_si128((__m128i *)to + 58, tmp);
-					_mm_storeu_si128((__m128i *)to + 59, tmp);
-					_mm_storeu_si128((__m128i *)to + 60, tmp);
-					_mm_storeu_si128((__m128i *)to + 61, tmp);
-					_mm_storeu_si128((__m128i *)to + 62, tmp);
-					_mm_storeu_si128((__m128i *)to + 63, tmp);
-					to += 256;
-				case 0x0e:
-					tmp = _mm_loadu_si128((__m128i *)static_mask_1);
-					_mm_storeu_si128((__m128i *)to, tmp);
-					_mm_storeu_si128((__m128i *)to + 1, tmp);
-					_mm_storeu_si128((__m128i *)to + 2, tmp);
-					_mm_storeu_si128((__m128i *)to + 3, tmp);
-					_mm_storeu_si128((__m128i *)to + 4, tmp);
-					_mm_storeu_si128((__m128i *)to + 5, tmp);
-					_mm_storeu_si128((__m128i *)to + 6, tmp);
-					_mm_storeu_si128((__m128i *)to + 7, tmp);
-					_mm_storeu_si128((__m128i *)to + 8, tmp);
-					_mm_storeu_si128((__m128i *)to + 9, tmp);
-					_mm_storeu_si128((__m128i *)to + 10, tmp);
-					_mm_storeu_si128((__m128i *)to + 11, tmp);
-					_mm_storeu_si128((__m128i *)to + 12, tmp);
-					_mm_storeu_si128((__m128i *)to + 13, tmp);
-					_mm_storeu_si128((__m128i *)to + 14, tmp);
-					_mm_storeu_si128((__m128i *)to + 15, tmp);
-					_mm_storeu_si128((__m128i *)to + 16, tmp);
-					_mm_storeu_si128((__m128i *)to + 17, tmp);
-					_mm_storeu_si128((__m128i *)to + 18, tmp);
-					_mm_storeu_si128((__m128i *)to + 19, tmp);
-					_mm_storeu_si128((__m128i *)to + 20, tmp);
-					_mm_storeu_si128((__m128i *)to + 21, tmp);
-					_mm_storeu_si128((__m128i *)to + 22, tmp);
-					_mm_storeu_si128((__m128i *)to + 23, tmp);
-					_mm_storeu_si128((__m128i *)to + 24, tmp);
-					_mm_storeu_si128((__m128i *)to + 25, tmp);
-					_mm_storeu_si128((__m128i *)to + 26, tmp);
-					_mm_storeu_si128((__m128i *)to + 27, tmp);
-					_mm_storeu_si128((__m128i *)to + 28, tmp);
-					_mm_storeu_si128((__m128i *)to + 29, tmp);
-					_mm_storeu_si128((__m128i *)to + 30, tmp);
-					_mm_storeu_si128((__m128i *)to + 31, tmp);
-					_mm_storeu_si128((__m128i *)to + 32, tmp);
-					_mm_storeu_si128((__m128i *)to + 33, tmp);
-					_mm_storeu_si128((__m128i *)to + 34, tmp);
-					_mm_storeu_si128((__m128i *)to + 35, tmp);
-					_mm_storeu_si128((__m128i *)to + 36, tmp);
-					_mm_storeu_si128((__m128i *)to + 37, tmp);
-					_mm_storeu_si128((__m128i *)to + 38, tmp);
-					_mm_storeu_si128((__m128i *)to + 39, tmp);
-					_mm_storeu_si128((__m128i *)to + 40, tmp);
-					_mm_storeu_si128((__m128i *)to + 41, tmp);
-					_mm_storeu_si128((__m128i *)to + 42, tmp);
-					_mm_storeu_si128((__m128i *)to + 43, tmp);
-					_mm_storeu_si128((__m128i *)to + 44, tmp);
-					_mm_storeu_si128((__m128i *)to + 45, tmp);
-					_mm_storeu_si128((__m128i *)to + 46, tmp);
-					_mm_storeu_si128((__m128i *)to + 47, tmp);
-					_mm_storeu_si128((__m128i *)to + 48, tmp);
-					_mm_storeu_si128((__m128i *)to + 49, tmp);
-					_mm_storeu_si128((__m128i *)to + 50, tmp);
-					_mm_storeu_si128((__m128i *)to + 51, tmp);
-					_mm_storeu_si128((__m128i *)to + 52, tmp);
-					_mm_storeu_si128((__m128i *)to + 53, tmp);
-					_mm_storeu_si128((__m128i *)to + 54, tmp);
-					_mm_storeu_si128((__m128i *)to + 55, tmp);
-					_mm_storeu_si128((__m128i *)to + 56, tmp);
-					_mm_storeu_si128((__m128i *)to + 57, tmp);
-					_mm_storeu_si128((__m128i *)to + 58, tmp);
-					_mm_storeu_si128((__m128i *)to + 59, tmp);
-					_mm_storeu_si128((__m128i *)to + 60, tmp);
-					_mm_storeu_si128((__m128i *)to + 61, tmp);
-					_mm_storeu_si128((__m128i *)to + 62, tmp);
-					_mm_storeu_si128((__m128i *)to + 63, tmp);
-					to += 256;
-				case 0x0f:
-					tmp = _mm_loadu_si128((__m128i *)static_mask_1);
-					_mm_storeu_si128((__m128i *)to, tmp);
-					_mm_storeu_si128((__m128i *)to + 1, tmp);
-					_mm_storeu_si128((__m128i *)to + 2, tmp);
-					_mm_storeu_si128((__m128i *)to + 3, tmp);
-					_mm_storeu_si128((__m128i *)to + 4, tmp);
-					_mm_storeu_si128((__m128i *)to + 5, tmp);
-					_mm_storeu_si128((__m128i *)to + 6, tmp);
-					_mm_storeu_si128((__m128i *)to + 7, tmp);
-					_mm_storeu_si128((__m128i *)to + 8, tmp);
-					_mm_storeu_si128((__m128i *)to + 9, tmp);
-					_mm_storeu_si128((__m128i *)to + 10, tmp);
-					_mm_storeu_si128((__m128i *)to + 11, tmp);
-					_mm_storeu_si128((__m128i *)to + 12, tmp);
-					_mm_storeu_si128((__m128i *)to + 13, tmp);
-					_mm_storeu_si128((__m128i *)to + 14, tmp);
-					_mm_storeu_si128((__m128i *)to + 15, tmp);
-					_mm_storeu_si128((__m128i *)to + 16, tmp);
-					_mm_storeu_si128((__m128i *)to + 17, tmp);
-					_mm_storeu_si128((__m128i *)to + 18, tmp);
-					_mm_storeu_si128((__m128i *)to + 19, tmp);
-					_mm_storeu_si128((__m128i *)to + 20, tmp);
-					_mm_storeu_si128((__m128i *)to + 21, tmp);
-					_mm_storeu_si128((__m128i *)to + 22, tmp);
-					_mm_storeu_si128((__m128i *)to + 23, tmp);
-					_mm_storeu_si128((__m128i *)to + 24, tmp);
-					_mm_storeu_si128((__m128i *)to + 25, tmp);
-					_mm_storeu_si128((__m128i *)to + 26, tmp);
-					_mm_storeu_si128((__m128i *)to + 27, tmp);
-					_mm_storeu_si128((__m128i *)to + 28, tmp);
-					_mm_storeu_si128((__m128i *)to + 29, tmp);
-					_mm_storeu_si128((__m128i *)to + 30, tmp);
-					_mm_storeu_si128((__m128i *)to + 31, tmp);
-					_mm_storeu_si128((__m128i *)to + 32, tmp);
-					_mm_storeu_si128((__m128i *)to + 33, tmp);
-					_mm_storeu_si128((__m128i *)to + 34, tmp);
-					_mm_storeu_si128((__m128i *)to + 35, tmp);
-					_mm_storeu_si128((__m128i *)to + 36, tmp);
-					_mm_storeu_si128((__m128i *)to + 37, tmp);
-					_mm_storeu_si128((__m128i *)to + 38, tmp);
-					_mm_storeu_si128((__m128i *)to + 39, tmp);
-					_mm_storeu_si128((__m128i *)to + 40, tmp);
-					_mm_storeu_si128((__m128i *)to + 41, tmp);
-					_mm_storeu_si128((__m128i *)to + 42, tmp);
-					_mm_storeu_si128((__m128i *)to + 43, tmp);
-					_mm_storeu_si128((__m128i *)to + 44, tmp);
-					_mm_storeu_si128((__m128i *)to + 45, tmp);
-					_mm_storeu_si128((__m128i *)to + 46, tmp);
-					_mm_storeu_si128((__m128i *)to + 47, tmp);
-					_mm_storeu_si128((__m128i *)to + 48, tmp);
-					_mm_storeu_si128((__m128i *)to + 49, tmp);
-					_mm_storeu_si128((__m128i *)to + 50, tmp);
-					_mm_storeu_si128((__m128i *)to + 51, tmp);
-					_mm_storeu_si128((__m128i *)to + 52, tmp);
-					_mm_storeu_si128((__m128i *)to + 53, tmp);
-					_mm_storeu_si128((__m128i *)to + 54, tmp);
-					_mm_storeu_si128((__m128i *)to + 55, tmp);
-					_mm_storeu_si128((__m128i *)to + 56, tmp);
-					_mm_storeu_si128((__m128i *)to + 57, tmp);
-					_mm_storeu_si128((__m128i *)to + 58, tmp);
-					_mm_storeu_si128((__m128i *)to + 59, tmp);
-					_mm_storeu_si128((__m128i *)to + 60, tmp);
-					_mm_storeu_si128((__m128i *)to + 61, tmp);
-					_mm_storeu_si128((__m128i *)to + 62, tmp);
-					_mm_storeu_si128((__m128i *)to + 63, tmp);
-					to += 256;
-					break;
-				case 0x10:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 9, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 10, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 11, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 12, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 13, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 14, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 15, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 16, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 17, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 18, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 19, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 20, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 21, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 22, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 23, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 24, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 25, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 26, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 27, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 28, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 29, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 30, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 31, _mm_and_si128(byte_stream, mask_1));
-					in += 16;
-					to += 128;
-				case 0x11:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 9, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 10, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 11, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 12, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 13, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 14, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 15, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 16, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 17, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 18, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 19, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 20, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 21, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 22, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 23, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 24, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 25, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 26, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 27, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 28, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 29, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 30, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 31, _mm_and_si128(byte_stream, mask_1));
-					in += 16;
-					to += 128;
-				case 0x12:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 9, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 10, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 11, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 12, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 13, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 14, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 15, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 16, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 17, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 18, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 19, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 20, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 21, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 22, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 23, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 24, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 25, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 26, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 27, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 28, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 29, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 30, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 31, _mm_and_si128(byte_stream, mask_1));
-					in += 16;
-					to += 128;
-				case 0x13:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 9, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 10, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 11, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 12, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 13, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 14, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 15, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 16, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 17, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 18, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 19, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 20, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 21, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 22, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 23, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 24, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 25, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 26, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 27, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 28, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 29, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 30, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 31, _mm_and_si128(byte_stream, mask_1));
-					in += 16;
-					to += 128;
-				case 0x14:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 9, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 10, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 11, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 12, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 13, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 14, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 15, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 16, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 17, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 18, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 19, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 20, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 21, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 22, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 23, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 24, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 25, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 26, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 27, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 28, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 29, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 30, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 31, _mm_and_si128(byte_stream, mask_1));
-					in += 16;
-					to += 128;
-				case 0x15:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 9, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 10, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 11, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 12, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 13, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 14, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 15, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 16, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 17, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 18, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 19, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 20, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 21, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 22, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 23, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 24, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 25, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 26, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 27, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 28, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 29, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 30, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 31, _mm_and_si128(byte_stream, mask_1));
-					in += 16;
-					to += 128;
-				case 0x16:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 9, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 10, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 11, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 12, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 13, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 14, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 15, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 16, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 17, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 18, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 19, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 20, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 21, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 22, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 23, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 24, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 25, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 26, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 27, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 28, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 29, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 30, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 31, _mm_and_si128(byte_stream, mask_1));
-					in += 16;
-					to += 128;
-				case 0x17:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 9, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 10, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 11, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 12, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 13, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 14, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 15, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 16, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 17, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 18, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 19, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 20, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 21, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 22, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 23, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 24, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 25, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 26, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 27, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 28, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 29, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 30, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 31, _mm_and_si128(byte_stream, mask_1));
-					in += 16;
-					to += 128;
-				case 0x18:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 9, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 10, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 11, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 12, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 13, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 14, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 15, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 16, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 17, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 18, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 19, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 20, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 21, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 22, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 23, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 24, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 25, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 26, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 27, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 28, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 29, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 30, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 31, _mm_and_si128(byte_stream, mask_1));
-					in += 16;
-					to += 128;
-				case 0x19:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 9, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 10, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 11, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 12, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 13, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 14, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 15, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 16, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 17, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 18, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 19, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 20, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 21, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 22, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 23, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 24, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 25, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 26, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 27, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 28, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 29, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 30, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 31, _mm_and_si128(byte_stream, mask_1));
-					in += 16;
-					to += 128;
-				case 0x1a:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 9, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 10, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 11, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 12, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 13, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 14, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 15, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 16, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 17, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 18, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 19, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 20, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 21, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 22, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 23, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 24, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 25, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 26, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 27, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 28, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 29, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 30, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 31, _mm_and_si128(byte_stream, mask_1));
-					in += 16;
-					to += 128;
-				case 0x1b:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 9, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 10, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 11, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 12, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 13, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 14, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 15, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 16, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 17, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 18, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 19, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 20, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 21, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 22, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 23, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 24, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 25, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 26, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 27, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 28, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 29, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 30, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 31, _mm_and_si128(byte_stream, mask_1));
-					in += 16;
-					to += 128;
-				case 0x1c:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 9, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 10, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 11, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 12, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 13, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 14, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 15, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 16, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 17, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 18, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 19, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 20, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 21, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 22, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 23, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 24, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 25, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 26, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 27, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 28, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 29, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 30, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 31, _mm_and_si128(byte_stream, mask_1));
-					in += 16;
-					to += 128;
-				case 0x1d:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 9, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 10, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 11, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 12, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 13, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 14, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 15, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 16, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 17, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 18, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 19, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 20, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 21, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 22, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 23, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 24, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 25, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 26, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 27, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 28, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 29, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 30, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 31, _mm_and_si128(byte_stream, mask_1));
-					in += 16;
-					to += 128;
-				case 0x1e:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 9, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 10, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 11, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 12, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 13, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 14, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 15, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 16, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 17, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 18, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 19, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 20, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 21, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 22, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 23, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 24, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 25, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 26, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 27, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 28, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 29, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 30, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 31, _mm_and_si128(byte_stream, mask_1));
-					in += 16;
-					to += 128;
-				case 0x1f:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 9, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 10, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 11, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 12, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 13, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 14, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 15, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 16, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 17, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 18, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 19, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 20, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 21, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 22, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 23, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 24, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 25, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 26, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 27, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 28, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 29, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 30, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 31, _mm_and_si128(byte_stream, mask_1));
-					in += 16;
-					to += 128;
-					break;
-				case 0x20:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 9, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 10, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 11, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 12, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 13, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 14, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 15, _mm_and_si128(byte_stream, mask_2));
-					in += 16;
-					to += 64;
-				case 0x21:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 9, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 10, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 11, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 12, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 13, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 14, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 15, _mm_and_si128(byte_stream, mask_2));
-					in += 16;
-					to += 64;
-				case 0x22:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 9, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 10, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 11, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 12, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 13, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 14, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 15, _mm_and_si128(byte_stream, mask_2));
-					in += 16;
-					to += 64;
-				case 0x23:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 9, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 10, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 11, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 12, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 13, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 14, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 15, _mm_and_si128(byte_stream, mask_2));
-					in += 16;
-					to += 64;
-				case 0x24:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 9, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 10, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 11, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 12, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 13, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 14, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 15, _mm_and_si128(byte_stream, mask_2));
-					in += 16;
-					to += 64;
-				case 0x25:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 9, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 10, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 11, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 12, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 13, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 14, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 15, _mm_and_si128(byte_stream, mask_2));
-					in += 16;
-					to += 64;
-				case 0x26:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 9, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 10, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 11, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 12, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 13, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 14, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 15, _mm_and_si128(byte_stream, mask_2));
-					in += 16;
-					to += 64;
-				case 0x27:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 9, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 10, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 11, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 12, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 13, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 14, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 15, _mm_and_si128(byte_stream, mask_2));
-					in += 16;
-					to += 64;
-				case 0x28:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 9, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 10, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 11, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 12, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 13, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 14, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 15, _mm_and_si128(byte_stream, mask_2));
-					in += 16;
-					to += 64;
-				case 0x29:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 9, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 10, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 11, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 12, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 13, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 14, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 15, _mm_and_si128(byte_stream, mask_2));
-					in += 16;
-					to += 64;
-				case 0x2a:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 9, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 10, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 11, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 12, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 13, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 14, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 15, _mm_and_si128(byte_stream, mask_2));
-					in += 16;
-					to += 64;
-				case 0x2b:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 9, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 10, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 11, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 12, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 13, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 14, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 15, _mm_and_si128(byte_stream, mask_2));
-					in += 16;
-					to += 64;
-				case 0x2c:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 9, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 10, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 11, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 12, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 13, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 14, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 15, _mm_and_si128(byte_stream, mask_2));
-					in += 16;
-					to += 64;
-				case 0x2d:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 9, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 10, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 11, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 12, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 13, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 14, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 15, _mm_and_si128(byte_stream, mask_2));
-					in += 16;
-					to += 64;
-				case 0x2e:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 9, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 10, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 11, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 12, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 13, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 14, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 15, _mm_and_si128(byte_stream, mask_2));
-					in += 16;
-					to += 64;
-				case 0x2f:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 9, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 10, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 11, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 12, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 13, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 14, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 15, _mm_and_si128(byte_stream, mask_2));
-					in += 16;
-					to += 64;
-					break;
-				case 0x30:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 9, _mm_and_si128(byte_stream, mask_3));
-					in += 16;
-					to += 40;
-				case 0x31:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 9, _mm_and_si128(byte_stream, mask_3));
-					in += 16;
-					to += 40;
-				case 0x32:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 9, _mm_and_si128(byte_stream, mask_3));
-					in += 16;
-					to += 40;
-				case 0x33:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 9, _mm_and_si128(byte_stream, mask_3));
-					in += 16;
-					to += 40;
-				case 0x34:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 9, _mm_and_si128(byte_stream, mask_3));
-					in += 16;
-					to += 40;
-				case 0x35:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 9, _mm_and_si128(byte_stream, mask_3));
-					in += 16;
-					to += 40;
-				case 0x36:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 9, _mm_and_si128(byte_stream, mask_3));
-					in += 16;
-					to += 40;
-				case 0x37:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 9, _mm_and_si128(byte_stream, mask_3));
-					in += 16;
-					to += 40;
-				case 0x38:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 9, _mm_and_si128(byte_stream, mask_3));
-					in += 16;
-					to += 40;
-				case 0x39:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 9, _mm_and_si128(byte_stream, mask_3));
-					in += 16;
-					to += 40;
-				case 0x3a:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 9, _mm_and_si128(byte_stream, mask_3));
-					in += 16;
-					to += 40;
-				case 0x3b:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 9, _mm_and_si128(byte_stream, mask_3));
-					in += 16;
-					to += 40;
-				case 0x3c:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 9, _mm_and_si128(byte_stream, mask_3));
-					in += 16;
-					to += 40;
-				case 0x3d:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 9, _mm_and_si128(byte_stream, mask_3));
-					in += 16;
-					to += 40;
-				case 0x3e:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 9, _mm_and_si128(byte_stream, mask_3));
-					in += 16;
-					to += 40;
-				case 0x3f:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 9, _mm_and_si128(byte_stream, mask_3));
-					in += 16;
-					to += 40;
-					break;
-				case 0x40:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_4));
-					in += 16;
-					to += 32;
-				case 0x41:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_4));
-					in += 16;
-					to += 32;
-				case 0x42:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_4));
-					in += 16;
-					to += 32;
-				case 0x43:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_4));
-					in += 16;
-					to += 32;
-				case 0x44:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_4));
-					in += 16;
-					to += 32;
-				case 0x45:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_4));
-					in += 16;
-					to += 32;
-				case 0x46:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_4));
-					in += 16;
-					to += 32;
-				case 0x47:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_4));
-					in += 16;
-					to += 32;
-				case 0x48:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_4));
-					in += 16;
-					to += 32;
-				case 0x49:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_4));
-					in += 16;
-					to += 32;
-				case 0x4a:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_4));
-					in += 16;
-					to += 32;
-				case 0x4b:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_4));
-					in += 16;
-					to += 32;
-				case 0x4c:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_4));
-					in += 16;
-					to += 32;
-				case 0x4d:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_4));
-					in += 16;
-					to += 32;
-				case 0x4e:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_4));
-					in += 16;
-					to += 32;
-				case 0x4f:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_4));
-					in += 16;
-					to += 32;
-					break;
-				case 0x50:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_5));
-					in += 16;
-					to += 24;
-				case 0x51:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_5));
-					in += 16;
-					to += 24;
-				case 0x52:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_5));
-					in += 16;
-					to += 24;
-				case 0x53:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_5));
-					in += 16;
-					to += 24;
-				case 0x54:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_5));
-					in += 16;
-					to += 24;
-				case 0x55:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_5));
-					in += 16;
-					to += 24;
-				case 0x56:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_5));
-					in += 16;
-					to += 24;
-				case 0x57:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_5));
-					in += 16;
-					to += 24;
-				case 0x58:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_5));
-					in += 16;
-					to += 24;
-				case 0x59:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_5));
-					in += 16;
-					to += 24;
-				case 0x5a:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_5));
-					in += 16;
-					to += 24;
-				case 0x5b:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_5));
-					in += 16;
-					to += 24;
-				case 0x5c:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_5));
-					in += 16;
-					to += 24;
-				case 0x5d:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_5));
-					in += 16;
-					to += 24;
-				case 0x5e:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_5));
-					in += 16;
-					to += 24;
-				case 0x5f:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_5));
-					in += 16;
-					to += 24;
-					break;
-				case 0x60:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_6));
-					in += 16;
-					to += 20;
-				case 0x61:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_6));
-					in += 16;
-					to += 20;
-				case 0x62:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_6));
-					in += 16;
-					to += 20;
-				case 0x63:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_6));
-					in += 16;
-					to += 20;
-				case 0x64:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_6));
-					in += 16;
-					to += 20;
-				case 0x65:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_6));
-					in += 16;
-					to += 20;
-				case 0x66:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_6));
-					in += 16;
-					to += 20;
-				case 0x67:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_6));
-					in += 16;
-					to += 20;
-				case 0x68:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_6));
-					in += 16;
-					to += 20;
-				case 0x69:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_6));
-					in += 16;
-					to += 20;
-				case 0x6a:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_6));
-					in += 16;
-					to += 20;
-				case 0x6b:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_6));
-					in += 16;
-					to += 20;
-				case 0x6c:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_6));
-					in += 16;
-					to += 20;
-				case 0x6d:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_6));
-					in += 16;
-					to += 20;
-				case 0x6e:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_6));
-					in += 16;
-					to += 20;
-				case 0x6f:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_6));
-					in += 16;
-					to += 20;
-					break;
-				case 0x70:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_7));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 4), _mm_srli_epi32(byte_stream, 7)), mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream_2, 3);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_7));
-					in += 32;
-					to += 36;
-				case 0x71:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_7));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 4), _mm_srli_epi32(byte_stream, 7)), mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream_2, 3);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_7));
-					in += 32;
-					to += 36;
-				case 0x72:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_7));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 4), _mm_srli_epi32(byte_stream, 7)), mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream_2, 3);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_7));
-					in += 32;
-					to += 36;
-				case 0x73:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_7));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 4), _mm_srli_epi32(byte_stream, 7)), mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream_2, 3);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_7));
-					in += 32;
-					to += 36;
-				case 0x74:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_7));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 4), _mm_srli_epi32(byte_stream, 7)), mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream_2, 3);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_7));
-					in += 32;
-					to += 36;
-				case 0x75:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_7));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 4), _mm_srli_epi32(byte_stream, 7)), mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream_2, 3);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_7));
-					in += 32;
-					to += 36;
-				case 0x76:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_7));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 4), _mm_srli_epi32(byte_stream, 7)), mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream_2, 3);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_7));
-					in += 32;
-					to += 36;
-				case 0x77:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_7));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 4), _mm_srli_epi32(byte_stream, 7)), mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream_2, 3);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_7));
-					in += 32;
-					to += 36;
-				case 0x78:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_7));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 4), _mm_srli_epi32(byte_stream, 7)), mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream_2, 3);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_7));
-					in += 32;
-					to += 36;
-				case 0x79:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_7));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 4), _mm_srli_epi32(byte_stream, 7)), mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream_2, 3);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_7));
-					in += 32;
-					to += 36;
-				case 0x7a:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_7));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 4), _mm_srli_epi32(byte_stream, 7)), mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream_2, 3);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_7));
-					in += 32;
-					to += 36;
-				case 0x7b:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_7));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 4), _mm_srli_epi32(byte_stream, 7)), mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream_2, 3);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_7));
-					in += 32;
-					to += 36;
-				case 0x7c:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_7));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 4), _mm_srli_epi32(byte_stream, 7)), mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream_2, 3);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_7));
-					in += 32;
-					to += 36;
-				case 0x7d:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_7));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 4), _mm_srli_epi32(byte_stream, 7)), mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream_2, 3);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_7));
-					in += 32;
-					to += 36;
-				case 0x7e:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_7));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 4), _mm_srli_epi32(byte_stream, 7)), mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream_2, 3);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_7));
-					in += 32;
-					to += 36;
-				case 0x7f:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_7));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 4), _mm_srli_epi32(byte_stream, 7)), mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream_2, 3);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_7));
-					in += 32;
-					to += 36;
-					break;
-				case 0x80:
-					tmp = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_cvtepu8_epi32(tmp));
-					tmp2 = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp), 0x01));
-					_mm_storeu_si128((__m128i *)to + 1, _mm_cvtepu8_epi32(tmp2));
-					tmp = _mm_castps_si128(_mm_movehl_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp)));
-					_mm_storeu_si128((__m128i *)to + 2, _mm_cvtepu8_epi32(tmp));
-					tmp2 = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp), 0x01));
-					_mm_storeu_si128((__m128i *)to + 3, _mm_cvtepu8_epi32(tmp2));
-					in += 16;
-					to += 16;
-				case 0x81:
-					tmp = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_cvtepu8_epi32(tmp));
-					tmp2 = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp), 0x01));
-					_mm_storeu_si128((__m128i *)to + 1, _mm_cvtepu8_epi32(tmp2));
-					tmp = _mm_castps_si128(_mm_movehl_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp)));
-					_mm_storeu_si128((__m128i *)to + 2, _mm_cvtepu8_epi32(tmp));
-					tmp2 = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp), 0x01));
-					_mm_storeu_si128((__m128i *)to + 3, _mm_cvtepu8_epi32(tmp2));
-					in += 16;
-					to += 16;
-				case 0x82:
-					tmp = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_cvtepu8_epi32(tmp));
-					tmp2 = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp), 0x01));
-					_mm_storeu_si128((__m128i *)to + 1, _mm_cvtepu8_epi32(tmp2));
-					tmp = _mm_castps_si128(_mm_movehl_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp)));
-					_mm_storeu_si128((__m128i *)to + 2, _mm_cvtepu8_epi32(tmp));
-					tmp2 = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp), 0x01));
-					_mm_storeu_si128((__m128i *)to + 3, _mm_cvtepu8_epi32(tmp2));
-					in += 16;
-					to += 16;
-				case 0x83:
-					tmp = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_cvtepu8_epi32(tmp));
-					tmp2 = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp), 0x01));
-					_mm_storeu_si128((__m128i *)to + 1, _mm_cvtepu8_epi32(tmp2));
-					tmp = _mm_castps_si128(_mm_movehl_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp)));
-					_mm_storeu_si128((__m128i *)to + 2, _mm_cvtepu8_epi32(tmp));
-					tmp2 = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp), 0x01));
-					_mm_storeu_si128((__m128i *)to + 3, _mm_cvtepu8_epi32(tmp2));
-					in += 16;
-					to += 16;
-				case 0x84:
-					tmp = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_cvtepu8_epi32(tmp));
-					tmp2 = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp), 0x01));
-					_mm_storeu_si128((__m128i *)to + 1, _mm_cvtepu8_epi32(tmp2));
-					tmp = _mm_castps_si128(_mm_movehl_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp)));
-					_mm_storeu_si128((__m128i *)to + 2, _mm_cvtepu8_epi32(tmp));
-					tmp2 = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp), 0x01));
-					_mm_storeu_si128((__m128i *)to + 3, _mm_cvtepu8_epi32(tmp2));
-					in += 16;
-					to += 16;
-				case 0x85:
-					tmp = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_cvtepu8_epi32(tmp));
-					tmp2 = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp), 0x01));
-					_mm_storeu_si128((__m128i *)to + 1, _mm_cvtepu8_epi32(tmp2));
-					tmp = _mm_castps_si128(_mm_movehl_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp)));
-					_mm_storeu_si128((__m128i *)to + 2, _mm_cvtepu8_epi32(tmp));
-					tmp2 = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp), 0x01));
-					_mm_storeu_si128((__m128i *)to + 3, _mm_cvtepu8_epi32(tmp2));
-					in += 16;
-					to += 16;
-				case 0x86:
-					tmp = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_cvtepu8_epi32(tmp));
-					tmp2 = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp), 0x01));
-					_mm_storeu_si128((__m128i *)to + 1, _mm_cvtepu8_epi32(tmp2));
-					tmp = _mm_castps_si128(_mm_movehl_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp)));
-					_mm_storeu_si128((__m128i *)to + 2, _mm_cvtepu8_epi32(tmp));
-					tmp2 = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp), 0x01));
-					_mm_storeu_si128((__m128i *)to + 3, _mm_cvtepu8_epi32(tmp2));
-					in += 16;
-					to += 16;
-				case 0x87:
-					tmp = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_cvtepu8_epi32(tmp));
-					tmp2 = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp), 0x01));
-					_mm_storeu_si128((__m128i *)to + 1, _mm_cvtepu8_epi32(tmp2));
-					tmp = _mm_castps_si128(_mm_movehl_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp)));
-					_mm_storeu_si128((__m128i *)to + 2, _mm_cvtepu8_epi32(tmp));
-					tmp2 = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp), 0x01));
-					_mm_storeu_si128((__m128i *)to + 3, _mm_cvtepu8_epi32(tmp2));
-					in += 16;
-					to += 16;
-				case 0x88:
-					tmp = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_cvtepu8_epi32(tmp));
-					tmp2 = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp), 0x01));
-					_mm_storeu_si128((__m128i *)to + 1, _mm_cvtepu8_epi32(tmp2));
-					tmp = _mm_castps_si128(_mm_movehl_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp)));
-					_mm_storeu_si128((__m128i *)to + 2, _mm_cvtepu8_epi32(tmp));
-					tmp2 = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp), 0x01));
-					_mm_storeu_si128((__m128i *)to + 3, _mm_cvtepu8_epi32(tmp2));
-					in += 16;
-					to += 16;
-				case 0x89:
-					tmp = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_cvtepu8_epi32(tmp));
-					tmp2 = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp), 0x01));
-					_mm_storeu_si128((__m128i *)to + 1, _mm_cvtepu8_epi32(tmp2));
-					tmp = _mm_castps_si128(_mm_movehl_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp)));
-					_mm_storeu_si128((__m128i *)to + 2, _mm_cvtepu8_epi32(tmp));
-					tmp2 = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp), 0x01));
-					_mm_storeu_si128((__m128i *)to + 3, _mm_cvtepu8_epi32(tmp2));
-					in += 16;
-					to += 16;
-				case 0x8a:
-					tmp = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_cvtepu8_epi32(tmp));
-					tmp2 = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp), 0x01));
-					_mm_storeu_si128((__m128i *)to + 1, _mm_cvtepu8_epi32(tmp2));
-					tmp = _mm_castps_si128(_mm_movehl_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp)));
-					_mm_storeu_si128((__m128i *)to + 2, _mm_cvtepu8_epi32(tmp));
-					tmp2 = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp), 0x01));
-					_mm_storeu_si128((__m128i *)to + 3, _mm_cvtepu8_epi32(tmp2));
-					in += 16;
-					to += 16;
-				case 0x8b:
-					tmp = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_cvtepu8_epi32(tmp));
-					tmp2 = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp), 0x01));
-					_mm_storeu_si128((__m128i *)to + 1, _mm_cvtepu8_epi32(tmp2));
-					tmp = _mm_castps_si128(_mm_movehl_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp)));
-					_mm_storeu_si128((__m128i *)to + 2, _mm_cvtepu8_epi32(tmp));
-					tmp2 = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp), 0x01));
-					_mm_storeu_si128((__m128i *)to + 3, _mm_cvtepu8_epi32(tmp2));
-					in += 16;
-					to += 16;
-				case 0x8c:
-					tmp = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_cvtepu8_epi32(tmp));
-					tmp2 = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp), 0x01));
-					_mm_storeu_si128((__m128i *)to + 1, _mm_cvtepu8_epi32(tmp2));
-					tmp = _mm_castps_si128(_mm_movehl_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp)));
-					_mm_storeu_si128((__m128i *)to + 2, _mm_cvtepu8_epi32(tmp));
-					tmp2 = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp), 0x01));
-					_mm_storeu_si128((__m128i *)to + 3, _mm_cvtepu8_epi32(tmp2));
-					in += 16;
-					to += 16;
-				case 0x8d:
-					tmp = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_cvtepu8_epi32(tmp));
-					tmp2 = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp), 0x01));
-					_mm_storeu_si128((__m128i *)to + 1, _mm_cvtepu8_epi32(tmp2));
-					tmp = _mm_castps_si128(_mm_movehl_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp)));
-					_mm_storeu_si128((__m128i *)to + 2, _mm_cvtepu8_epi32(tmp));
-					tmp2 = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp), 0x01));
-					_mm_storeu_si128((__m128i *)to + 3, _mm_cvtepu8_epi32(tmp2));
-					in += 16;
-					to += 16;
-				case 0x8e:
-					tmp = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_cvtepu8_epi32(tmp));
-					tmp2 = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp), 0x01));
-					_mm_storeu_si128((__m128i *)to + 1, _mm_cvtepu8_epi32(tmp2));
-					tmp = _mm_castps_si128(_mm_movehl_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp)));
-					_mm_storeu_si128((__m128i *)to + 2, _mm_cvtepu8_epi32(tmp));
-					tmp2 = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp), 0x01));
-					_mm_storeu_si128((__m128i *)to + 3, _mm_cvtepu8_epi32(tmp2));
-					in += 16;
-					to += 16;
-				case 0x8f:
-					tmp = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_cvtepu8_epi32(tmp));
-					tmp2 = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp), 0x01));
-					_mm_storeu_si128((__m128i *)to + 1, _mm_cvtepu8_epi32(tmp2));
-					tmp = _mm_castps_si128(_mm_movehl_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp)));
-					_mm_storeu_si128((__m128i *)to + 2, _mm_cvtepu8_epi32(tmp));
-					tmp2 = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp), 0x01));
-					_mm_storeu_si128((__m128i *)to + 3, _mm_cvtepu8_epi32(tmp2));
-					in += 16;
-					to += 16;
-					break;
-				case 0x90:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_9));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 5), _mm_srli_epi32(byte_stream, 9)), mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream_2, 4);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_9));
-					in += 32;
-					to += 28;
-				case 0x91:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_9));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 5), _mm_srli_epi32(byte_stream, 9)), mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream_2, 4);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_9));
-					in += 32;
-					to += 28;
-				case 0x92:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_9));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 5), _mm_srli_epi32(byte_stream, 9)), mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream_2, 4);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_9));
-					in += 32;
-					to += 28;
-				case 0x93:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_9));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 5), _mm_srli_epi32(byte_stream, 9)), mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream_2, 4);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_9));
-					in += 32;
-					to += 28;
-				case 0x94:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_9));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 5), _mm_srli_epi32(byte_stream, 9)), mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream_2, 4);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_9));
-					in += 32;
-					to += 28;
-				case 0x95:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_9));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 5), _mm_srli_epi32(byte_stream, 9)), mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream_2, 4);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_9));
-					in += 32;
-					to += 28;
-				case 0x96:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_9));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 5), _mm_srli_epi32(byte_stream, 9)), mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream_2, 4);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_9));
-					in += 32;
-					to += 28;
-				case 0x97:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_9));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 5), _mm_srli_epi32(byte_stream, 9)), mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream_2, 4);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_9));
-					in += 32;
-					to += 28;
-				case 0x98:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_9));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 5), _mm_srli_epi32(byte_stream, 9)), mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream_2, 4);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_9));
-					in += 32;
-					to += 28;
-				case 0x99:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_9));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 5), _mm_srli_epi32(byte_stream, 9)), mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream_2, 4);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_9));
-					in += 32;
-					to += 28;
-				case 0x9a:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_9));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 5), _mm_srli_epi32(byte_stream, 9)), mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream_2, 4);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_9));
-					in += 32;
-					to += 28;
-				case 0x9b:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_9));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 5), _mm_srli_epi32(byte_stream, 9)), mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream_2, 4);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_9));
-					in += 32;
-					to += 28;
-				case 0x9c:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_9));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 5), _mm_srli_epi32(byte_stream, 9)), mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream_2, 4);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_9));
-					in += 32;
-					to += 28;
-				case 0x9d:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_9));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 5), _mm_srli_epi32(byte_stream, 9)), mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream_2, 4);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_9));
-					in += 32;
-					to += 28;
-				case 0x9e:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_9));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 5), _mm_srli_epi32(byte_stream, 9)), mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream_2, 4);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_9));
-					in += 32;
-					to += 28;
-				case 0x9f:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_9));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 5), _mm_srli_epi32(byte_stream, 9)), mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream_2, 4);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_9));
-					in += 32;
-					to += 28;
-					break;
-				case 0xa0:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_10));
-					byte_stream = _mm_srli_epi64(byte_stream, 10);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_10));
-					byte_stream = _mm_srli_epi64(byte_stream, 10);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_10));
-					in += 16;
-					to += 12;
-				case 0xa1:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_10));
-					byte_stream = _mm_srli_epi64(byte_stream, 10);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_10));
-					byte_stream = _mm_srli_epi64(byte_stream, 10);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_10));
-					in += 16;
-					to += 12;
-				case 0xa2:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_10));
-					byte_stream = _mm_srli_epi64(byte_stream, 10);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_10));
-					byte_stream = _mm_srli_epi64(byte_stream, 10);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_10));
-					in += 16;
-					to += 12;
-				case 0xa3:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_10));
-					byte_stream = _mm_srli_epi64(byte_stream, 10);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_10));
-					byte_stream = _mm_srli_epi64(byte_stream, 10);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_10));
-					in += 16;
-					to += 12;
-				case 0xa4:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_10));
-					byte_stream = _mm_srli_epi64(byte_stream, 10);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_10));
-					byte_stream = _mm_srli_epi64(byte_stream, 10);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_10));
-					in += 16;
-					to += 12;
-				case 0xa5:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_10));
-					byte_stream = _mm_srli_epi64(byte_stream, 10);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_10));
-					byte_stream = _mm_srli_epi64(byte_stream, 10);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_10));
-					in += 16;
-					to += 12;
-				case 0xa6:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_10));
-					byte_stream = _mm_srli_epi64(byte_stream, 10);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_10));
-					byte_stream = _mm_srli_epi64(byte_stream, 10);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_10));
-					in += 16;
-					to += 12;
-				case 0xa7:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_10));
-					byte_stream = _mm_srli_epi64(byte_stream, 10);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_10));
-					byte_stream = _mm_srli_epi64(byte_stream, 10);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_10));
-					in += 16;
-					to += 12;
-				case 0xa8:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_10));
-					byte_stream = _mm_srli_epi64(byte_stream, 10);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_10));
-					byte_stream = _mm_srli_epi64(byte_stream, 10);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_10));
-					in += 16;
-					to += 12;
-				case 0xa9:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_10));
-					byte_stream = _mm_srli_epi64(byte_stream, 10);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_10));
-					byte_stream = _mm_srli_epi64(byte_stream, 10);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_10));
-					in += 16;
-					to += 12;
-				case 0xaa:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_10));
-					byte_stream = _mm_srli_epi64(byte_stream, 10);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_10));
-					byte_stream = _mm_srli_epi64(byte_stream, 10);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_10));
-					in += 16;
-					to += 12;
-				case 0xab:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_10));
-					byte_stream = _mm_srli_epi64(byte_stream, 10);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_10));
-					byte_stream = _mm_srli_epi64(byte_stream, 10);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_10));
-					in += 16;
-					to += 12;
-				case 0xac:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_10));
-					byte_stream = _mm_srli_epi64(byte_stream, 10);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_10));
-					byte_stream = _mm_srli_epi64(byte_stream, 10);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_10));
-					in += 16;
-					to += 12;
-				case 0xad:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_10));
-					byte_stream = _mm_srli_epi64(byte_stream, 10);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_10));
-					byte_stream = _mm_srli_epi64(byte_stream, 10);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_10));
-					in += 16;
-					to += 12;
-				case 0xae:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_10));
-					byte_stream = _mm_srli_epi64(byte_stream, 10);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_10));
-					byte_stream = _mm_srli_epi64(byte_stream, 10);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_10));
-					in += 16;
-					to += 12;
-				case 0xaf:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_10));
-					byte_stream = _mm_srli_epi64(byte_stream, 10);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_10));
-					byte_stream = _mm_srli_epi64(byte_stream, 10);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_10));
-					in += 16;
-					to += 12;
-					break;
-				case 0xb0:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_12));
-					byte_stream = _mm_srli_epi32(byte_stream, 12);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_12));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 8), _mm_srli_epi32(byte_stream, 12)), mask_12));
-					byte_stream = _mm_srli_epi32(byte_stream_2, 8);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_12));
-					byte_stream = _mm_srli_epi32(byte_stream, 12);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_12));
-					in += 32;
-					to += 20;
-				case 0xb1:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_12));
-					byte_stream = _mm_srli_epi32(byte_stream, 12);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_12));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 8), _mm_srli_epi32(byte_stream, 12)), mask_12));
-					byte_stream = _mm_srli_epi32(byte_stream_2, 8);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_12));
-					byte_stream = _mm_srli_epi32(byte_stream, 12);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_12));
-					in += 32;
-					to += 20;
-				case 0xb2:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_12));
-					byte_stream = _mm_srli_epi32(byte_stream, 12);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_12));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 8), _mm_srli_epi32(byte_stream, 12)), mask_12));
-					byte_stream = _mm_srli_epi32(byte_stream_2, 8);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_12));
-					byte_stream = _mm_srli_epi32(byte_stream, 12);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_12));
-					in += 32;
-					to += 20;
-				case 0xb3:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_12));
-					byte_stream = _mm_srli_epi32(byte_stream, 12);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_12));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 8), _mm_srli_epi32(byte_stream, 12)), mask_12));
-					byte_stream = _mm_srli_epi32(byte_stream_2, 8);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_12));
-					byte_stream = _mm_srli_epi32(byte_stream, 12);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_12));
-					in += 32;
-					to += 20;
-				case 0xb4:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_12));
-					byte_stream = _mm_srli_epi32(byte_stream, 12);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_12));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 8), _mm_srli_epi32(byte_stream, 12)), mask_12));
-					byte_stream = _mm_srli_epi32(byte_stream_2, 8);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_12));
-					byte_stream = _mm_srli_epi32(byte_stream, 12);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_12));
-					in += 32;
-					to += 20;
-				case 0xb5:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_12));
-					byte_stream = _mm_srli_epi32(byte_stream, 12);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_12));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 8), _mm_srli_epi32(byte_stream, 12)), mask_12));
-					byte_stream = _mm_srli_epi32(byte_stream_2, 8);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_12));
-					byte_stream = _mm_srli_epi32(byte_stream, 12);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_12));
-					in += 32;
-					to += 20;
-				case 0xb6:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_12));
-					byte_stream = _mm_srli_epi32(byte_stream, 12);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_12));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 8), _mm_srli_epi32(byte_stream, 12)), mask_12));
-					byte_stream = _mm_srli_epi32(byte_stream_2, 8);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_12));
-					byte_stream = _mm_srli_epi32(byte_stream, 12);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_12));
-					in += 32;
-					to += 20;
-				case 0xb7:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_12));
-					byte_stream = _mm_srli_epi32(byte_stream, 12);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_12));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 8), _mm_srli_epi32(byte_stream, 12)), mask_12));
-					byte_stream = _mm_srli_epi32(byte_stream_2, 8);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_12));
-					byte_stream = _mm_srli_epi32(byte_stream, 12);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_12));
-					in += 32;
-					to += 20;
-				case 0xb8:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_12));
-					byte_stream = _mm_srli_epi32(byte_stream, 12);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_12));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 8), _mm_srli_epi32(byte_stream, 12)), mask_12));
-					byte_stream = _mm_srli_epi32(byte_stream_2, 8);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_12));
-					byte_stream = _mm_srli_epi32(byte_stream, 12);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_12));
-					in += 32;
-					to += 20;
-				case 0xb9:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_12));
-					byte_stream = _mm_srli_epi32(byte_stream, 12);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_12));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 8), _mm_srli_epi32(byte_stream, 12)), mask_12));
-					byte_stream = _mm_srli_epi32(byte_stream_2, 8);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_12));
-					byte_stream = _mm_srli_epi32(byte_stream, 12);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_12));
-					in += 32;
-					to += 20;
-				case 0xba:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_12));
-					byte_stream = _mm_srli_epi32(byte_stream, 12);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_12));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 8), _mm_srli_epi32(byte_stream, 12)), mask_12));
-					byte_stream = _mm_srli_epi32(byte_stream_2, 8);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_12));
-					byte_stream = _mm_srli_epi32(byte_stream, 12);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_12));
-					in += 32;
-					to += 20;
-				case 0xbb:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_12));
-					byte_stream = _mm_srli_epi32(byte_stream, 12);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_12));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 8), _mm_srli_epi32(byte_stream, 12)), mask_12));
-					byte_stream = _mm_srli_epi32(byte_stream_2, 8);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_12));
-					byte_stream = _mm_srli_epi32(byte_stream, 12);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_12));
-					in += 32;
-					to += 20;
-				case 0xbc:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_12));
-					byte_stream = _mm_srli_epi32(byte_stream, 12);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_12));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 8), _mm_srli_epi32(byte_stream, 12)), mask_12));
-					byte_stream = _mm_srli_epi32(byte_stream_2, 8);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_12));
-					byte_stream = _mm_srli_epi32(byte_stream, 12);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_12));
-					in += 32;
-					to += 20;
-				case 0xbd:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_12));
-					byte_stream = _mm_srli_epi32(byte_stream, 12);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_12));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 8), _mm_srli_epi32(byte_stream, 12)), mask_12));
-					byte_stream = _mm_srli_epi32(byte_stream_2, 8);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_12));
-					byte_stream = _mm_srli_epi32(byte_stream, 12);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_12));
-					in += 32;
-					to += 20;
-				case 0xbe:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_12));
-					byte_stream = _mm_srli_epi32(byte_stream, 12);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_12));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 8), _mm_srli_epi32(byte_stream, 12)), mask_12));
-					byte_stream = _mm_srli_epi32(byte_stream_2, 8);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_12));
-					byte_stream = _mm_srli_epi32(byte_stream, 12);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_12));
-					in += 32;
-					to += 20;
-				case 0xbf:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_12));
-					byte_stream = _mm_srli_epi32(byte_stream, 12);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_12));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 8), _mm_srli_epi32(byte_stream, 12)), mask_12));
-					byte_stream = _mm_srli_epi32(byte_stream_2, 8);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_12));
-					byte_stream = _mm_srli_epi32(byte_stream, 12);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_12));
-					in += 32;
-					to += 20;
-					break;
-				case 0xc0:
-					tmp = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_cvtepu16_epi32(tmp));
-					_mm_storeu_si128((__m128i *)to + 1, _mm_cvtepu16_epi32(_mm_castps_si128(_mm_movehl_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp)))));
-					in += 16;
-					to += 8;
-				case 0xc1:
-					tmp = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_cvtepu16_epi32(tmp));
-					_mm_storeu_si128((__m128i *)to + 1, _mm_cvtepu16_epi32(_mm_castps_si128(_mm_movehl_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp)))));
-					in += 16;
-					to += 8;
-				case 0xc2:
-					tmp = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_cvtepu16_epi32(tmp));
-					_mm_storeu_si128((__m128i *)to + 1, _mm_cvtepu16_epi32(_mm_castps_si128(_mm_movehl_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp)))));
-					in += 16;
-					to += 8;
-				case 0xc3:
-					tmp = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_cvtepu16_epi32(tmp));
-					_mm_storeu_si128((__m128i *)to + 1, _mm_cvtepu16_epi32(_mm_castps_si128(_mm_movehl_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp)))));
-					in += 16;
-					to += 8;
-				case 0xc4:
-					tmp = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_cvtepu16_epi32(tmp));
-					_mm_storeu_si128((__m128i *)to + 1, _mm_cvtepu16_epi32(_mm_castps_si128(_mm_movehl_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp)))));
-					in += 16;
-					to += 8;
-				case 0xc5:
-					tmp = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_cvtepu16_epi32(tmp));
-					_mm_storeu_si128((__m128i *)to + 1, _mm_cvtepu16_epi32(_mm_castps_si128(_mm_movehl_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp)))));
-					in += 16;
-					to += 8;
-				case 0xc6:
-					tmp = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_cvtepu16_epi32(tmp));
-					_mm_storeu_si128((__m128i *)to + 1, _mm_cvtepu16_epi32(_mm_castps_si128(_mm_movehl_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp)))));
-					in += 16;
-					to += 8;
-				case 0xc7:
-					tmp = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_cvtepu16_epi32(tmp));
-					_mm_storeu_si128((__m128i *)to + 1, _mm_cvtepu16_epi32(_mm_castps_si128(_mm_movehl_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp)))));
-					in += 16;
-					to += 8;
-				case 0xc8:
-					tmp = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_cvtepu16_epi32(tmp));
-					_mm_storeu_si128((__m128i *)to + 1, _mm_cvtepu16_epi32(_mm_castps_si128(_mm_movehl_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp)))));
-					in += 16;
-					to += 8;
-				case 0xc9:
-					tmp = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_cvtepu16_epi32(tmp));
-					_mm_storeu_si128((__m128i *)to + 1, _mm_cvtepu16_epi32(_mm_castps_si128(_mm_movehl_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp)))));
-					in += 16;
-					to += 8;
-				case 0xca:
-					tmp = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_cvtepu16_epi32(tmp));
-					_mm_storeu_si128((__m128i *)to + 1, _mm_cvtepu16_epi32(_mm_castps_si128(_mm_movehl_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp)))));
-					in += 16;
-					to += 8;
-				case 0xcb:
-					tmp = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_cvtepu16_epi32(tmp));
-					_mm_storeu_si128((__m128i *)to + 1, _mm_cvtepu16_epi32(_mm_castps_si128(_mm_movehl_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp)))));
-					in += 16;
-					to += 8;
-				case 0xcc:
-					tmp = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_cvtepu16_epi32(tmp));
-					_mm_storeu_si128((__m128i *)to + 1, _mm_cvtepu16_epi32(_mm_castps_si128(_mm_movehl_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp)))));
-					in += 16;
-					to += 8;
-				case 0xcd:
-					tmp = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_cvtepu16_epi32(tmp));
-					_mm_storeu_si128((__m128i *)to + 1, _mm_cvtepu16_epi32(_mm_castps_si128(_mm_movehl_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp)))));
-					in += 16;
-					to += 8;
-				case 0xce:
-					tmp = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_cvtepu16_epi32(tmp));
-					_mm_storeu_si128((__m128i *)to + 1, _mm_cvtepu16_epi32(_mm_castps_si128(_mm_movehl_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp)))));
-					in += 16;
-					to += 8;
-				case 0xcf:
-					tmp = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_cvtepu16_epi32(tmp));
-					_mm_storeu_si128((__m128i *)to + 1, _mm_cvtepu16_epi32(_mm_castps_si128(_mm_movehl_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp)))));
-					in += 16;
-					to += 8;
-					break;
-				case 0xd0:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_21));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 11), _mm_srli_epi32(byte_stream, 21)), mask_21));
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(_mm_srli_epi32(byte_stream_2, 11), mask_21));
-					in += 32;
-					to += 12;
-				case 0xd1:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_21));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 11), _mm_srli_epi32(byte_stream, 21)), mask_21));
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(_mm_srli_epi32(byte_stream_2, 11), mask_21));
-					in += 32;
-					to += 12;
-				case 0xd2:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_21));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 11), _mm_srli_epi32(byte_stream, 21)), mask_21));
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(_mm_srli_epi32(byte_stream_2, 11), mask_21));
-					in += 32;
-					to += 12;
-				case 0xd3:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_21));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 11), _mm_srli_epi32(byte_stream, 21)), mask_21));
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(_mm_srli_epi32(byte_stream_2, 11), mask_21));
-					in += 32;
-					to += 12;
-				case 0xd4:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_21));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 11), _mm_srli_epi32(byte_stream, 21)), mask_21));
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(_mm_srli_epi32(byte_stream_2, 11), mask_21));
-					in += 32;
-					to += 12;
-				case 0xd5:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_21));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 11), _mm_srli_epi32(byte_stream, 21)), mask_21));
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(_mm_srli_epi32(byte_stream_2, 11), mask_21));
-					in += 32;
-					to += 12;
-				case 0xd6:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_21));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 11), _mm_srli_epi32(byte_stream, 21)), mask_21));
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(_mm_srli_epi32(byte_stream_2, 11), mask_21));
-					in += 32;
-					to += 12;
-				case 0xd7:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_21));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 11), _mm_srli_epi32(byte_stream, 21)), mask_21));
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(_mm_srli_epi32(byte_stream_2, 11), mask_21));
-					in += 32;
-					to += 12;
-				case 0xd8:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_21));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 11), _mm_srli_epi32(byte_stream, 21)), mask_21));
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(_mm_srli_epi32(byte_stream_2, 11), mask_21));
-					in += 32;
-					to += 12;
-				case 0xd9:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_21));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 11), _mm_srli_epi32(byte_stream, 21)), mask_21));
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(_mm_srli_epi32(byte_stream_2, 11), mask_21));
-					in += 32;
-					to += 12;
-				case 0xda:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_21));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 11), _mm_srli_epi32(byte_stream, 21)), mask_21));
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(_mm_srli_epi32(byte_stream_2, 11), mask_21));
-					in += 32;
-					to += 12;
-				case 0xdb:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_21));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 11), _mm_srli_epi32(byte_stream, 21)), mask_21));
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(_mm_srli_epi32(byte_stream_2, 11), mask_21));
-					in += 32;
-					to += 12;
-				case 0xdc:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_21));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 11), _mm_srli_epi32(byte_stream, 21)), mask_21));
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(_mm_srli_epi32(byte_stream_2, 11), mask_21));
-					in += 32;
-					to += 12;
-				case 0xdd:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_21));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 11), _mm_srli_epi32(byte_stream, 21)), mask_21));
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(_mm_srli_epi32(byte_stream_2, 11), mask_21));
-					in += 32;
-					to += 12;
-				case 0xde:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_21));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 11), _mm_srli_epi32(byte_stream, 21)), mask_21));
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(_mm_srli_epi32(byte_stream_2, 11), mask_21));
-					in += 32;
-					to += 12;
-				case 0xdf:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_21));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 11), _mm_srli_epi32(byte_stream, 21)), mask_21));
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(_mm_srli_epi32(byte_stream_2, 11), mask_21));
-					in += 32;
-					to += 12;
-					break;
-				case 0xe0:
-					tmp = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, tmp);
-					in += 16;
-					to += 4;
-				case 0xe1:
-					tmp = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, tmp);
-					in += 16;
-					to += 4;
-				case 0xe2:
-					tmp = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, tmp);
-					in += 16;
-					to += 4;
-				case 0xe3:
-					tmp = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, tmp);
-					in += 16;
-					to += 4;
-				case 0xe4:
-					tmp = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, tmp);
-					in += 16;
-					to += 4;
-				case 0xe5:
-					tmp = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, tmp);
-					in += 16;
-					to += 4;
-				case 0xe6:
-					tmp = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, tmp);
-					in += 16;
-					to += 4;
-				case 0xe7:
-					tmp = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, tmp);
-					in += 16;
-					to += 4;
-				case 0xe8:
-					tmp = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, tmp);
-					in += 16;
-					to += 4;
-				case 0xe9:
-					tmp = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, tmp);
-					in += 16;
-					to += 4;
-				case 0xea:
-					tmp = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, tmp);
-					in += 16;
-					to += 4;
-				case 0xeb:
-					tmp = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, tmp);
-					in += 16;
-					to += 4;
-				case 0xec:
-					tmp = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, tmp);
-					in += 16;
-					to += 4;
-				case 0xed:
-					tmp = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, tmp);
-					in += 16;
-					to += 4;
-				case 0xee:
-					tmp = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, tmp);
-					in += 16;
-					to += 4;
-				case 0xef:
-					tmp = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, tmp);
-					in += 16;
-					to += 4;
-					break;
-				case 0xf0:
-					in++;// LCOV_EXCL_LINE
-				case 0xf1:
-					in++;// LCOV_EXCL_LINE
-				case 0xf2:
-					in++;// LCOV_EXCL_LINE
-				case 0xf3:
-					in++;// LCOV_EXCL_LINE
-				case 0xf4:
-					in++;// LCOV_EXCL_LINE
-				case 0xf5:
-					in++;// LCOV_EXCL_LINE
-				case 0xf6:
-					in++;// LCOV_EXCL_LINE
-				case 0xf7:
-					in++;// LCOV_EXCL_LINE
-				case 0xf8:
-					in++;// LCOV_EXCL_LINE
-				case 0xf9:
-					in++;// LCOV_EXCL_LINE
-				case 0xfa:
-					in++;// LCOV_EXCL_LINE
-				case 0xfb:
-					in++;// LCOV_EXCL_LINE
-				case 0xfc:
-					in++;// LCOV_EXCL_LINE
-				case 0xfd:
-					in++;// LCOV_EXCL_LINE
-				case 0xfe:
-					in++;// LCOV_EXCL_LINE
-				case 0xff:
-					in++;// LCOV_EXCL_LINE
-					break; // LCOV_EXCL_LINE
-				}
+			size_t key_count = keys - stop + 1;
+			if (total + key_count > sizeof(padded))
+				return 0;
+			memset(padded, 0, total);
+			memcpy(padded, in, available);
+			memcpy(padded + total, stop, key_count);
+			padded[total + key_count - 1] = (uint8_t)((type << 4) | (16 - chunk));
+			from = padded;
+			from_stop = padded + total;
+			from_keys = from_stop + key_count - 1;
 			}
+
+		/*
+			Don't patch outside what this call decodes
+		*/
+		for (size_t patch = 0; patch < patches; patch++)
+			if (from[bytes + patch * 5] >= integers)
+				return 0;
+
+		instruction_set isa = active_instruction_set();
+		if (!cumulative)
+			isa == AVX512 ? decode_keys_avx512(&to, start + MAX_INTEGERS_PER_CALL, &from, &from_keys, from_stop) : isa == AVX2 ? decode_keys_avx2(&to, start + MAX_INTEGERS_PER_CALL, &from, &from_keys, from_stop) : decode_keys_sse41(&to, start + MAX_INTEGERS_PER_CALL, &from, &from_keys, from_stop);
+		else
+			isa == AVX512 ? decode_d1_keys_avx512(&to, start + MAX_INTEGERS_PER_CALL, &from, &from_keys, from_stop, previous) : isa == AVX2 ? decode_d1_keys_avx2(&to, start + MAX_INTEGERS_PER_CALL, &from, &from_keys, from_stop, previous) : decode_d1_keys_sse41(&to, start + MAX_INTEGERS_PER_CALL, &from, &from_keys, from_stop, previous);
+
+		*payload_offset += available;
+		*key_offset += last ? keys - stop + 1 : 0;
+		*word_offset = last ? 0 : *word_offset + chunk;
+
+		return to - start;
+		}
+
+	/*
+		COMPRESS_INTEGER_QMX_IMPROVED::ENCODED_INTEGERS()
+		-------------------------------------------------
+	*/
+	size_t compress_integer_qmx_improved::encoded_integers(const void *source, size_t len)
+		{
+		if (len == 0)
+			return 0;
+
+		const uint8_t *payload = (const uint8_t *)source;
+		size_t integers = 0;
+		for (const uint8_t *key = payload + len - 1; payload <= key; key--)
+			{
+			uint32_t type = *key >> 4;
+			uint32_t words = 16 - (*key & 0x0F);
+
+			integers += words * integers_for_selector[type];
+			payload += words * bytes_for_selector[type];
+			}
+
+		return integers;
+		}
+
+	/*
+		COMPRESS_INTEGER_QMX_IMPROVED::COUNT_WORDS()
+		--------------------------------------------
+	*/
+	size_t compress_integer_qmx_improved::count_words(const void *source, size_t len, size_t payload_offset, size_t key_offset, size_t word_offset, size_t integers, uint64_t words_of_type[16])
+		{
+		if (payload_offset >= len || key_offset >= len - payload_offset)
+			return 0;
+
+		const uint8_t *start = (const uint8_t *)source + payload_offset;
+		const uint8_t *payload = start;
+		const uint8_t *first_key = (const uint8_t *)source + len - 1 - key_offset;
+		const uint8_t *key = first_key;
+		size_t counted = 0;
+		for (; payload <= key && (counted < integers || *key >> 4 == 15); key--)
+			{
+			uint32_t type = *key >> 4;
+			uint32_t words = 16 - (*key & 0x0F) - (key == first_key ? std::min((size_t)(16 - (*key & 0x0F)), word_offset) : 0);
+			uint32_t used = type == 15 ? words : std::min((size_t)words, (integers - counted + integers_for_selector[type] - 1) / integers_for_selector[type]);
+
+			words_of_type[type] += used;
+			counted += used * integers_for_selector[type];
+			payload += used * bytes_for_selector[type];
+			if (used < words)
+				break;				// decode_next() stopped part way through the key
+			}
+
+		/*
+			The last word may be cut short by the keys
+		*/
+		return std::min(payload, key + 1) - start + (first_key - key);
+		}
+
+	/*
+		SUM_SETS()
+		----------
+	*/
+	/*!
+		@brief Add up (in each lane) the 4-integer sets packed into a 128-bit word, the reverse of pack_sets()
+		@param word [in] the packed word
+		@param bits [in] the size (in bits) of each integer
+		@param sets [in] the number of 4-integer sets in the word
+		@param first_shift [in] where in each lane the first set is
+		@return the sum of the sets in each lane
+	*/
+	static inline __attribute__((always_inline)) __m128i sum_sets(__m128i word, uint32_t bits, uint32_t sets, uint32_t first_shift)
+		{
+		__m128i mask = _mm_set1_epi32(bits == 32 ? 0xFFFFFFFF : (1U << bits) - 1);
+		__m128i sum = _mm_setzero_si128();
+
+		#pragma GCC unroll 32
+		for (uint32_t set = 0; set < sets; set++)
+			sum = _mm_add_epi32(sum, _mm_and_si128(_mm_srli_epi32(word, first_shift + set * bits), mask));
+
+		return sum;
+		}
+
+	/*
+		SUM_TWO_WORDS()
+		---------------
+	*/
+	/*!
+		@brief Add up (in each lane) the integers of the 7, 9, 12, and 21-bit selectors, the reverse of pack_two_words()
+		@param payload [in] the 32 bytes of the two words
+		@param bits [in] the size (in bits) of each integer
+		@param straddle [in] the set that straddles the two words
+		@param sets [in] the total number of 4-integer sets
+		@param second_start [in] the bit of the second word the set after the straddling one starts at
+		@return the sum of the integers in each lane
+	*/
+	static inline __attribute__((always_inline)) __m128i sum_two_words(const uint8_t *payload, uint32_t bits, uint32_t straddle, uint32_t sets, uint32_t second_start)
+		{
+		uint32_t carried = 32 - straddle * bits;
+		__m128i first = _mm_loadu_si128((const __m128i *)payload);
+		__m128i second = _mm_loadu_si128((const __m128i *)payload + 1);
+		__m128i straddling = _mm_or_si128(_mm_srli_epi32(first, straddle * bits), _mm_slli_epi32(_mm_and_si128(second, _mm_set1_epi32((1U << (bits - carried)) - 1)), carried));
+
+		return _mm_add_epi32(_mm_add_epi32(sum_sets(first, bits, straddle, 0), straddling), sum_sets(second, bits, sets - straddle - 1, second_start));
 		}
-	}
+
+	/*
+		SUM_WORD()
+		----------
+	*/
+	/*!
+		@brief Add up (in each lane) the integers in one payload word of the given selector type (not 0 or 15, which have no payload to add)
+		@details The 8, 16, and 32-bit selectors store their integers in order rather than in sets, but in a sum it doesn't matter which
+		lane an integer is in.
+		@param payload [in] the word
+		@param type [in] the selector type
+		@return the sum of the integers in each lane, which can't overflow
+	*/
+	static inline __attribute__((always_inline)) __m128i sum_word(const uint8_t *payload, uint32_t type)
+		{
+		__m128i word = _mm_loadu_si128((const __m128i *)payload);
+
+		switch (type)
+			{
+			case 1: return sum_sets(word, 1, 32, 0);
+			case 2: return sum_sets(word, 2, 16, 0);
+			case 3: return sum_sets(word, 3, 10, 0);
+			case 4: return sum_sets(word, 4, 8, 0);
+			case 5: return sum_sets(word, 5, 6, 0);
+			case 6: return sum_sets(word, 6, 5, 0);
+			case 7: return sum_two_words(payload, 7, 4, 9, 3);
+			case 8: return sum_sets(word, 8, 4, 0);
+			case 9: return sum_two_words(payload, 9, 3, 7, 4);
+			case 10: return sum_sets(word, 10, 3, 0);
+			case 11: return sum_two_words(payload, 12, 2, 5, 8);
+			case 12: return sum_sets(word, 16, 2, 0);
+			case 13: return sum_two_words(payload, 21, 1, 3, 11);
+			default: return word;					// 32-bit integers, their own sum
+			}
+		}
+
+	/*
+		SUM_WORDS()
+		-----------
+	*/
+	/*!
+		@brief Add up (in each lane) the integers in a run of up to 16 payload words of the given selector type (not 0, 14, or 15)
+		@details Each case is its own loop so that sum_word() unrolls with immediate shifts.  16 words of 3 21-bit integers per lane
+		don't overflow a lane, 16 words of 32-bit integers would.
+		@param payload [in] the words
+		@param words [in] the number of words
+		@param type [in] the selector type
+		@return the sum of the integers in each lane
+	*/
+	static __m128i sum_words(const uint8_t *payload, uint32_t words, uint32_t type)
+		{
+		__m128i sum = _mm_setzero_si128();
+
+		switch (type)
+			{
+			case 1: for (uint32_t word = 0; word < words; word++) sum = _mm_add_epi32(sum, sum_word(payload + word * 16, 1)); break;
+			case 2: for (uint32_t word = 0; word < words; word++) sum = _mm_add_epi32(sum, sum_word(payload + word * 16, 2)); break;
+			case 3: for (uint32_t word = 0; word < words; word++) sum = _mm_add_epi32(sum, sum_word(payload + word * 16, 3)); break;
+			case 4: for (uint32_t word = 0; word < words; word++) sum = _mm_add_epi32(sum, sum_word(payload + word * 16, 4)); break;
+			case 5: for (uint32_t word = 0; word < words; word++) sum = _mm_add_epi32(sum, sum_word(payload + word * 16, 5)); break;
+			case 6: for (uint32_t word = 0; word < words; word++) sum = _mm_add_epi32(sum, sum_word(payload + word * 16, 6)); break;
+			case 7: for (uint32_t word = 0; word < words; word++) sum = _mm_add_epi32(sum, sum_word(payload + word * 32, 7)); break;
+			case 8: for (uint32_t word = 0; word < words; word++) sum = _mm_add_epi32(sum, sum_word(payload + word * 16, 8)); break;
+			case 9: for (uint32_t word = 0; word < words; word++) sum = _mm_add_epi32(sum, sum_word(payload + word * 32, 9)); break;
+			case 10: for (uint32_t word = 0; word < words; word++) sum = _mm_add_epi32(sum, sum_word(payload + word * 16, 10)); break;
+			case 11: for (uint32_t word = 0; word < words; word++) sum = _mm_add_epi32(sum, sum_word(payload + word * 32, 11)); break;
+			case 12: for (uint32_t word = 0; word < words; word++) sum = _mm_add_epi32(sum, sum_word(payload + word * 16, 12)); break;
+			case 13: for (uint32_t word = 0; word < words; word++) sum = _mm_add_epi32(sum, sum_word(payload + word * 32, 13)); break;
+			}
+
+		return sum;
+		}
+
+	/*
+		HORIZONTAL_SUM()
+		----------------
+	*/
+	/*!
+		@brief Add up the 4 lanes of a register
+		@param lanes [in] the 4 integers
+		@return their sum
+	*/
+	static inline uint64_t horizontal_sum(__m128i lanes)
+		{
+		uint32_t lane[4];
+
+		_mm_storeu_si128((__m128i *)lane, lanes);
+		return (uint64_t)lane[0] + lane[1] + lane[2] + lane[3];
+		}
+
+	/*
+		SUM_WORDS_32()
+		--------------
+	*/
+	/*!
+		@brief Add up a run of up to 16 payload words of 32-bit integers
+		@details The low and high halves of the integers are added up separately (in the lanes of two registers) as the integers
+		themselves would overflow a lane.
+		@param payload [in] the words
+		@param words [in] the number of words
+		@return the sum of the integers
+	*/
+	static uint64_t sum_words_32(const uint8_t *payload, uint32_t words)
+		{
+		__m128i mask = _mm_set1_epi32(0xFFFF);
+		__m128i low = _mm_setzero_si128();
+		__m128i high = _mm_setzero_si128();
+
+		for (uint32_t word = 0; word < words; word++)
+			{
+			__m128i integers = _mm_loadu_si128((const __m128i *)payload + word);
+			low = _mm_add_epi32(low, _mm_and_si128(integers, mask));
+			high = _mm_add_epi32(high, _mm_srli_epi32(integers, 16));
+			}
+
+		return horizontal_sum(low) + (horizontal_sum(high) << 16);
+		}
+
+	/*
+		COMPRESS_INTEGER_QMX_IMPROVED::SUM()
+		------------------------------------
+		Each whole word is added up in registers without writing its integers anywhere.  The word that holds the last of the integers,
+		and a last word that is cut short, are decoded from a zero-padded copy (as decode_checked() does) so that only the integers
+		asked for are added.  A patch adds its addend to an integer that is already counted, so it adds the same to the sum.
+	*/
+	uint64_t compress_integer_qmx_improved::sum(const void *source, size_t len, size_t integers_to_sum, size_t *integers_summed)
+		{
+		if (integers_summed != nullptr)
+			*integers_summed = 0;
+		if (len == 0)
+			return 0;
+
+		const uint8_t *payload = (const uint8_t *)source;
+		size_t integers = 0;					// the integers walked past so far (what a patch counts back from)
+		uint64_t total = 0;
+		for (const uint8_t *key = payload + len - 1; payload <= key; key--)
+			{
+			uint32_t type = *key >> 4;
+			uint32_t words = 16 - (*key & 0x0F);
+
+			if (type == 15)
+				{
+				for (uint32_t patch = 0; patch < words && payload + 5 <= key; patch++, payload += 5)
+					{
+					size_t back = (size_t)*payload + 1;
+					uint32_t add;
+					memcpy(&add, payload + 1, sizeof(add));
+					if (back <= integers && integers - back < integers_to_sum)
+						total += add;
+					}
+				continue;
+				}
+
+			/*
+				A run that is all there and all wanted is added up in one go, otherwise a word at a time
+			*/
+			size_t bytes = words * bytes_for_selector[type];
+			if (type != 0 && bytes <= (size_t)(key - payload) && integers + words * integers_for_selector[type] <= integers_to_sum)
+				{
+				total += type == 14 ? sum_words_32(payload, words) : horizontal_sum(sum_words(payload, words, type));
+				payload += bytes;
+				integers += words * integers_for_selector[type];
+				continue;
+				}
+
+			__m128i run = _mm_setzero_si128();
+			for (uint32_t word = 0; word < words; word++, integers += integers_for_selector[type])
+				{
+				size_t available = std::min((size_t)bytes_for_selector[type], (size_t)(key - payload));
+				const uint8_t *at = payload;
+
+				payload += available;
+				if (integers >= integers_to_sum)
+					continue;					// past the end, but there may be patches still to come
+				if (integers + integers_for_selector[type] > integers_to_sum || available < bytes_for_selector[type])
+					{
+					/*
+						Decode the word (zero padded) and add up as many of its integers as were asked for
+					*/
+					integer buffer[256];
+					uint8_t padded[33] = {};
+					memcpy(padded, at, available);
+					padded[32] = (uint8_t)((type << 4) | 0x0F);
+
+					integer *into = buffer;
+					const uint8_t *word_payload = padded;
+					const uint8_t *word_key = padded + 32;
+					decode_keys_sse41(&into, buffer + 256, &word_payload, &word_key, padded + 32);
+					for (size_t which = 0; which < std::min((size_t)integers_for_selector[type], integers_to_sum - integers); which++)
+						total += buffer[which];
+					}
+				else if (type == 0)
+					total += integers_for_selector[0];		// 256 ones
+				else if (type == 14)
+					total += horizontal_sum(sum_word(at, type));
+				else
+					run = _mm_add_epi32(run, sum_word(at, type));
+				}
+			total += horizontal_sum(run);
+			}
+
+		if (integers_summed != nullptr)
+			*integers_summed = std::min(integers, integers_to_sum);
+		return total;
+		}
+
+	/*
+		COMPRESS_INTEGER_QMX_IMPROVED::UNITTEST_ONE()
+		---------------------------------------------
+		Every encoder mode (both format versions, greedy and optimal, encode() and encode_d1()) against every decoder (decode(),
+		decode_d1(), the checked ones, decode_next(), and sum()) under every instruction set this CPU has.  The encodings must be
+		byte-identical whichever instruction set wrote them, and encode_d1() of the running total must be byte-identical to encode().
+	*/
+	bool compress_integer_qmx_improved::unittest_one(const std::vector<uint32_t> &sequence)
+		{
+		const size_t length = sequence.size();
+		const integer base = 0x5EED;				// an arbitrary previous, so that the cumulative sum doesn't start at 0
+		instruction_set was = active_instruction_set();
+		bool passed = true;
+
+		std::vector<integer> running(length);
+		uint64_t total = 0;
+		integer last = base;
+		for (size_t which = 0; which < length; which++)
+			{
+			running[which] = last += sequence[which];
+			total += sequence[which];
+			}
+
+		for (format_version version : {ORIGINAL, PATCHED})
+			for (bool optimal : {false, true})
+				{
+				std::vector<uint8_t> first;
+				for (instruction_set isa : {SSE41, AVX2, AVX512})
+					{
+					if (use_instruction_set(isa) != isa)
+						continue;
+					auto fail = [&](const char *what)
+						{
+						fprintf(stderr, "compress_integer_qmx_improved::unittest_one(): %s (%zu integers, instruction set %d, format %d, %s)\n", what, length, (int)isa, (int)version, optimal ? "optimal" : "greedy");
+						passed = false;
+						};
+
+					compress_integer_qmx_improved encoder;
+					encoder.use_format_version(version);
+					encoder.use_optimal_partitioning(optimal);
+
+					/*
+						15 bytes of slack after the encoding for decode() and decode_d1() to read into
+					*/
+					std::vector<uint8_t> encoded(max_encoded_length(length) + 15);
+					size_t bytes = encoder.encode(encoded.data(), encoded.size(), sequence.data(), length);
+					std::vector<uint8_t> encoded_d1(encoded.size());
+					size_t bytes_d1 = encoder.encode_d1(encoded_d1.data(), encoded_d1.size(), running.data(), length, base);
+					if (bytes > max_encoded_length(length))
+						fail("encode() wrote more than max_encoded_length()");
+					if (bytes != bytes_d1 || memcmp(encoded.data(), encoded_d1.data(), bytes) != 0)
+						fail("encode_d1() of the running total differs from encode()");
+					if (first.empty())
+						first.assign(encoded.begin(), encoded.begin() + bytes);
+					else if (first.size() != bytes || memcmp(first.data(), encoded.data(), bytes) != 0)
+						fail("the encoding differs between instruction sets");
+
+					size_t integers = encoded_integers(encoded.data(), bytes);
+					if (integers < length)
+						fail("encoded_integers() is short");
+					std::vector<integer> decoded(integers + 256);
+
+					if (decode(decoded.data(), decoded.size(), encoded.data(), bytes) != integers || !std::equal(sequence.begin(), sequence.end(), decoded.begin()))
+						fail("decode()");
+					if (decode_d1(decoded.data(), decoded.size(), encoded.data(), bytes, base) != integers || !std::equal(running.begin(), running.end(), decoded.begin()))
+						fail("decode_d1()");
+
+					std::vector<integer> exact(length);
+					if (decode_checked(exact.data(), length, encoded.data(), bytes) != length || exact != sequence)
+						fail("decode_checked()");
+					if (decode_d1_checked(exact.data(), length, encoded.data(), bytes, base) != length || exact != running)
+						fail("decode_d1_checked()");
+
+					for (bool cumulative : {false, true})
+						{
+						std::vector<integer> streamed;
+						std::vector<integer> buffer(MAX_INTEGERS_PER_CALL);
+						size_t payload_offset = 0;
+						size_t key_offset = 0;
+						size_t word_offset = 0;
+						integer previous = base;
+						size_t written;
+						while ((written = decode_next(buffer.data(), encoded.data(), bytes, &payload_offset, &key_offset, &word_offset, cumulative, previous)) != 0)
+							{
+							streamed.insert(streamed.end(), buffer.begin(), buffer.begin() + written);
+							previous = buffer[written - 1];
+							}
+						const std::vector<integer> &expected = cumulative ? running : sequence;
+						if (streamed.size() != integers || !std::equal(expected.begin(), expected.end(), streamed.begin()))
+							fail(cumulative ? "decode_next() cumulative" : "decode_next()");
+						}
+
+					if (sum(encoded.data(), bytes, length) != total)
+						fail("sum()");
+					}
+				}
+
+		use_instruction_set(was);
+		return passed;
+		}
+
+	/*
+		COMPRESS_INTEGER_QMX_IMPROVED::UNITTEST()
+		-----------------------------------------
+		The sequences the selectors and the decoders' edges are most likely to get wrong: lengths either side of the 4-integer set,
+		the 8 and 16-integer words and the 256-integer run, long runs of 0-bit integers (ones) and of zeros, single outliers (for
+		the patches), integers over 2^21 up to 2^32 - 1, and random integers of every width.
+	*/
+	bool compress_integer_qmx_improved::unittest(void)
+		{
+		std::mt19937 random(2016);
+		bool passed = true;
+
+		const size_t lengths[] = {0, 1, 2, 3, 4, 5, 7, 8, 9, 15, 16, 17, 31, 32, 33, 255, 256, 257, 511, 1023, 4095, 4096, 4097, 65537};
+		for (size_t length : lengths)
+			{
+			std::vector<uint32_t> sequence(length);
+
+			for (uint32_t value : {0U, 1U, 2U, 0x1FFFFFU, 0x200000U, 0xFFFFFFFFU})
+				{
+				std::fill(sequence.begin(), sequence.end(), value);
+				passed &= unittest_one(sequence);
+				}
+
+			/*
+				Long runs of ones (0-bit integers) or zeros, broken by a single outlier of each width
+			*/
+			for (uint32_t run : {1U, 0U})
+				for (uint32_t bits = 1; bits <= 32 && length != 0; bits += 5)
+					{
+					std::fill(sequence.begin(), sequence.end(), run);
+					sequence[random() % length] = bits == 32 ? 0xFFFFFFFF : (uint32_t)((1ULL << bits) - 1);
+					passed &= unittest_one(sequence);
+					}
+
+			/*
+				Random integers of each width, with and without the odd outlier
+			*/
+			for (uint32_t bits = 0; bits <= 32; bits++)
+				{
+				for (auto &value : sequence)
+					value = bits == 0 ? 1 : (uint32_t)random() >> (32 - bits);
+				passed &= unittest_one(sequence);
+				for (size_t outlier = 0; outlier < length / 64 + 1 && length != 0; outlier++)
+					sequence[random() % length] = (uint32_t)random() | 0x200000;
+				passed &= unittest_one(sequence);
+				}
+
+			/*
+				Integers that alternate between narrow and wide, and a ramp through every width
+			*/
+			for (size_t which = 0; which < length; which++)
+				sequence[which] = which & 1 ? 0xFFFFFFFF : 0;
+			passed &= unittest_one(sequence);
+			for (size_t which = 0; which < length; which++)
+				sequence[which] = (uint32_t)(1ULL << (which % 33)) - 1;
+			passed &= unittest_one(sequence);
+			}
+
+		return passed;
+		}
+#endif
+
+	}	// end the namespace
+
+#ifdef MAKE_DECOMPRESS
+	#include <stdarg.h>
+
+	/*
+		The following program generates the source code for compress_integer_qmx_improved::decode() and its variants
+	*/
+
+	/*
+		ENUM VARIANT
+		------------
+	*/
+	/*!
+		@brief The decoders the generator can write
+	*/
+	enum variant
+		{
+		PLAIN,			///< decode(): write out the integers as they were encoded
+		D1				///< decode_d1(): write out the cumulative sum of the integers (i.e. docids from d-gaps) starting from a given value
+		};
+
+	/*
+		ENUM INSTRUCTION_SET
+		--------------------
+	*/
+	/*!
+		@brief The register widths the generator can write decoders for
+	*/
+	enum instruction_set
+		{
+		SSE41,			///< 128-bit registers, one 4-integer set at a time
+		AVX2,				///< 256-bit registers, each 128-bit word is broadcast into both lanes and two sets are unpacked at once with variable shifts
+		AVX512			///< 512-bit registers, each 128-bit word is broadcast into all four lanes and four sets are unpacked at once, a final 3 sets are stored masked
+		};
+
+	/*
+		ENUM LAYOUT
+		-----------
+	*/
+	/*!
+		@brief How the generator lays out the code that dispatches on the keys
+	*/
+	enum layout
+		{
+		UNROLLED,		///< one switch case for each of the 256 keys, falling through to the next to decode the rest of the run (longest, fewest branches)
+		COMPACT			///< one switch case for each of the 16 selectors, decoding one word inside a loop over the run (a sixteenth of the code)
+		};
+
+	static variant generating = PLAIN;			///< The decoder currently being written
+	static instruction_set targeting = SSE41;	///< The instruction set of the decoder currently being written
+	static layout laying_out = UNROLLED;		///< The layout of the decoders being written
+
+	/*
+		EMIT()
+		------
+	*/
+	/*!
+		@brief Write one line of the code that decodes a word, indented to suit the layout
+		@param format [in] the printf() format of the line (without its indent)
+	*/
+	static void emit(const char *format, ...)
+		{
+		va_list arguments;
+
+		printf(laying_out == COMPACT ? "\t\t\t\t\t\t" : "\t\t\t\t\t");
+		va_start(arguments, format);
+		vprintf(format, arguments);
+		va_end(arguments);
+		}
+
+	/*
+		STORE()
+		-------
+	*/
+	/*!
+		@brief Write the code that stores 4 decoded integers (in an SSE register) into the output
+		@param offset [in] the offset (in 128-bit words) from to that the integers are written to
+		@param value [in] the expression that computes the 4 decoded integers
+	*/
+	static void store(uint32_t offset, const char *value)
+		{
+		char destination[32];
+
+		if (offset == 0)
+			sprintf(destination, "(__m128i *)to");
+		else
+			sprintf(destination, "(__m128i *)to + %u", (unsigned)offset);
+
+		if (generating == D1)
+			emit("_mm_storeu_si128(%s, running_sum(%s, running));\n", destination, value);
+		else
+			emit("_mm_storeu_si128(%s, %s);\n", destination, value);
+		}
+
+	/*
+		SHIFT_AND_STORE()
+		-----------------
+	*/
+	/*!
+		@brief Write the code that unpacks integers of the given size from byte_stream, one 4-integer set at a time
+		@param bits [in] the size (in bits) of each integer
+		@param from [in] the first 4-integer set to write
+		@param to [in] one past the last 4-integer set to write
+		@param shift [in] the shift instruction to use (_mm_srli_epi64 or _mm_srli_epi32)
+	*/
+	static void shift_and_store(uint32_t bits, uint32_t from, uint32_t to, const char *shift)
+		{
+		char value[64];
+
+		sprintf(value, "_mm_and_si128(byte_stream, mask_%u)", (unsigned)bits);
+		for (uint32_t set = from; set < to; set++)
+			{
+			if (set != from)
+				emit("byte_stream = %s(byte_stream, %u);\n", shift, (unsigned)bits);
+			store(set, value);
+			}
+		}
+
+	/*
+		GENERATE_PATCH()
+		----------------
+	*/
+	/*!
+		@brief Write the code to apply one exception (a selector 15 key): add a 32-bit value to one of the last 256 integers decoded
+		@details The payload is one byte (how far back from the end of the output, less one) then the 32-bit value to add.  When
+		decoding d-gaps the value is added to every docid from there on, and to the running total.
+	*/
+	static void generate_patch(void)
+		{
+		emit("{\n");
+		emit("uint32_t add;\n");
+		emit("memcpy(&add, in + 1, sizeof(add));\n");
+		if (generating == D1)
+			{
+			emit("for (integer *at = to - 1 - *in; at < to; at++)\n");
+			emit("\t*at += add;\n");
+			if (targeting == SSE41)
+				emit("running = _mm_add_epi32(running, _mm_set1_epi32(add));\n");
+			else
+				emit("running = %s_add_epi32(running, %s_set1_epi32(add));\n", targeting == AVX2 ? "_mm256" : "_mm512", targeting == AVX2 ? "_mm256" : "_mm512");
+			}
+		else
+			emit("*(to - 1 - *in) += add;\n");
+		emit("in += 5;\n");
+		emit("}\n");
+		}
+
+	/*
+		GENERATE_CASE()
+		---------------
+	*/
+	/*!
+		@brief Write the code to decode one word for the given selector
+		@param instance [in] the selector
+	*/
+	static void generate_case(uint32_t instance)
+		{
+		if ((instance >> 4) == 0)
+			{
+			/*
+				256 0-bit integers
+			*/
+			if (generating == D1)
+				{
+				emit("tmp = _mm_add_epi32(running, one_to_four);\n");
+				for (uint32_t set = 0; set < 64; set++)
+					{
+					if (set != 0)
+						emit("tmp = _mm_add_epi32(tmp, four);\n");
+					emit(set == 0 ? "_mm_storeu_si128((__m128i *)to, tmp);\n" : "_mm_storeu_si128((__m128i *)to + %u, tmp);\n", (unsigned)set);
+					}
+				emit("running = _mm_shuffle_epi32(tmp, _MM_SHUFFLE(3, 3, 3, 3));\n");
+				}
+			else
+				{
+				emit("tmp = _mm_loadu_si128((__m128i *)static_mask_1);\n");
+				for (uint32_t set = 0; set < 64; set++)
+					store(set, "tmp");
+				}
+			emit("to += 256;\n");		// becomes 256 integers
+			}
+		else if (instance >> 4 == 1)
+			{
+			/*
+				128 * 1-bit integers
+			*/
+			emit("byte_stream = _mm_loadu_si128((__m128i *)in);\n");
+			shift_and_store(1, 0, 32, "_mm_srli_epi64");
+			emit("in += 16;\n");		// 16 bytes
+			emit("to += 128;\n");		// becomes 128 integers
+			}
+		else if (instance >> 4 == 2)
+			{
+			/*
+				64 * 2-bit integers
+			*/
+			emit("byte_stream = _mm_loadu_si128((__m128i *)in);\n");
+			shift_and_store(2, 0, 16, "_mm_srli_epi64");
+			emit("in += 16;\n");		// 16 bytes
+			emit("to += 64;\n");		// becomes 64 integers
+			}
+		else if (instance >> 4 == 3)
+			{
+			/*
+				40 * 3-bit integers
+			*/
+			emit("byte_stream = _mm_loadu_si128((__m128i *)in);\n");
+			shift_and_store(3, 0, 10, "_mm_srli_epi64");
+			emit("in += 16;\n");		// 16 bytes
+			emit("to += 40;\n");		// becomes 40 integers
+			}
+		else if (instance >> 4 == 4)
+			{
+			/*
+				32 * 4-bit integers
+			*/
+			emit("byte_stream = _mm_loadu_si128((__m128i *)in);\n");
+			shift_and_store(4, 0, 8, "_mm_srli_epi64");
+			emit("in += 16;\n");		// 16 bytes
+			emit("to += 32;\n");		// becomes 32 integers
+			}
+		else if (instance >> 4 == 5)
+			{
+			/*
+				24 * 5-bit integers
+			*/
+			emit("byte_stream = _mm_loadu_si128((__m128i *)in);\n");
+			shift_and_store(5, 0, 6, "_mm_srli_epi64");
+			emit("in += 16;\n");		// 16 bytes
+			emit("to += 24;\n");		// becomes 24 integers
+			}
+		else if (instance >> 4 == 6)
+			{
+			/*
+				20 * 6-bit integers
+			*/
+			emit("byte_stream = _mm_loadu_si128((__m128i *)in);\n");
+			shift_and_store(6, 0, 5, "_mm_srli_epi64");
+			emit("in += 16;\n");		// 16 bytes
+			emit("to += 20;\n");		// becomes 20 integers
+			}
+		else if (instance >> 4 == 7)
+			{
+			/*
+				36 * 7 bit integers (in two 128-bit words)
+			*/
+			emit("byte_stream = _mm_loadu_si128((__m128i *)in);\n");
+			shift_and_store(7, 0, 4, "_mm_srli_epi32");
+			emit("byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);\n");
+			store(4, "_mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 4), _mm_srli_epi32(byte_stream, 7)), mask_7)");
+			emit("byte_stream = _mm_srli_epi32(byte_stream_2, 3);\n");
+			shift_and_store(7, 5, 9, "_mm_srli_epi32");
+			emit("in += 32;\n");		// 32 bytes
+			emit("to += 36;\n");		// becomes 36 integers
+			}
+		else if (instance >> 4 == 8)
+			{
+			/*
+				16 * 8-bit integers
+			*/
+			emit("tmp = _mm_loadu_si128((__m128i *)in);\n");
+			store(0, "_mm_cvtepu8_epi32(tmp)");
+			emit("tmp2 = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp), 0x01));\n");
+			store(1, "_mm_cvtepu8_epi32(tmp2)");
+			emit("tmp = _mm_castps_si128(_mm_movehl_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp)));\n");
+			store(2, "_mm_cvtepu8_epi32(tmp)");
+			emit("tmp2 = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp), 0x01));\n");
+			store(3, "_mm_cvtepu8_epi32(tmp2)");
+			emit("in += 16;\n");		// 16 bytes
+			emit("to += 16;\n");		// becomes 16 integers
+			}
+		else if (instance >> 4 == 9)
+			{
+			/*
+				28 * 9-bit ingtegers (in two 128-bit words)
+			*/
+			emit("byte_stream = _mm_loadu_si128((__m128i *)in);\n");
+			shift_and_store(9, 0, 3, "_mm_srli_epi32");
+			emit("byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);\n");
+			store(3, "_mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 5), _mm_srli_epi32(byte_stream, 9)), mask_9)");
+			emit("byte_stream = _mm_srli_epi32(byte_stream_2, 4);\n");
+			shift_and_store(9, 4, 7, "_mm_srli_epi32");
+			emit("in += 32;\n");		// 32 bytes
+			emit("to += 28;\n");		// becomes 28 integers
+			}
+		else if (instance >> 4 == 10)
+			{
+			/*
+				12 * 10-bit integers
+			*/
+			emit("byte_stream = _mm_loadu_si128((__m128i *)in);\n");
+			shift_and_store(10, 0, 3, "_mm_srli_epi64");
+			emit("in += 16;\n");		// 16 bytes
+			emit("to += 12;\n");		// becomes 12 integers
+			}
+		else if (instance >> 4 == 11)
+			{
+			/*
+				20 * 12-bit ingtegers (in two 128-bit words)
+			*/
+			emit("byte_stream = _mm_loadu_si128((__m128i *)in);\n");
+			shift_and_store(12, 0, 2, "_mm_srli_epi32");
+			emit("byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);\n");
+			store(2, "_mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 8), _mm_srli_epi32(byte_stream, 12)), mask_12)");
+			emit("byte_stream = _mm_srli_epi32(byte_stream_2, 8);\n");
+			shift_and_store(12, 3, 5, "_mm_srli_epi32");
+			emit("in += 32;\n");		// 32 bytes
+			emit("to += 20;\n");		// becomes 20 integers
+			}
+		else if (instance >> 4 == 12)
+			{
+			/*
+				16-bit integers
+			*/
+			emit("tmp = _mm_loadu_si128((__m128i *)in);\n");
+			store(0, "_mm_cvtepu16_epi32(tmp)");
+			store(1, "_mm_cvtepu16_epi32(_mm_castps_si128(_mm_movehl_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp))))");
+			emit("in += 16;\n");		// 16 bytes
+			emit("to += 8;\n");			// becomes 8 integers
+			}
+		else if (instance >> 4 == 13)
+			{
+			/*
+				12 * 21-bit ingtegers (in two 128-bit words)
+			*/
+			emit("byte_stream = _mm_loadu_si128((__m128i *)in);\n");
+			store(0, "_mm_and_si128(byte_stream, mask_21)");
+			emit("byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);\n");
+			store(1, "_mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 11), _mm_srli_epi32(byte_stream, 21)), mask_21)");
+			store(2, "_mm_and_si128(_mm_srli_epi32(byte_stream_2, 11), mask_21)");
+			emit("in += 32;\n");			// 32 bytes
+			emit("to += 12;\n");			// becomes 12 integers
+			}
+		else if (instance >> 4 == 14)
+			{
+			/*
+				32-bit integers
+			*/
+			emit("tmp = _mm_loadu_si128((__m128i *)in);\n");
+			store(0, "tmp");
+			emit("in += 16;\n");		// 16 bytes
+			emit("to += 4;\n");			// becomes 4 integers
+			}
+		else
+			generate_patch();
+		}
+
+	/*
+		WIDE_INTEGERS()
+		---------------
+	*/
+	/*!
+		@brief Return the number of integers in a register of the instruction set being written
+	*/
+	static uint32_t wide_integers(void)
+		{
+		return targeting == AVX512 ? 16 : 8;
+		}
+
+	/*
+		WIDE_PREFIX()
+		-------------
+	*/
+	/*!
+		@brief Return the prefix of the intrinsics of the instruction set being written (e.g. "_mm256")
+	*/
+	static const char *wide_prefix(void)
+		{
+		return targeting == AVX512 ? "_mm512" : "_mm256";
+		}
+
+	/*
+		WIDE_STORE()
+		------------
+	*/
+	/*!
+		@brief Write the code that stores the first valid integers of a wide register into the output
+		@param offset [in] the offset (in integers) from to that the integers are written to
+		@param valid [in] the number of integers in the register that are to be written out (a multiple of 4)
+		@param value [in] the expression that computes the decoded integers
+	*/
+	static void wide_store(uint32_t offset, uint32_t valid, const char *value)
+		{
+		char destination[32];
+		char summed[1024];
+		const char *stored = value;
+		uint32_t width = wide_integers() * 32;
+
+		if (offset == 0)
+			sprintf(destination, "to");
+		else
+			sprintf(destination, "to + %u", (unsigned)offset);
+
+		if (generating == D1)
+			{
+			/*
+				The cumulative sum only carries upwards so integers past valid can't change those before it
+			*/
+			sprintf(summed, "running_sum_%u(%s, running, %u)", (unsigned)width, value, (unsigned)(valid - 1));
+			stored = summed;
+			}
+
+		/*
+			Half and quarter registers are written with narrower stores because they are faster than masked stores
+		*/
+		if (valid == wide_integers())
+			emit("%s_storeu_si%u((__m%ui *)(%s), %s);\n", wide_prefix(), (unsigned)width, (unsigned)width, destination, stored);
+		else if (valid == 4)
+			emit("_mm_storeu_si128((__m128i *)(%s), %s_castsi%u_si128(%s));\n", destination, wide_prefix(), (unsigned)width, stored);
+		else if (valid == 8)
+			emit("_mm256_storeu_si256((__m256i *)(%s), _mm512_castsi512_si256(%s));\n", destination, stored);
+		else
+			emit("_mm512_mask_storeu_epi32(%s, 0x%04x, %s);\n", destination, (unsigned)((1 << valid) - 1), stored);
+		}
+
+	/*
+		SET_SHIFTS()
+		------------
+	*/
+	/*!
+		@brief Compute where the given 4-integer set of a selector is in the one (or two) 128-bit words of a payload word
+		@details Each set is (first >> first_right | second << second_left | second >> second_right) & mask, a shift of 32 means the term isn't used
+		(the AVX2 and AVX-512 variable shifts give 0 when shifting by 32 or more).  The 7, 9, 12, and 21-bit selectors have one set that straddles
+		both 128-bit words and then the remaining sets start at a fixed bit of the second word (this matches the SSE4.1 decoder).
+		@param bits [in] the size (in bits) of each integer
+		@param set [in] the 4-integer set
+		@param first_right [out] the right shift of the first word
+		@param second_left [out] the left shift of the second word
+		@param second_right [out] the right shift of the second word
+	*/
+	static void set_shifts(uint32_t bits, uint32_t set, uint32_t *first_right, uint32_t *second_left, uint32_t *second_right)
+		{
+		uint32_t straddle, second_start;
+
+		*first_right = *second_left = *second_right = 32;
+		switch (bits)
+			{
+			case 7:
+				straddle = 4;
+				second_start = 3;
+				break;
+			case 9:
+				straddle = 3;
+				second_start = 4;
+				break;
+			case 12:
+				straddle = 2;
+				second_start = 8;
+				break;
+			case 21:
+				straddle = 1;
+				second_start = 11;
+				break;
+			default:
+				*first_right = set * bits;
+				return;
+			}
+
+		if (set <= straddle)
+			*first_right = set * bits;
+		if (set == straddle)
+			*second_left = 32 - straddle * bits;
+		if (set > straddle)
+			*second_right = second_start + (set - straddle - 1) * bits;
+		}
+
+	/*
+		WIDE_SHIFT()
+		------------
+	*/
+	/*!
+		@brief Write the expression that shifts each lane of a wide register by its own amount
+		@param into [out] where to write the expression
+		@param shift [in] the variable shift intrinsic to use (srlv or sllv)
+		@param from [in] the register to shift
+		@param amount [in] the shift for each lane
+		@param valid [in] the number of lanes that matter
+		@return true if any lane that matters uses this term
+	*/
+	static bool wide_shift(char *into, const char *shift, const char *from, const uint32_t *amount, uint32_t valid)
+		{
+		bool used = false, shifted = false;
+
+		for (uint32_t lane = 0; lane < valid; lane++)
+			{
+			used |= amount[lane] < 32;
+			shifted |= amount[lane] != 0;
+			}
+
+		if (!shifted)
+			sprintf(into, "%s", from);
+		else
+			{
+			into += sprintf(into, "%s_%s_epi32(%s, %s_setr_epi32(", wide_prefix(), shift, from, wide_prefix());
+			for (uint32_t lane = 0; lane < wide_integers(); lane++)
+				into += sprintf(into, lane == 0 ? "%u" : ", %u", (unsigned)amount[lane]);
+			sprintf(into, "))");
+			}
+
+		return used;
+		}
+
+	/*
+		WIDE_SHIFT_AND_STORE()
+		----------------------
+	*/
+	/*!
+		@brief Write the code that unpacks integers of the given size from byte_stream (and byte_stream_2), one register at a time
+		@param bits [in] the size (in bits) of each integer
+		@param sets [in] the number of 4-integer sets in the payload word
+	*/
+	static void wide_shift_and_store(uint32_t bits, uint32_t sets)
+		{
+		uint32_t first_right[16], second_left[16], second_right[16];
+		char first[256], left[256], right[256], value[2048];
+		uint32_t sets_per_register = wide_integers() / 4;
+
+		for (uint32_t set = 0; set < sets; set += sets_per_register)
+			{
+			uint32_t valid = (sets - set < sets_per_register ? sets - set : sets_per_register) * 4;
+
+			for (uint32_t lane = 0; lane < wide_integers(); lane++)
+				if (set + lane / 4 < sets)
+					set_shifts(bits, set + lane / 4, &first_right[lane], &second_left[lane], &second_right[lane]);
+				else
+					first_right[lane] = second_left[lane] = second_right[lane] = 32;
+
+			bool use_first = wide_shift(first, "srlv", "byte_stream", first_right, valid);
+			bool use_left = wide_shift(left, "sllv", "byte_stream_2", second_left, valid);
+			bool use_right = wide_shift(right, "srlv", "byte_stream_2", second_right, valid);
+
+			char expression[1024] = "";
+			for (const char *term : {use_first ? first : nullptr, use_left ? left : nullptr, use_right ? right : nullptr})
+				if (term == nullptr)
+					continue;
+				else if (*expression == '\0')
+					sprintf(expression, "%s", term);
+				else
+					{
+					sprintf(value, "%s_or_si%u(%s, %s)", wide_prefix(), (unsigned)(wide_integers() * 32), expression, term);
+					strcpy(expression, value);
+					}
+
+			sprintf(value, "%s_and_si%u(%s, mask_%u)", wide_prefix(), (unsigned)(wide_integers() * 32), expression, (unsigned)bits);
+			wide_store(set * 4, valid, value);
+			}
+		}
+
+	/*
+		WIDE_BROADCAST()
+		----------------
+	*/
+	/*!
+		@brief Return the intrinsic that broadcasts a 128-bit word into every lane of a wide register
+	*/
+	static const char *wide_broadcast(void)
+		{
+		return targeting == AVX512 ? "_mm512_broadcast_i32x4" : "_mm256_broadcastsi128_si256";
+		}
+
+	/*
+		GENERATE_WIDE_CASE()
+		--------------------
+	*/
+	/*!
+		@brief Write the code to decode one word for the given selector using AVX2 or AVX-512
+		@param instance [in] the selector
+	*/
+	static void generate_wide_case(uint32_t instance)
+		{
+		static const uint32_t bits_for_selector[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 12, 16, 21, 32};
+		static const uint32_t integers_for_selector[] = {256, 128, 64, 40, 32, 24, 20, 36, 16, 28, 12, 20, 8, 12, 4};
+		uint32_t selector = instance >> 4;
+		uint32_t width = wide_integers() * 32;
+		char value[256];
+
+		if (selector == 15)
+			{
+			generate_patch();
+			return;
+			}
+
+		uint32_t bits = bits_for_selector[selector];
+		uint32_t integers = integers_for_selector[selector];
+		if (bits == 0)
+			{
+			/*
+				256 0-bit integers
+			*/
+			if (generating == D1)
+				{
+				emit("tmp = %s_add_epi32(running, one_to_%u);\n", wide_prefix(), (unsigned)wide_integers());
+				for (uint32_t offset = 0; offset < 256; offset += wide_integers())
+					{
+					if (offset != 0)
+						emit("tmp = %s_add_epi32(tmp, step);\n", wide_prefix());
+					emit(offset == 0 ? "%s_storeu_si%u((__m%ui *)(to), tmp);\n" : "%s_storeu_si%u((__m%ui *)(to + %u), tmp);\n", wide_prefix(), (unsigned)width, (unsigned)width, (unsigned)offset);
+					}
+				emit("running = %s_add_epi32(running, %s_set1_epi32(256));\n", wide_prefix(), wide_prefix());
+				}
+			else
+				for (uint32_t offset = 0; offset < 256; offset += wide_integers())
+					emit(offset == 0 ? "%s_storeu_si%u((__m%ui *)(to), mask_1);\n" : "%s_storeu_si%u((__m%ui *)(to + %u), mask_1);\n", wide_prefix(), (unsigned)width, (unsigned)width, (unsigned)offset);
+			emit("to += 256;\n");		// becomes 256 integers
+			return;
+			}
+		else if (bits == 8)
+			{
+			/*
+				16 * 8-bit integers
+			*/
+			if (targeting == AVX512)
+				wide_store(0, 16, "_mm512_cvtepu8_epi32(_mm_loadu_si128((__m128i *)in))");
+			else
+				{
+				wide_store(0, 8, "_mm256_cvtepu8_epi32(_mm_loadl_epi64((__m128i *)in))");
+				wide_store(8, 8, "_mm256_cvtepu8_epi32(_mm_loadl_epi64((__m128i *)(in + 8)))");
+				}
+			}
+		else if (bits == 16)
+			{
+			/*
+				8 * 16-bit integers
+			*/
+			if (targeting == AVX512)
+				wide_store(0, 8, "_mm512_castsi256_si512(_mm256_cvtepu16_epi32(_mm_loadu_si128((__m128i *)in)))");
+			else
+				wide_store(0, 8, "_mm256_cvtepu16_epi32(_mm_loadu_si128((__m128i *)in))");
+			}
+		else if (bits == 32)
+			{
+			/*
+				4 * 32-bit integers
+			*/
+			sprintf(value, "%s_castsi128_si%u(_mm_loadu_si128((__m128i *)in))", wide_prefix(), (unsigned)width);
+			wide_store(0, 4, value);
+			}
+		else
+			{
+			/*
+				Bit-packed integers in one (or two) 128-bit words
+			*/
+			emit("byte_stream = %s(_mm_loadu_si128((__m128i *)in));\n", wide_broadcast());
+			if (JASS::bytes_in_word(bits) == 32)
+				emit("byte_stream_2 = %s(_mm_loadu_si128((__m128i *)in + 1));\n", wide_broadcast());
+			wide_shift_and_store(bits, integers / 4);
+			}
+
+		emit("in += %u;\n", (unsigned)JASS::bytes_in_word(bits));
+		emit("to += %u;\n", (unsigned)integers);
+		}
+
+	/*
+		GENERATE()
+		----------
+	*/
+	/*!
+		@brief Write one decoder
+		@param which [in] the decoder to write
+		@param isa [in] the instruction set to write it for
+	*/
+	static void generate(variant which, instruction_set isa)
+		{
+		static const char *name[] = {"sse41", "avx2", "avx512"};
+		static const char *target[] = {"", "__attribute__((target(\"avx2\"))) ", "__attribute__((target(\"avx512f\"))) "};
+		static const uint32_t mask_bits[] = {21, 12, 10, 9, 7, 6, 5, 4, 3, 2, 1};
+
+		generating = which;
+		targeting = isa;
+
+		if (generating == D1)
+			printf("\t%svoid compress_integer_qmx_improved::decode_d1_keys_%s(integer **decoded, const integer *end, const uint8_t **payload, const uint8_t **selectors, const uint8_t *stop, integer previous)\n", target[targeting], name[targeting]);
+		else
+			printf("\t%svoid compress_integer_qmx_improved::decode_keys_%s(integer **decoded, const integer *end, const uint8_t **payload, const uint8_t **selectors, const uint8_t *stop)\n", target[targeting], name[targeting]);
+		printf("\t\t{\n");
+		if (targeting == SSE41)
+			{
+			printf("\t\t__m128i byte_stream, byte_stream_2, tmp, tmp2, mask_21, mask_12, mask_10, mask_9, mask_7, mask_6, mask_5, mask_4, mask_3, mask_2, mask_1;\n");
+			if (generating == D1)
+				printf("\t\t__m128i running, one_to_four, four;\n");
+			}
+		else
+			{
+			printf("\t\t__m%ui byte_stream, byte_stream_2, mask_21, mask_12, mask_10, mask_9, mask_7, mask_6, mask_5, mask_4, mask_3, mask_2, mask_1;\n", (unsigned)(wide_integers() * 32));
+			if (generating == D1)
+				printf("\t\t__m%ui running, tmp, one_to_%u, step;\n", (unsigned)(wide_integers() * 32), (unsigned)wide_integers());
+			}
+		printf("\t\tinteger *to = *decoded;\n");
+		printf("\t\tuint8_t *in = (uint8_t *)*payload;\n");
+		printf("\t\tuint8_t *keys = (uint8_t *)*selectors;\n");
+
+		printf("\n");
+		for (uint32_t bits : mask_bits)
+			if (targeting == SSE41)
+				printf("\t\tmask_%u = _mm_loadu_si128((__m128i *)static_mask_%u);\n", (unsigned)bits, (unsigned)bits);
+			else
+				printf("\t\tmask_%u = %s(_mm_loadu_si128((__m128i *)static_mask_%u));\n", (unsigned)bits, wide_broadcast(), (unsigned)bits);
+		if (generating == D1)
+			{
+			if (targeting == SSE41)
+				{
+				printf("\t\trunning = _mm_set1_epi32(previous);\n");
+				printf("\t\tone_to_four = _mm_setr_epi32(1, 2, 3, 4);\n");
+				printf("\t\tfour = _mm_set1_epi32(4);\n");
+				}
+			else
+				{
+				printf("\t\trunning = %s_set1_epi32(previous);\n", wide_prefix());
+				printf("\t\tone_to_%u = %s_setr_epi32(", (unsigned)wide_integers(), wide_prefix());
+				for (uint32_t lane = 0; lane < wide_integers(); lane++)
+					printf(lane == 0 ? "%u" : ", %u", (unsigned)(lane + 1));
+				printf(");\n");
+				printf("\t\tstep = %s_set1_epi32(%u);\n", wide_prefix(), (unsigned)wide_integers());
+				}
+			}
+		printf("\n");
+
+		printf("\t\twhile (in <= keys && keys >= stop)                      // <= because there can be a boundary case where the final key is 255*0 bit integers\n");
+		printf("\t\t\t{\n");
+		/*
+			A key that would write past end, read past what the input slack covers, or patch before the first integer this
+			call wrote is left undecoded, so the caller can tell from *selectors
+		*/
+		printf("\t\t\tif (!key_fits(keys, in, to, end, to - *decoded))\n");
+		printf("\t\t\t\tbreak;\n");
+		printf("\n");
+		if (laying_out == COMPACT)
+			{
+			/*
+				The low 4 bits of a key are the ones' complement of the number of words in the run less one
+			*/
+			printf("\t\t\tuint32_t words = 16 - (*keys & 0x0F);\n");
+			printf("\n");
+			printf("\t\t\tswitch (*keys-- >> 4)\n");
+			printf("\t\t\t\t{\n");
+			for (uint32_t selector = 0; selector <= 0xF; selector++)
+				{
+				printf("\t\t\t\tcase 0x%x:\n", selector);
+				printf("\t\t\t\t\tdo\n");
+				printf("\t\t\t\t\t\t{\n");
+				if (targeting == SSE41)
+					generate_case(selector << 4);
+				else
+					generate_wide_case(selector << 4);
+				printf("\t\t\t\t\t\t}\n");
+				printf("\t\t\t\t\twhile (--words != 0);\n");
+				printf("\t\t\t\t\tbreak;\n");
+				}
+			}
+		else
+			{
+			printf("\t\t\tswitch (*keys--)\n");
+			printf("\t\t\t\t{\n");
+			for (uint32_t instance = 0; instance <= 0xFF; instance++)
+				{
+				printf("\t\t\t\tcase 0x%02x:\n", instance);
+				if (targeting == SSE41)
+					generate_case(instance);
+				else
+					generate_wide_case(instance);
+				if ((instance & 0xF) == 0xF)
+					printf("\t\t\t\t\tbreak;\n");		// every 32 instances we break (its the end of the fall through)
+				}
+			}
+		printf("\t\t\t\t}\n");
+		printf("\t\t\t}\n");
+		printf("\n");
+		printf("\t\t*decoded = to;\n");
+		printf("\t\t*payload = in;\n");
+		printf("\t\t*selectors = keys;\n");
+		printf("\t\t}\n");
+
+		/*
+			The decoder proper decodes every key
+		*/
+		printf("\n");
+		if (generating == D1)
+			printf("\tsize_t compress_integer_qmx_improved::decode_d1_%s(integer *to, size_t destination_integers, const void *source, size_t len, integer previous)\n", name[targeting]);
+		else
+			printf("\tsize_t compress_integer_qmx_improved::decode_%s(integer *to, size_t destination_integers, const void *source, size_t len)\n", name[targeting]);
+		printf("\t\t{\n");
+		printf("\t\tinteger *start = to;\n");
+		printf("\t\tconst uint8_t *in = (const uint8_t *)source;\n");
+		printf("\t\tconst uint8_t *keys = in + len - 1;\n");
+		printf("\n");
+		if (generating == D1)
+			printf("\t\tdecode_d1_keys_%s(&to, start + destination_integers, &in, &keys, in, previous);\n", name[targeting]);
+		else
+			printf("\t\tdecode_keys_%s(&to, start + destination_integers, &in, &keys, in);\n", name[targeting]);
+		printf("\n");
+		printf("\t\treturn in <= keys ? SIZE_MAX : to - start;\n");
+		printf("\t\t}\n");
+		}
+
+	/*
+		GENERATE_RUNNING_SUM()
+		----------------------
+	*/
+	/*!
+		@brief Write the helpers that compute the cumulative sum of one register of decoded integers
+		@details The running total is only ever added to (the total of the register is computed from the register), so the dependency
+		chain from one register to the next is one add long.
+		@param isa [in] the instruction set to write them for
+	*/
+	static void generate_running_sum(instruction_set isa)
+		{
+		static const char *helpers[] =
+			{
+			/*
+				SSE41
+			*/
+			"\t/*\n"
+			"\t\tPREFIX_SUM()\n"
+			"\t\t------------\n"
+			"\t*/\n"
+			"\t/*!\n"
+			"\t\t@brief Compute the cumulative sum of 4 integers.\n"
+			"\t\t@param elements [in] The 4 integers.\n"
+			"\t\t@return The 4 cumulative sums.\n"
+			"\t*/\n"
+			"\tstatic inline __attribute__((always_inline)) __m128i prefix_sum(__m128i elements)\n"
+			"\t\t{\n"
+			"\t\telements = _mm_add_epi32(elements, _mm_slli_si128(elements, 4));\n"
+			"\t\treturn _mm_add_epi32(elements, _mm_slli_si128(elements, 8));\n"
+			"\t\t}\n"
+			"\n"
+			"\t/*\n"
+			"\t\tRUNNING_SUM()\n"
+			"\t\t-------------\n"
+			"\t*/\n"
+			"\t/*!\n"
+			"\t\t@brief Compute the cumulative sum of 4 integers starting from previous, then add the last of them to previous.\n"
+			"\t\t@param elements [in] The 4 integers.\n"
+			"\t\t@param previous [in, out] The running total (in all 4 lanes).\n"
+			"\t\t@return The 4 cumulative sums.\n"
+			"\t*/\n"
+			"\tstatic inline __attribute__((always_inline)) __m128i running_sum(__m128i elements, __m128i &previous)\n"
+			"\t\t{\n"
+			"\t\t__m128i sum;\n"
+			"\n"
+			"\t\telements = prefix_sum(elements);\n"
+			"\t\tsum = _mm_add_epi32(elements, previous);\n"
+			"\t\tprevious = _mm_add_epi32(previous, _mm_shuffle_epi32(elements, _MM_SHUFFLE(3, 3, 3, 3)));\t\t// the total of the 4 is added so the dependency on previous is one add long\n"
+			"\t\treturn sum;\n"
+			"\t\t}\n"
+			,
+			/*
+				AVX2
+			*/
+			"\t/*\n"
+			"\t\tPREFIX_SUM_256()\n"
+			"\t\t----------------\n"
+			"\t*/\n"
+			"\t/*!\n"
+			"\t\t@brief Compute the cumulative sum of the first last + 1 of 8 integers.\n"
+			"\t\t@param elements [in] The 8 integers.\n"
+			"\t\t@param last [in] The last integer that is to be kept (the ones after it are junk), if it is in the bottom half then only that half is summed.\n"
+			"\t\t@return The cumulative sums.\n"
+			"\t*/\n"
+			"\tstatic inline __attribute__((always_inline, target(\"avx2\"))) __m256i prefix_sum_256(__m256i elements, int last)\n"
+			"\t\t{\n"
+			"\t\tif (last < 4)\n"
+			"\t\t\treturn _mm256_castsi128_si256(prefix_sum(_mm256_castsi256_si128(elements)));\n"
+			"\n"
+			"\t\telements = _mm256_add_epi32(elements, _mm256_slli_si256(elements, 4));\n"
+			"\t\telements = _mm256_add_epi32(elements, _mm256_slli_si256(elements, 8));\n"
+			"\t\treturn _mm256_add_epi32(elements, _mm256_permute2x128_si256(_mm256_shuffle_epi32(elements, _MM_SHUFFLE(3, 3, 3, 3)), elements, 0x08));\n"
+			"\t\t}\n"
+			"\n"
+			"\t/*\n"
+			"\t\tRUNNING_SUM_256()\n"
+			"\t\t-----------------\n"
+			"\t*/\n"
+			"\t/*!\n"
+			"\t\t@brief Compute the cumulative sum of 8 integers starting from previous, then add the one at last to previous.\n"
+			"\t\t@param elements [in] The 8 integers.\n"
+			"\t\t@param previous [in, out] The running total (in all 8 lanes).\n"
+			"\t\t@param last [in] The last integer that is to be kept (the ones after it are junk).\n"
+			"\t\t@return The 8 cumulative sums.\n"
+			"\t*/\n"
+			"\tstatic inline __attribute__((always_inline, target(\"avx2\"))) __m256i running_sum_256(__m256i elements, __m256i &previous, int last)\n"
+			"\t\t{\n"
+			"\t\t__m256i sum;\n"
+			"\n"
+			"\t\telements = prefix_sum_256(elements, last);\n"
+			"\t\tsum = _mm256_add_epi32(elements, previous);\n"
+			"\t\tprevious = _mm256_add_epi32(previous, _mm256_permutevar8x32_epi32(elements, _mm256_set1_epi32(last)));\n"
+			"\t\treturn sum;\n"
+			"\t\t}\n"
+			,
+			/*
+				AVX512
+			*/
+			"\t/*\n"
+			"\t\tPREFIX_SUM_512()\n"
+			"\t\t----------------\n"
+			"\t*/\n"
+			"\t/*!\n"
+			"\t\t@brief Compute the cumulative sum of the first last + 1 of 16 integers.\n"
+			"\t\t@param elements [in] The 16 integers.\n"
+			"\t\t@param last [in] The last integer that is to be kept (the ones after it are junk), if it is in the bottom half then only that half is summed.\n"
+			"\t\t@return The cumulative sums.\n"
+			"\t*/\n"
+			"\tstatic inline __attribute__((always_inline, target(\"avx512f\"))) __m512i prefix_sum_512(__m512i elements, int last)\n"
+			"\t\t{\n"
+			"\t\t__m512i zero = _mm512_setzero_si512();\n"
+			"\n"
+			"\t\tif (last < 8)\n"
+			"\t\t\treturn _mm512_castsi256_si512(prefix_sum_256(_mm512_castsi512_si256(elements), last));\n"
+			"\n"
+			"\t\telements = _mm512_add_epi32(elements, _mm512_alignr_epi32(elements, zero, 15));\n"
+			"\t\telements = _mm512_add_epi32(elements, _mm512_alignr_epi32(elements, zero, 14));\n"
+			"\t\telements = _mm512_add_epi32(elements, _mm512_alignr_epi32(elements, zero, 12));\n"
+			"\t\treturn _mm512_add_epi32(elements, _mm512_alignr_epi32(elements, zero, 8));\n"
+			"\t\t}\n"
+			"\n"
+			"\t/*\n"
+			"\t\tRUNNING_SUM_512()\n"
+			"\t\t-----------------\n"
+			"\t*/\n"
+			"\t/*!\n"
+			"\t\t@brief Compute the cumulative sum of 16 integers starting from previous, then add the one at last to previous.\n"
+			"\t\t@param elements [in] The 16 integers.\n"
+			"\t\t@param previous [in, out] The running total (in all 16 lanes).\n"
+			"\t\t@param last [in] The last integer that is to be kept (the ones after it are junk).\n"
+			"\t\t@return The 16 cumulative sums.\n"
+			"\t*/\n"
+			"\tstatic inline __attribute__((always_inline, target(\"avx512f\"))) __m512i running_sum_512(__m512i elements, __m512i &previous, int last)\n"
+			"\t\t{\n"
+			"\t\t__m512i sum;\n"
+			"\n"
+			"\t\telements = prefix_sum_512(elements, last);\n"
+			"\t\tsum = _mm512_add_epi32(elements, previous);\n"
+			"\t\tprevious = _mm512_add_epi32(previous, _mm512_permutexvar_epi32(_mm512_set1_epi32(last), elements));\n"
+			"\t\treturn sum;\n"
+			"\t\t}\n"
+			,
+			};
+
+		printf("%s", helpers[isa]);
+		}
+
+	/*
+		MAIN()
+		------
+		This version assumes SSE4.1 and so it is *not* portable to non X86 architectures.  The AVX2 and AVX-512 decoders are compiled with
+		target attributes so that the file builds for SSE4.1 and the decoder is chosen at runtime.  Run it with the argument "compact" to
+		write the COMPACT layout rather than UNROLLED.
+	*/
+	int main(int argc, char *argv[])
+		{
+		if (argc > 1 && strcmp(argv[1], "compact") == 0)
+			laying_out = COMPACT;
+
+		printf("namespace JASS\n");
+		printf("\t{\n");
+		printf("\talignas(16) static uint32_t static_mask_21[]  = {0x1fffff, 0x1fffff, 0x1fffff, 0x1fffff};			///< AND mask for 21-bit integers\n");
+		printf("\talignas(16) static uint32_t static_mask_12[]  = {0xfff, 0xfff, 0xfff, 0xfff};							///< AND mask for 12-bit integers\n");
+		printf("\talignas(16) static uint32_t static_mask_10[] = {0x3ff, 0x3ff, 0x3ff, 0x3ff};							///< AND mask for 10-bit integers\n");
+		printf("\talignas(16) static uint32_t static_mask_9[]  = {0x1ff, 0x1ff, 0x1ff, 0x1ff};							///< AND mask for 9-bit integers\n");
+		printf("\talignas(16) static uint32_t static_mask_7[]  = {0x7f, 0x7f, 0x7f, 0x7f};								///< AND mask for 7-bit integers\n");
+		printf("\talignas(16) static uint32_t static_mask_6[]  = {0x3f, 0x3f, 0x3f, 0x3f};								///< AND mask for 6-bit integers\n");
+		printf("\talignas(16) static uint32_t static_mask_5[]  = {0x1f, 0x1f, 0x1f, 0x1f};								///< AND mask for 5-bit integers\n");
+		printf("\talignas(16) static uint32_t static_mask_4[]  = {0x0f, 0x0f, 0x0f, 0x0f};								///< AND mask for 4-bit integers\n");
+		printf("\talignas(16) static uint32_t static_mask_3[]  = {0x07, 0x07, 0x07, 0x07};								///< AND mask for 3-bit integers\n");
+		printf("\talignas(16) static uint32_t static_mask_2[]  = {0x03, 0x03, 0x03, 0x03};								///< AND mask for 2-bit integers\n");
+		printf("\talignas(16) static uint32_t static_mask_1[]  = {0x01, 0x01, 0x01, 0x01};								///< AND mask for 1-bit integers\n");
+		printf("\n");
+
+		for (instruction_set isa : {SSE41, AVX2, AVX512})
+			{
+			if (isa != SSE41)
+				printf("\n");
+			if (isa == AVX512)
+				{
+				/*
+					GCC's AVX-512 intrinsics initialise their pass-through registers from themselves (to mean "undefined") which -Wall reports thousands of times
+				*/
+				printf("#pragma GCC diagnostic push\n");
+				printf("#pragma GCC diagnostic ignored \"-Wuninitialized\"\n");
+				printf("#pragma GCC diagnostic ignored \"-Wmaybe-uninitialized\"\n");
+				}
+			generate(PLAIN, isa);
+			printf("\n");
+			generate_running_sum(isa);
+			printf("\n");
+			generate(D1, isa);
+			if (isa == AVX512)
+				printf("#pragma GCC diagnostic pop\n");
+			}
+
+		printf("\t}\n");
+
+		return 0;
+		}
+#else
+	/*
+		COMPRESS_INTEGER_QMX_IMPROVED::DECODEARRAY()
+		--------------------------------------------
+		this code is generated by the method above (run with the argument "compact").  build.rs builds and runs the generator and puts
+		its output in the build directory, so there is one source for every decoder.
+	*/
+	#include "compress_integer_qmx_improved_decoders.inc"
+#endif
@@ -33,7 +33,13 @@ namespace JASS
 		but none of the other imprivements suggested by Trotman & Lin.  This makes the encoded sequence smaller, and faster to decode, than any of the other
 		alrernatives suggested.  It does not include the code to prevent read and write overruns from the encoded string and into the decode buffer.  To account
 		for overwrites make sure the decode-into buffer is at least 256 integers larger than required.  To prevent over-reads from the encoded string make sure
-		that that string is at least 16 bytes longer than needed.
+		that 15 bytes past its end can be read: the last payload word of the 8, 16, and 32-bit selectors can be as short as one byte
+		but is loaded 16 bytes at a time, and the decoders stop at any key whose words would end further past it.  Alternatively, decode_checked() and decode_d1_checked() need neither, at the cost of
+		decoding the last few words through a local buffer.
+
+		Selector 15 (unused in the original) is a patch: it adds a 32-bit value to one of the last 256 integers decoded, so an
+		outlier can be stored in the narrow words around it rather than widening them.  The encoder only writes it when asked
+		to (use_format_version(PATCHED)), the decoders always understand it.
 		
 		At the request of Matthias Petri (University of Melbourne), the code no longer requires SIMD-word alignment to decode (the read and write 
 		instructions have been changed from aligned to unaligned since Intel made them faster).
@@ -47,13 +53,101 @@ namespace JASS
 		private:
 			uint8_t *length_buffer;					///< Stores the number of bits needed to compress each integer
 			uint64_t length_buffer_length;		///< The length of length_buffer
-			uint32_t *full_length_buffer;			///< If the run_length is too short then 0-pad into this buffer
+			uint32_t *full_length_buffer;			///< If the run_length is too short then 0-pad into this buffer (16 words of up to 256 integers then one more word of padding)
+			uint32_t *gap_buffer;					///< Stores the d-gaps computed by encode_d1()
+			uint64_t gap_buffer_length;			///< The length of gap_buffer
+			uint64_t *cost_buffer;					///< The smallest encoding (in bytes) of the integers from each 4-integer group on, for write_optimal_sequence()
+			uint8_t *choice_buffer;					///< The selector and word count that achieves it (selector << 4 | (words - 1))
+			uint64_t cost_buffer_length;			///< The length of cost_buffer and choice_buffer
+			bool optimal;								///< encode() and encode_d1() use write_optimal_sequence() rather than write_sequence()
+
+			/*!
+				@brief An integer stored in fewer bits than it needs, the rest is added back by a selector 15 (patch) key
+			*/
+			struct exception
+				{
+				size_t at;									///< Where in the sequence
+				uint32_t add;								///< What to add to the integer stored there
+				};
+			std::vector<exception> exceptions;		///< The exceptions in the sequence being encoded, in order
+			size_t next_exception;					///< The first of exceptions not yet written
 		
 		public:
 			typedef uint32_t integer; 
 			#define JASS_COMPRESS_INTEGER_BITS_PER_INTEGER 32 //the number of bits in compress_integer::integer
+			static const size_t MAX_INTEGERS_PER_KEY = 16 * 256;		///< The most integers one key can stand for (16 words of 256 0-bit integers)
+			static const uint32_t MAX_INTEGERS_PER_CALL = 256;		///< The most integers one call to decode_next() writes (one word of 0-bit integers)
+
+			/*!
+				@enum instruction_set
+				@brief The instruction sets there are kernels for, narrowest first
+			*/
+			enum instruction_set
+				{
+				SSE41 = 0,			///< 128-bit SSE4.1 (the least the library is built for)
+				AVX2 = 1,			///< 256-bit AVX2 (and LZCNT)
+				AVX512 = 2			///< 512-bit AVX-512F
+				};
+
+			/*!
+				@enum format_version
+				@brief The encodings encode() and encode_d1() can write, every decoder decodes all of them
+			*/
+			enum format_version
+				{
+				ORIGINAL = 1,		///< Selectors 0 to 14 only (so selector 15 never occurs)
+				PATCHED = 2			///< Also selector 15, which patches an outlier stored in a narrower word (see find_exceptions())
+				};
+
+			/*!
+				@brief What encode() and encode_d1() have written while collecting statistics (see collect_statistics())
+			*/
+			struct statistics
+				{
+				uint64_t sequences;				///< Sequences encoded
+				uint64_t integers;				///< Integers encoded
+				uint64_t words[16];				///< Payload words written with each selector (words[15] counts patches)
+				uint64_t payload_bytes;			///< Bytes of payload words (not counting patches)
+				uint64_t key_bytes;				///< Bytes of keys (including patch keys)
+				uint64_t patch_bytes;			///< Bytes of patches
+				uint64_t padding_integers;		///< Integers stored past the end of each sequence to fill its last word
+				uint64_t grouping_bits;			///< Bits lost to storing each group of 4 integers as wide as its widest
+				uint64_t promotion_bits;		///< Bits lost to storing groups in wider words than they need (for longer runs)
+				uint64_t tail_bits;				///< Bits lost to widening the integers in the last word of each sequence
+				};
 
 		private:
+			format_version format;					///< The encoding encode() and encode_d1() write
+			bool collecting;							///< encode() and encode_d1() add what they write to stats
+			statistics stats;							///< What has been written since collecting started (or was last reset)
+
+			/*
+				COMPRESS_INTEGER_QMX_IMPROVED::FIND_EXCEPTIONS()
+				------------------------------------------------
+			*/
+			/*!
+				@brief If the format allows, find the 4-integer groups made wide by one outlier, store the outlier's low bits, and note the rest in exceptions.
+				@details length_buffer must hold the 4-wide maximised widths, those of the groups with an exception are narrowed.
+				@param values [in, out] The integers to encode, outliers are replaced with their low bits.
+				@param source_integers [in] The number of integers.
+			*/
+			void find_exceptions(integer *values, size_t source_integers);
+
+			/*
+				COMPRESS_INTEGER_QMX_IMPROVED::WRITE_RUN()
+				------------------------------------------
+			*/
+			/*!
+				@brief write_out() a run of integers all of one width, ending a key at each word with an exception and writing its patches after it.
+				@param buffer [in, out] where to write the encoded sequence
+				@param source [in] the whole integer sequence being encoded
+				@param start [in] where in source the run starts
+				@param raw_count [in] the number of integers in the run
+				@param size_in_bits [in] the size, in bits, of each integer in the run
+				@param keys [in, out] where to write the keys
+			*/
+			void write_run(uint8_t **buffer, const integer *source, size_t start, size_t raw_count, uint32_t size_in_bits, uint8_t **keys);
+
 			/*
 				COMPRESS_INTEGER_QMX_IMPROVED::WRITE_OUT()
 				------------------------------------------
@@ -68,6 +162,149 @@ namespace JASS
 			*/
 			void write_out(uint8_t **buffer, uint32_t *source, uint32_t raw_count, uint32_t size_in_bits, uint8_t **length_buffer);
 
+			/*
+				COMPRESS_INTEGER_QMX_IMPROVED::WRITE_SEQUENCE()
+				-----------------------------------------------
+			*/
+			/*!
+				@brief Promote the (4-wide maximised) lengths in length_buffer to whole selectors then encode the sequence with them
+				@param encoded [out] The sequence of bytes that is the encoded sequence.
+				@param source [in] The sequence of integers to encode.
+				@param source_integers [in] The length (in integers) of the source buffer.
+				@return The number of bytes used to encode the integer sequence.
+			*/
+			size_t write_sequence(void *encoded, const integer *source, size_t source_integers);
+
+			/*
+				COMPRESS_INTEGER_QMX_IMPROVED::WRITE_OPTIMAL_SEQUENCE()
+				-------------------------------------------------------
+			*/
+			/*!
+				@brief write_sequence() choosing the sequence of keys (selector and 1-16 words) that minimises the encoded length.
+				@details length_buffer must hold the 4-wide maximised widths, as for write_sequence().
+				@param into_as_void [out] The encoded sequence.
+				@param source [in] The integers to encode.
+				@param source_integers [in] The number of integers to encode.
+				@return The number of bytes used to encode the integer sequence.
+			*/
+			size_t write_optimal_sequence(void *into_as_void, const integer *source, size_t source_integers);
+
+			/*
+				COMPRESS_INTEGER_QMX_IMPROVED::TALLY()
+				--------------------------------------
+			*/
+			/*!
+				@brief Add an encoded sequence to stats.
+				@param encoded [in] The encoded sequence.
+				@param encoded_length [in] Its length in bytes.
+				@param source [in] The integers it encodes (after find_exceptions()).
+				@param source_integers [in] The number of integers.
+			*/
+			void tally(const uint8_t *encoded, size_t encoded_length, const integer *source, size_t source_integers);
+
+			/*
+				COMPRESS_INTEGER_QMX_IMPROVED::DECODE_KEYS_SSE41()
+				--------------------------------------------------
+			*/
+			/*!
+				@brief decode_sse41() from the given selector to stop.
+				@param decoded [in, out] Where to write the integers, on return one past the last integer written.
+				@param end [in] One past the last integer there is room for, a key that would write past it isn't decoded.
+				@param payload [in, out] The next payload word, on return the one after the last one decoded.
+				@param selectors [in, out] The next selector (key), on return the one after the last one decoded (keys are read backwards).
+				@param stop [in] The last selector to decode (if the keys don't run out first).
+			*/
+			static void decode_keys_sse41(integer **decoded, const integer *end, const uint8_t **payload, const uint8_t **selectors, const uint8_t *stop);
+
+			/*
+				COMPRESS_INTEGER_QMX_IMPROVED::DECODE_KEYS_AVX2()
+				-------------------------------------------------
+			*/
+			/*!
+				@brief decode_avx2() from the given selector to stop.
+				@param decoded [in, out] Where to write the integers, on return one past the last integer written.
+				@param end [in] One past the last integer there is room for, a key that would write past it isn't decoded.
+				@param payload [in, out] The next payload word, on return the one after the last one decoded.
+				@param selectors [in, out] The next selector (key), on return the one after the last one decoded (keys are read backwards).
+				@param stop [in] The last selector to decode (if the keys don't run out first).
+			*/
+			static void decode_keys_avx2(integer **decoded, const integer *end, const uint8_t **payload, const uint8_t **selectors, const uint8_t *stop);
+
+			/*
+				COMPRESS_INTEGER_QMX_IMPROVED::DECODE_KEYS_AVX512()
+				---------------------------------------------------
+			*/
+			/*!
+				@brief decode_avx512() from the given selector to stop.
+				@param decoded [in, out] Where to write the integers, on return one past the last integer written.
+				@param end [in] One past the last integer there is room for, a key that would write past it isn't decoded.
+				@param payload [in, out] The next payload word, on return the one after the last one decoded.
+				@param selectors [in, out] The next selector (key), on return the one after the last one decoded (keys are read backwards).
+				@param stop [in] The last selector to decode (if the keys don't run out first).
+			*/
+			static void decode_keys_avx512(integer **decoded, const integer *end, const uint8_t **payload, const uint8_t **selectors, const uint8_t *stop);
+
+			/*
+				COMPRESS_INTEGER_QMX_IMPROVED::DECODE_D1_KEYS_SSE41()
+				-----------------------------------------------------
+			*/
+			/*!
+				@brief decode_d1_sse41() from the given selector to stop.
+				@param decoded [in, out] Where to write the integers, on return one past the last integer written.
+				@param end [in] One past the last integer there is room for, a key that would write past it isn't decoded.
+				@param payload [in, out] The next payload word, on return the one after the last one decoded.
+				@param selectors [in, out] The next selector (key), on return the one after the last one decoded (keys are read backwards).
+				@param stop [in] The last selector to decode (if the keys don't run out first).
+				@param previous [in] The value the cumulative sum starts from.
+			*/
+			static void decode_d1_keys_sse41(integer **decoded, const integer *end, const uint8_t **payload, const uint8_t **selectors, const uint8_t *stop, integer previous);
+
+			/*
+				COMPRESS_INTEGER_QMX_IMPROVED::DECODE_D1_KEYS_AVX2()
+				----------------------------------------------------
+			*/
+			/*!
+				@brief decode_d1_avx2() from the given selector to stop.
+				@param decoded [in, out] Where to write the integers, on return one past the last integer written.
+				@param end [in] One past the last integer there is room for, a key that would write past it isn't decoded.
+				@param payload [in, out] The next payload word, on return the one after the last one decoded.
+				@param selectors [in, out] The next selector (key), on return the one after the last one decoded (keys are read backwards).
+				@param stop [in] The last selector to decode (if the keys don't run out first).
+				@param previous [in] The value the cumulative sum starts from.
+			*/
+			static void decode_d1_keys_avx2(integer **decoded, const integer *end, const uint8_t **payload, const uint8_t **selectors, const uint8_t *stop, integer previous);
+
+			/*
+				COMPRESS_INTEGER_QMX_IMPROVED::DECODE_D1_KEYS_AVX512()
+				------------------------------------------------------
+			*/
+			/*!
+				@brief decode_d1_avx512() from the given selector to stop.
+				@param decoded [in, out] Where to write the integers, on return one past the last integer written.
+				@param end [in] One past the last integer there is room for, a key that would write past it isn't decoded.
+				@param payload [in, out] The next payload word, on return the one after the last one decoded.
+				@param selectors [in, out] The next selector (key), on return the one after the last one decoded (keys are read backwards).
+				@param stop [in] The last selector to decode (if the keys don't run out first).
+				@param previous [in] The value the cumulative sum starts from.
+			*/
+			static void decode_d1_keys_avx512(integer **decoded, const integer *end, const uint8_t **payload, const uint8_t **selectors, const uint8_t *stop, integer previous);
+
+			/*
+				COMPRESS_INTEGER_QMX_IMPROVED::DECODE_CHECKED_KEYS()
+				----------------------------------------------------
+			*/
+			/*!
+				@brief Decode exactly (at most) integers_to_decode integers without reading past the end of source, see decode_checked().
+				@param decoded [out] The sequence of decoded integers.
+				@param integers_to_decode [in] The number of integers decoded is at most this.
+				@param source [in] The encoded integers.
+				@param source_length [in] The length (in bytes) of the source buffer.
+				@param cumulative [in] Write the cumulative sum of the integers (as decode_d1() does) rather than the integers.
+				@param previous [in] The value the cumulative sum starts from.
+				@return The number of integers written.
+			*/
+			static size_t decode_checked_keys(integer *decoded, size_t integers_to_decode, const void *source, size_t source_length, bool cumulative, integer previous);
+
 		public:
 			/*
 				COMPRESS_INTEGER_QMX_IMPROVED::COMPRESS_INTEGER_QMX_IMPROVED()
@@ -79,7 +316,17 @@ namespace JASS
 			compress_integer_qmx_improved() :
 				length_buffer(nullptr),
 				length_buffer_length(0),
-				full_length_buffer(new uint32_t [256 * 16])
+				full_length_buffer(new uint32_t [256 * 16 + 256]),
+				gap_buffer(nullptr),
+				gap_buffer_length(0),
+				cost_buffer(nullptr),
+				choice_buffer(nullptr),
+				cost_buffer_length(0),
+				optimal(false),
+				next_exception(0),
+				format(ORIGINAL),
+				collecting(false),
+				stats()
 				{
 				/* Nothing */
 				}
@@ -95,9 +342,108 @@ namespace JASS
 				{
 				delete [] length_buffer;
 				delete [] full_length_buffer;
+				delete [] gap_buffer;
+				delete [] cost_buffer;
+				delete [] choice_buffer;
 				}
 			// virtual ~compress_integer_qmx_improved();
 
+			/*
+				COMPRESS_INTEGER_QMX_IMPROVED::SUPPORTED_INSTRUCTION_SET()
+				----------------------------------------------------------
+			*/
+			/*!
+				@brief Return the widest instruction set this CPU (and operating system) supports, according to cpuid.
+				@return The instruction set.
+			*/
+			static instruction_set supported_instruction_set(void);
+
+			/*
+				COMPRESS_INTEGER_QMX_IMPROVED::ACTIVE_INSTRUCTION_SET()
+				-------------------------------------------------------
+			*/
+			/*!
+				@brief Return the instruction set encode_d1(), decode(), and decode_d1() use.  This starts as supported_instruction_set().
+				@return The instruction set.
+			*/
+			static instruction_set active_instruction_set(void);
+
+			/*
+				COMPRESS_INTEGER_QMX_IMPROVED::USE_INSTRUCTION_SET()
+				----------------------------------------------------
+			*/
+			/*!
+				@brief Use the kernels for the given instruction set (or the widest supported, if narrower) from now on, in every thread.
+				@param requested [in] The instruction set to use.
+				@return The instruction set now in use.
+			*/
+			static instruction_set use_instruction_set(instruction_set requested);
+
+			/*
+				COMPRESS_INTEGER_QMX_IMPROVED::USE_OPTIMAL_PARTITIONING()
+				---------------------------------------------------------
+			*/
+			/*!
+				@brief Choose between the greedy selector choice (the default) and the optimal one for encode() and encode_d1().
+				@details The optimal partitioning is found by dynamic programming over the selectors and gives the smallest
+				encoding the decoder can decode, at the cost of encoding more slowly.  Either decodes with the same decoder.
+				@param on [in] true to minimise the encoded length, false for the greedy choice.
+			*/
+			void use_optimal_partitioning(bool on)
+				{
+				optimal = on;
+				}
+
+			/*
+				COMPRESS_INTEGER_QMX_IMPROVED::USE_FORMAT_VERSION()
+				---------------------------------------------------
+			*/
+			/*!
+				@brief Choose the encoding encode() and encode_d1() write.  The default is ORIGINAL, which older decoders can decode.
+				@param version [in] The format version.
+			*/
+			void use_format_version(format_version version)
+				{
+				format = version;
+				}
+
+			/*
+				COMPRESS_INTEGER_QMX_IMPROVED::COLLECT_STATISTICS()
+				---------------------------------------------------
+			*/
+			/*!
+				@brief Start (or stop) adding what encode() and encode_d1() write to get_statistics().  Off by default, as it costs a pass over each encoding.
+				@param on [in] true to collect statistics.
+			*/
+			void collect_statistics(bool on)
+				{
+				collecting = on;
+				}
+
+			/*
+				COMPRESS_INTEGER_QMX_IMPROVED::GET_STATISTICS()
+				-----------------------------------------------
+			*/
+			/*!
+				@brief Return what has been encoded while collecting statistics, since the last reset_statistics().
+			*/
+			const statistics &get_statistics(void) const
+				{
+				return stats;
+				}
+
+			/*
+				COMPRESS_INTEGER_QMX_IMPROVED::RESET_STATISTICS()
+				-------------------------------------------------
+			*/
+			/*!
+				@brief Zero the statistics.
+			*/
+			void reset_statistics(void)
+				{
+				stats = statistics();
+				}
+
 			/*
 				COMPRESS_INTEGER_QMX_IMPROVED::ENCODE()
 				---------------------------------------
@@ -112,38 +458,280 @@ namespace JASS
 			*/
 			virtual size_t encode(void *encoded, size_t encoded_buffer_length, const integer *source, size_t source_integers);
 
+			/*
+				COMPRESS_INTEGER_QMX_IMPROVED::ENCODE_D1()
+				------------------------------------------
+			*/
+			/*!
+				@brief Encode a sorted sequence of integers (docids) as d-gaps, returning the number of bytes used for the encoding.
+				@details The differencing, the bit-width classification and the 4-wide maximum are done in one SSE4.1 or AVX2 pass
+				(depending on active_instruction_set()), so the result is identical to calling encode() on the d-gaps but without
+				re-reading them.
+				@param encoded [out] The sequence of bytes that is the encoded sequence.
+				@param encoded_buffer_length [in] The length (in bytes) of the output buffer, encoded.
+				@param source [in] The sorted sequence of integers to encode.
+				@param source_integers [in] The length (in integers) of the source buffer.
+				@param previous [in] The integer before source[0], the first d-gap is source[0] - previous.
+				@return The number of bytes used to encode the integer sequence.
+			*/
+			size_t encode_d1(void *encoded, size_t encoded_buffer_length, const integer *source, size_t source_integers, integer previous = 0);
+
+			/*
+				COMPRESS_INTEGER_QMX_IMPROVED::MAX_ENCODED_LENGTH()
+				---------------------------------------------------
+			*/
+			/*!
+				@brief Return the largest number of bytes encode() can write for a sequence of the given length.
+				@details The bound is derived from the selector table: every payload word except the last is full, so the payload
+				is at most the worst bytes-per-integer ratio over all selectors plus one (padded) word, and there is at most one
+				key per payload word.
+				@param source_integers [in] The length (in integers) of the sequence to be encoded.
+				@return The worst case encoded length (in bytes).
+			*/
+			static size_t max_encoded_length(size_t source_integers);
+
 			/*
 				COMPRESS_INTEGER_QMX_IMPROVED::DECODE()
 				---------------------------------------
 			*/
 			/*!
 				@brief Decode a sequence of integers encoded with this codex.
+				@details Calls decode_avx512(), decode_avx2(), or decode_sse41() depending on active_instruction_set().
 				@param decoded [out] The sequence of decoded integers.
-				@param integers_to_decode [in] The minimum number of integers to decode (it may decode more).
+				@param integers_to_decode [in] The room (in integers) in decoded, a key whose words don't fit isn't decoded.
 				@param source [in] The encoded integers.
 				@param source_length [in] The length (in bytes) of the source buffer.
+				@return The number of integers written (the number encoded plus any padding in the last payload word), or SIZE_MAX if it stopped at a key that doesn't fit in decoded, claims more than 16 bytes past the keys, or patches before decoded[0].
 			*/
 			// virtual void decode(integer *decoded, size_t integers_to_decode, const void *source, size_t source_length);
-			void decode(integer *decoded, size_t integers_to_decode, const void *source, size_t source_length);
+			static size_t decode(integer *decoded, size_t integers_to_decode, const void *source, size_t source_length);
+
+			/*
+				COMPRESS_INTEGER_QMX_IMPROVED::DECODE_D1()
+				------------------------------------------
+			*/
+			/*!
+				@brief Decode a sequence of d-gaps encoded with this codex straight into the sequence they are the d-gaps of.
+				@details The cumulative sum is computed in registers as each set of integers is decoded, so each integer is written once.  Calls
+				decode_d1_avx512(), decode_d1_avx2(), or decode_d1_sse41() depending on active_instruction_set().
+				@param decoded [out] The sequence of decoded integers (the cumulative sum of the encoded integers).
+				@param integers_to_decode [in] The room (in integers) in decoded, a key whose words don't fit isn't decoded.
+				@param source [in] The encoded integers.
+				@param source_length [in] The length (in bytes) of the source buffer.
+				@param previous [in] The value the cumulative sum starts from (the integer before decoded[0], e.g. the last docid of the previous block).
+				@return The number of integers written (the number encoded plus any padding in the last payload word), or SIZE_MAX if it stopped at a key that doesn't fit in decoded, claims more than 16 bytes past the keys, or patches before decoded[0].
+			*/
+			static size_t decode_d1(integer *decoded, size_t integers_to_decode, const void *source, size_t source_length, integer previous = 0);
+
+			/*
+				COMPRESS_INTEGER_QMX_IMPROVED::DECODE_CHECKED()
+				-----------------------------------------------
+			*/
+			/*!
+				@brief Decode a sequence of integers encoded with this codex into a buffer of exactly integers_to_decode integers.
+				@details Unlike decode() this needs no slack after either buffer: it writes no more than integers_to_decode integers and
+				reads nothing outside source[0..source_length).  The keys that fit are decoded with the fast decoder, the last few words
+				are decoded one at a time into a local buffer and only as many integers as fit are copied out.
+				@param decoded [out] The sequence of decoded integers.
+				@param integers_to_decode [in] The length (in integers) of the decoded buffer.
+				@param source [in] The encoded integers.
+				@param source_length [in] The length (in bytes) of the source buffer.
+				@return The number of integers written (fewer than integers_to_decode only if the encoding holds fewer, counting the zero-padding of the last word).
+			*/
+			static size_t decode_checked(integer *decoded, size_t integers_to_decode, const void *source, size_t source_length);
+
+			/*
+				COMPRESS_INTEGER_QMX_IMPROVED::DECODE_D1_CHECKED()
+				--------------------------------------------------
+			*/
+			/*!
+				@brief decode_d1() into a buffer of exactly integers_to_decode integers, see decode_checked().
+				@param decoded [out] The sequence of decoded integers (the cumulative sum of the encoded integers).
+				@param integers_to_decode [in] The length (in integers) of the decoded buffer.
+				@param source [in] The encoded integers.
+				@param source_length [in] The length (in bytes) of the source buffer.
+				@param previous [in] The value the cumulative sum starts from.
+				@return The number of integers written.
+			*/
+			static size_t decode_d1_checked(integer *decoded, size_t integers_to_decode, const void *source, size_t source_length, integer previous = 0);
+
+			/*
+				COMPRESS_INTEGER_QMX_IMPROVED::DECODE_NEXT()
+				--------------------------------------------
+			*/
+			/*!
+				@brief Decode the next words of a sequence (at most MAX_INTEGERS_PER_CALL integers, and the patches after the last word of a key), for decoding a long sequence a little at a time.
+				@details Reads nothing outside source[0..source_length), the last word and part keys are decoded from a local copy.
+				@param decoded [out] The decoded integers, at least MAX_INTEGERS_PER_CALL long.
+				@param source [in] The encoded integers.
+				@param source_length [in] The length (in bytes) of the source buffer.
+				@param payload_offset [in, out] The offset of the next payload byte (0 to start), moved past what was decoded.
+				@param key_offset [in, out] The number of keys already decoded (0 to start), moved past what was decoded.
+				@param word_offset [in, out] The number of words of the next key already decoded (0 to start), moved past what was decoded.
+				@param cumulative [in] Write the cumulative sum of the integers (as decode_d1() does) rather than the integers.
+				@param previous [in] The value the cumulative sum starts from (the last integer the previous call wrote).
+				@return The number of integers written, 0 at the end of the sequence (or if it is corrupt).
+			*/
+			static size_t decode_next(integer *decoded, const void *source, size_t source_length, size_t *payload_offset, size_t *key_offset, size_t *word_offset, bool cumulative, integer previous);
+
+			/*
+				COMPRESS_INTEGER_QMX_IMPROVED::ENCODED_INTEGERS()
+				-------------------------------------------------
+			*/
+			/*!
+				@brief Return the number of integers decode() would write, from the keys alone (no payload is read).
+				@details This is the number encoded rounded up to the end of the last payload word, as the encoding doesn't record how many
+				there are.  Reads nothing outside source[0..source_length).
+				@param source [in] The encoded integers.
+				@param source_length [in] The length (in bytes) of the source buffer.
+				@return The number of integers encoded, counting the padding of the last word.
+			*/
+			static size_t encoded_integers(const void *source, size_t source_length);
+
+			/*
+				COMPRESS_INTEGER_QMX_IMPROVED::COUNT_WORDS()
+				--------------------------------------------
+			*/
+			/*!
+				@brief Count the payload words of each type a decoder read to decode integers integers, from the keys alone (for tracing).
+				@details The walk starts from the key and payload word the decoder started from, and stops at the first key past those integers
+				that isn't a patch.  Reads nothing outside source[0..source_length).
+				@param source [in] The encoded integers.
+				@param source_length [in] The length (in bytes) of the source buffer.
+				@param payload_offset [in] The offset of the first payload byte decoded (0 for the start of the sequence).
+				@param key_offset [in] The number of keys before the first one decoded (0 for the start of the sequence).
+				@param word_offset [in] The number of words of the first key decoded before (0 but for decode_next()).
+				@param integers [in] The number of integers decoded.
+				@param words_of_type [in, out] Incremented by the number of words of each of the 16 types (words_of_type[15] counts patches).
+				@return The number of bytes (payload and keys) those words take.
+			*/
+			static size_t count_words(const void *source, size_t source_length, size_t payload_offset, size_t key_offset, size_t word_offset, size_t integers, uint64_t words_of_type[16]);
+
+			/*
+				COMPRESS_INTEGER_QMX_IMPROVED::SUM()
+				------------------------------------
+			*/
+			/*!
+				@brief Return the sum of the first integers_to_sum integers encoded (as encode() encodes them, not their cumulative sum), without
+				decoding them.
+				@details Each payload word is added up in registers.  For an encode_d1() sequence this is the sum of the d-gaps, so the last integer
+				is previous plus the sum.  Reads nothing outside source[0..source_length).
+				@param source [in] The encoded integers.
+				@param source_length [in] The length (in bytes) of the source buffer.
+				@param integers_to_sum [in] The number of integers to add up (fewer are added if the encoding holds fewer).
+				@param integers_summed [out] If not nullptr, set to the number of integers actually added up.
+				@return The sum, which can't overflow.
+			*/
+			static uint64_t sum(const void *source, size_t source_length, size_t integers_to_sum, size_t *integers_summed = nullptr);
+
+			/*
+				COMPRESS_INTEGER_QMX_IMPROVED::DECODE_SSE41()
+				---------------------------------------------
+			*/
+			/*!
+				@brief decode() using 128-bit SSE4.1 registers.
+				@param decoded [out] The sequence of decoded integers.
+				@param integers_to_decode [in] The room (in integers) in decoded, a key whose words don't fit isn't decoded.
+				@param source [in] The encoded integers.
+				@param source_length [in] The length (in bytes) of the source buffer.
+				@return The number of integers written, or SIZE_MAX if it stopped at a key it can't safely decode.
+			*/
+			static size_t decode_sse41(integer *decoded, size_t integers_to_decode, const void *source, size_t source_length);
+
+			/*
+				COMPRESS_INTEGER_QMX_IMPROVED::DECODE_AVX2()
+				--------------------------------------------
+			*/
+			/*!
+				@brief decode() using 256-bit AVX2 registers (the CPU must support AVX2).
+				@param decoded [out] The sequence of decoded integers.
+				@param integers_to_decode [in] The room (in integers) in decoded, a key whose words don't fit isn't decoded.
+				@param source [in] The encoded integers.
+				@param source_length [in] The length (in bytes) of the source buffer.
+				@return The number of integers written, or SIZE_MAX if it stopped at a key it can't safely decode.
+			*/
+			static size_t decode_avx2(integer *decoded, size_t integers_to_decode, const void *source, size_t source_length);
+
+			/*
+				COMPRESS_INTEGER_QMX_IMPROVED::DECODE_AVX512()
+				----------------------------------------------
+			*/
+			/*!
+				@brief decode() using 512-bit AVX-512 registers and masked stores (the CPU must support AVX-512F).
+				@param decoded [out] The sequence of decoded integers.
+				@param integers_to_decode [in] The room (in integers) in decoded, a key whose words don't fit isn't decoded.
+				@param source [in] The encoded integers.
+				@param source_length [in] The length (in bytes) of the source buffer.
+				@return The number of integers written, or SIZE_MAX if it stopped at a key it can't safely decode.
+			*/
+			static size_t decode_avx512(integer *decoded, size_t integers_to_decode, const void *source, size_t source_length);
+
+			/*
+				COMPRESS_INTEGER_QMX_IMPROVED::DECODE_D1_SSE41()
+				------------------------------------------------
+			*/
+			/*!
+				@brief decode_d1() using 128-bit SSE4.1 registers.
+				@param decoded [out] The sequence of decoded integers (the cumulative sum of the encoded integers).
+				@param integers_to_decode [in] The room (in integers) in decoded, a key whose words don't fit isn't decoded.
+				@param source [in] The encoded integers.
+				@param source_length [in] The length (in bytes) of the source buffer.
+				@param previous [in] The value the cumulative sum starts from.
+				@return The number of integers written, or SIZE_MAX if it stopped at a key it can't safely decode.
+			*/
+			static size_t decode_d1_sse41(integer *decoded, size_t integers_to_decode, const void *source, size_t source_length, integer previous);
+
+			/*
+				COMPRESS_INTEGER_QMX_IMPROVED::DECODE_D1_AVX2()
+				-----------------------------------------------
+			*/
+			/*!
+				@brief decode_d1() using 256-bit AVX2 registers (the CPU must support AVX2).
+				@param decoded [out] The sequence of decoded integers (the cumulative sum of the encoded integers).
+				@param integers_to_decode [in] The room (in integers) in decoded, a key whose words don't fit isn't decoded.
+				@param source [in] The encoded integers.
+				@param source_length [in] The length (in bytes) of the source buffer.
+				@param previous [in] The value the cumulative sum starts from.
+				@return The number of integers written, or SIZE_MAX if it stopped at a key it can't safely decode.
+			*/
+			static size_t decode_d1_avx2(integer *decoded, size_t integers_to_decode, const void *source, size_t source_length, integer previous);
+
+			/*
+				COMPRESS_INTEGER_QMX_IMPROVED::DECODE_D1_AVX512()
+				-------------------------------------------------
+			*/
+			/*!
+				@brief decode_d1() using 512-bit AVX-512 registers and masked stores (the CPU must support AVX-512F).
+				@param decoded [out] The sequence of decoded integers (the cumulative sum of the encoded integers).
+				@param integers_to_decode [in] The room (in integers) in decoded, a key whose words don't fit isn't decoded.
+				@param source [in] The encoded integers.
+				@param source_length [in] The length (in bytes) of the source buffer.
+				@param previous [in] The value the cumulative sum starts from.
+				@return The number of integers written, or SIZE_MAX if it stopped at a key it can't safely decode.
+			*/
+			static size_t decode_d1_avx512(integer *decoded, size_t integers_to_decode, const void *source, size_t source_length, integer previous);
 
 			/*
 				COMPRESS_INTEGER_QMX_IMPROVED::UNITTEST_ONE()
 				---------------------------------------------
 			*/
 			/*!
-				@brief Test one sequence to make sure it encodes and decodes to the same thing.  Assert if not.
-				@param sequence [in] the sequernce to encode.
+				@brief Test one sequence to make sure every encoder mode and every decoder (under every instruction set the CPU has) agree on it.
+				@details Each disagreement is reported on stderr.  This switches the instruction set of every thread while it runs, and puts it back after.
+				@param sequence [in] the sequence to encode.
+				@return true if they all agree.
 			*/
-			static void unittest_one(const std::vector<uint32_t> &sequence);
+			static bool unittest_one(const std::vector<uint32_t> &sequence);
 
 			/*
 				COMPRESS_INTEGER_QMX_IMPROVED::UNITTEST()
 				-----------------------------------------
 			*/
 			/*!
-				@brief Unit test this class
+				@brief Unit test this class with unittest_one() on the sequences most likely to break it (see the .cpp file).
+				@return true if every sequence passes.
 			*/
-			static void unittest(void);
+			static bool unittest(void);
 		};
 
 	}
@@ -1,33 +1,111 @@
 // #include <stdint.h>
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
 #include <emmintrin.h>
 #include <smmintrin.h>
 #include <immintrin.h>
+#ifdef QMX_TRACE
+	#include <x86intrin.h>
+#endif
 #include "compress_integer_qmx_improved.h"
 
 extern "C" {
 
-    alignas(16) static uint32_t static_mask_21[]  = {0x1fffff, 0x1fffff, 0x1fffff, 0x1fffff};			    ///< AND mask for 21-bit integers
-	alignas(16) static uint32_t static_mask_12[]  = {0xfff, 0xfff, 0xfff, 0xfff};							///< AND mask for 12-bit integers
-	alignas(16) static uint32_t static_mask_10[] = {0x3ff, 0x3ff, 0x3ff, 0x3ff};							///< AND mask for 10-bit integers
-	alignas(16) static uint32_t static_mask_9[]  = {0x1ff, 0x1ff, 0x1ff, 0x1ff};							///< AND mask for 9-bit integers
-	alignas(16) static uint32_t static_mask_7[]  = {0x7f, 0x7f, 0x7f, 0x7f};								///< AND mask for 7-bit integers
-	alignas(16) static uint32_t static_mask_6[]  = {0x3f, 0x3f, 0x3f, 0x3f};								///< AND mask for 6-bit integers
-	alignas(16) static uint32_t static_mask_5[]  = {0x1f, 0x1f, 0x1f, 0x1f};								///< AND mask for 5-bit integers
-	alignas(16) static uint32_t static_mask_4[]  = {0x0f, 0x0f, 0x0f, 0x0f};								///< AND mask for 4-bit integers
-	alignas(16) static uint32_t static_mask_3[]  = {0x07, 0x07, 0x07, 0x07};								///< AND mask for 3-bit integers
-	alignas(16) static uint32_t static_mask_2[]  = {0x03, 0x03, 0x03, 0x03};								///< AND mask for 2-bit integers
-	alignas(16) static uint32_t static_mask_1[]  = {0x01, 0x01, 0x01, 0x01};								///< AND mask for 1-bit integers
+#ifdef QMX_TRACE
+	/*!
+		@brief The kernels whose calls are traced, in the order of qmx_trace_counters::kernels.
+	*/
+	enum qmx_trace_kernel
+		{
+		QMX_TRACE_DECODE,				///< qmx_decode()
+		QMX_TRACE_DECODE_D1,			///< qmx_decode_d1(), the decoder and cumulative sum fused
+		QMX_TRACE_DECODE_CHECKED,		///< qmx_decode_checked()
+		QMX_TRACE_DECODE_D1_CHECKED,	///< qmx_decode_d1_checked()
+		QMX_TRACE_DECODE_NEXT,			///< qmx_decode_next(), both plain and cumulative
+		QMX_TRACE_SUM,					///< qmx_sum()
+		QMX_TRACE_KERNELS
+		};
+
+	/*!
+		@brief What the calls to one kernel have done.
+	*/
+	struct qmx_trace_calls
+		{
+		uint64_t calls;					///< Calls made
+		uint64_t integers;				///< Integers written (or, by qmx_sum(), added up)
+		uint64_t bytes;					///< Bytes of payload and keys read
+		uint64_t cycles;				///< Time in the kernel, in time stamp counter ticks
+		};
+
+	/*!
+		@brief The trace counters of one thread.
+	*/
+	struct qmx_trace_counters
+		{
+		qmx_trace_calls kernels[QMX_TRACE_KERNELS];	///< The calls to each kernel
+		uint64_t words[16];							///< The payload words of each type decoded (words[15] counts patches)
+		};
+
+	static thread_local qmx_trace_counters trace;
+
+	/*!
+		@brief Read the time stamp counter.
+	*/
+	static inline uint64_t trace_clock(void){
+		return __rdtsc();
+	}
+
+	/*!
+		@brief Count a call to kernel, which started at start and wrote integers integers.
+	*/
+	static void trace_call(qmx_trace_kernel kernel, uint64_t start, size_t integers){
+		qmx_trace_calls &counters = trace.kernels[kernel];
+		counters.cycles += trace_clock() - start;
+		counters.calls++;
+		counters.integers += integers;
+	}
+
+	/*!
+		@brief Count a call to a decoder that started at start and decoded integers integers of source from the given payload, key and word offsets.
+	*/
+	static void trace_decode(qmx_trace_kernel kernel, uint64_t start, const uint8_t *source, size_t len, size_t payload_offset, size_t key_offset, size_t word_offset, size_t integers){
+		trace_call(kernel, start, integers);
+		trace.kernels[kernel].bytes += JASS::compress_integer_qmx_improved::count_words(source, len, payload_offset, key_offset, word_offset, integers, trace.words);
+	}
+
+	/*!
+		@brief Copy out the trace counters of the calling thread.
+		@param counters [out] The counters.
+	*/
+	void qmx_trace(qmx_trace_counters *counters){
+		*counters = trace;
+	}
+
+	/*!
+		@brief Zero the trace counters of the calling thread.
+	*/
+	void qmx_reset_trace(void){
+		trace = qmx_trace_counters();
+	}
+
+	#define TRACE_START uint64_t trace_start = trace_clock()
+	#define TRACE_DECODE(kernel, source, len, integers) trace_decode(kernel, trace_start, source, len, 0, 0, 0, integers)
+#else
+	/*
+		Built without QMX_TRACE the tracing costs nothing
+	*/
+	#define TRACE_START
+	#define TRACE_DECODE(kernel, source, len, integers)
+#endif
 
-   
 	/*!
 		@brief Calculate the cumulative sum of the 32-bit integers in an AVX2 register.
 		@param elements [in] The 32-bit integers.
 		@return An AVX2 register holding the cumulative sums.
 	*/
     #define forceinline __attribute__((always_inline)) inline
-	forceinline static __m256i cumulative_sum(__m256i elements)
+	__attribute__((target("avx2"))) forceinline static __m256i cumulative_sum(__m256i elements)
 				{
 				/*
 					shift left by 1 integer and add
@@ -64,7 +142,7 @@ extern "C" {
 				return answer;
 				}
     // static void cumulative_sum_256(uint32_t *data, size_t length)
-    void cumulative_sum_256(uint32_t *data, size_t length){
+    __attribute__((target("avx2"))) static void cumulative_sum_256_avx2(uint32_t *data, size_t length){
 		/*
 			previous cumulative sum is zero
 		*/
@@ -99,6 +177,226 @@ extern "C" {
 		}
 	}
 
+	/*!
+		@brief Replace data with its cumulative sum, in place, 4 integers at a time (with SSE4.1).
+		@param data [in, out] The integers.
+		@param length [in] The number of integers.
+	*/
+    static void cumulative_sum_128(uint32_t *data, size_t length){
+        __m128i previous = _mm_setzero_si128();
+        size_t current = 0;
+        for (; current + 4 <= length; current += 4){
+            __m128i elements = _mm_loadu_si128((__m128i *)(data + current));
+            elements = _mm_add_epi32(elements, _mm_slli_si128(elements, 4));
+            elements = _mm_add_epi32(elements, _mm_slli_si128(elements, 8));
+            elements = _mm_add_epi32(elements, previous);
+            _mm_storeu_si128((__m128i *)(data + current), elements);
+            previous = _mm_shuffle_epi32(elements, _MM_SHUFFLE(3, 3, 3, 3));
+        }
+
+        uint32_t sum = _mm_cvtsi128_si32(previous);
+        for (; current < length; current++)
+            data[current] = sum += data[current];
+    }
+
+	/*!
+		@brief Replace data with its cumulative sum, in place (using AVX2 if the CPU has it).
+		@param data [in, out] The integers.
+		@param length [in] The number of integers (with AVX2 this is rounded up to a multiple of 8).
+	*/
+    void cumulative_sum_256(uint32_t *data, size_t length){
+        if (JASS::compress_integer_qmx_improved::active_instruction_set() >= JASS::compress_integer_qmx_improved::AVX2){
+            cumulative_sum_256_avx2(data, length);
+            return;
+        }
+
+        cumulative_sum_128(data, length);
+    }
+
+	/*!
+		@brief Shuffle controls that move the lanes of a vector selected by a bitmask to its front, for writing out matches.
+	*/
+	struct compaction_tables
+		{
+		alignas(16) uint8_t sse[16][16];			///< pshufb controls for the 4-lane masks
+		alignas(32) uint32_t avx[256][8];			///< permutevar8x32 controls for the 8-lane masks
+
+		compaction_tables()
+			{
+			for (uint32_t mask = 0; mask < 256; mask++)
+				{
+				uint32_t to = 0;
+				for (uint32_t lane = 0; lane < 8; lane++)
+					if (mask & (1 << lane))
+						avx[mask][to++] = lane;
+				while (to < 8)
+					avx[mask][to++] = 0;
+				}
+			for (uint32_t mask = 0; mask < 16; mask++)
+				{
+				uint32_t to = 0;
+				for (uint32_t lane = 0; lane < 4; lane++)
+					if (mask & (1 << lane))
+						for (uint32_t byte = 0; byte < 4; byte++)
+							sse[mask][to++] = lane * 4 + byte;
+				while (to < 16)
+					sse[mask][to++] = 0x80;
+				}
+			}
+		};
+	static const compaction_tables compaction;
+
+	/*!
+		@brief Intersect the rest of two sorted lists one integer at a time.
+		@return The number of integers written to out.
+	*/
+	static size_t intersect_scalar(const uint32_t *a, const uint32_t *a_end, const uint32_t *b, const uint32_t *b_end, uint32_t *out){
+		uint32_t *start = out;
+		while (a < a_end && b < b_end){
+			if (*a < *b)
+				a++;
+			else if (*b < *a)
+				b++;
+			else {
+				*out++ = *a;
+				a++;
+				b++;
+			}
+		}
+		return out - start;
+	}
+
+	/*!
+		@brief Intersect two strictly increasing lists 4 integers of each at a time: compare all 16 pairs, write out the
+		integers of a that matched, and move on through whichever list has the smaller largest integer (or both).
+		@return The number of integers written to out.
+	*/
+	static size_t intersect_sse41(const uint32_t *a, size_t a_length, const uint32_t *b, size_t b_length, uint32_t *out){
+		const uint32_t *a_end = a + a_length, *b_end = b + b_length;
+		const uint32_t *a_stop = a + (a_length & ~(size_t)3), *b_stop = b + (b_length & ~(size_t)3);
+		uint32_t *start = out;
+
+		while (a < a_stop && b < b_stop){
+			__m128i from_a = _mm_loadu_si128((__m128i *)a);
+			__m128i from_b = _mm_loadu_si128((__m128i *)b);
+
+			__m128i matches = _mm_cmpeq_epi32(from_a, from_b);
+			from_b = _mm_shuffle_epi32(from_b, _MM_SHUFFLE(0, 3, 2, 1));
+			matches = _mm_or_si128(matches, _mm_cmpeq_epi32(from_a, from_b));
+			from_b = _mm_shuffle_epi32(from_b, _MM_SHUFFLE(0, 3, 2, 1));
+			matches = _mm_or_si128(matches, _mm_cmpeq_epi32(from_a, from_b));
+			from_b = _mm_shuffle_epi32(from_b, _MM_SHUFFLE(0, 3, 2, 1));
+			matches = _mm_or_si128(matches, _mm_cmpeq_epi32(from_a, from_b));
+
+			int mask = _mm_movemask_ps(_mm_castsi128_ps(matches));
+			_mm_storeu_si128((__m128i *)out, _mm_shuffle_epi8(from_a, _mm_load_si128((const __m128i *)compaction.sse[mask])));
+			out += __builtin_popcount(mask);
+
+			uint32_t a_largest = a[3], b_largest = b[3];
+			a += a_largest <= b_largest ? 4 : 0;
+			b += b_largest <= a_largest ? 4 : 0;
+		}
+
+		return (out - start) + intersect_scalar(a, a_end, b, b_end, out);
+	}
+
+	/*!
+		@brief intersect_sse41() 8 integers of each at a time (comparing all 64 pairs by rotating b through a 256-bit register).
+		@return The number of integers written to out.
+	*/
+	__attribute__((target("avx2,popcnt"))) static size_t intersect_avx2(const uint32_t *a, size_t a_length, const uint32_t *b, size_t b_length, uint32_t *out){
+		const uint32_t *a_end = a + a_length, *b_end = b + b_length;
+		const uint32_t *a_stop = a + (a_length & ~(size_t)7), *b_stop = b + (b_length & ~(size_t)7);
+		const __m256i rotate = _mm256_setr_epi32(1, 2, 3, 4, 5, 6, 7, 0);
+		uint32_t *start = out;
+
+		while (a < a_stop && b < b_stop){
+			__m256i from_a = _mm256_loadu_si256((__m256i *)a);
+			__m256i from_b = _mm256_loadu_si256((__m256i *)b);
+
+			__m256i matches = _mm256_cmpeq_epi32(from_a, from_b);
+			for (int rotation = 1; rotation < 8; rotation++){
+				from_b = _mm256_permutevar8x32_epi32(from_b, rotate);
+				matches = _mm256_or_si256(matches, _mm256_cmpeq_epi32(from_a, from_b));
+			}
+
+			int mask = _mm256_movemask_ps(_mm256_castsi256_ps(matches));
+			_mm256_storeu_si256((__m256i *)out, _mm256_permutevar8x32_epi32(from_a, _mm256_load_si256((const __m256i *)compaction.avx[mask])));
+			out += __builtin_popcount(mask);
+
+			uint32_t a_largest = a[7], b_largest = b[7];
+			a += a_largest <= b_largest ? 8 : 0;
+			b += b_largest <= a_largest ? 8 : 0;
+		}
+
+		return (out - start) + intersect_sse41(a, a_end - a, b, b_end - b, out);
+	}
+
+	/*!
+		@brief Intersect two strictly increasing lists (e.g. of docids).
+		@param a [in] The first list.
+		@param a_length [in] Its length.
+		@param b [in] The second list.
+		@param b_length [in] Its length.
+		@param out [out] The integers in both, room for the shorter list's length plus 8 (the kernels write whole vectors).
+		@return The number of integers written to out.
+	*/
+	size_t qmx_intersect(const uint32_t *a, size_t a_length, const uint32_t *b, size_t b_length, uint32_t *out){
+		if (JASS::compress_integer_qmx_improved::active_instruction_set() >= JASS::compress_integer_qmx_improved::AVX2)
+			return intersect_avx2(a, a_length, b, b_length, out);
+		return intersect_sse41(a, a_length, b, b_length, out);
+	}
+
+	/*!
+		@brief Merge two strictly increasing lists (e.g. of docids) keeping one of each integer in both.
+		@param a [in] The first list.
+		@param a_length [in] Its length.
+		@param b [in] The second list.
+		@param b_length [in] Its length.
+		@param out [out] The integers in either, room for a_length + b_length of them.
+		@return The number of integers written to out.
+	*/
+	size_t qmx_union(const uint32_t *a, size_t a_length, const uint32_t *b, size_t b_length, uint32_t *out){
+		const uint32_t *a_end = a + a_length, *b_end = b + b_length;
+		uint32_t *start = out;
+
+		/*
+			Branch-free: write the smaller and step past it in both lists (both when they match)
+		*/
+		while (a < a_end && b < b_end){
+			uint32_t from_a = *a, from_b = *b;
+			*out++ = from_a < from_b ? from_a : from_b;
+			a += from_a <= from_b;
+			b += from_b <= from_a;
+		}
+		memcpy(out, a, (a_end - a) * sizeof(*a));
+		out += a_end - a;
+		memcpy(out, b, (b_end - b) * sizeof(*b));
+		out += b_end - b;
+
+		return out - start;
+	}
+
+    /*!
+        @brief Return the instruction set the kernels are using (0 = SSE4.1, 1 = AVX2, 2 = AVX-512).
+    */
+    int qmx_instruction_set(void){
+        return JASS::compress_integer_qmx_improved::active_instruction_set();
+    }
+
+    /*!
+        @brief Use the kernels for the given instruction set, or the widest this CPU supports if that is narrower.
+        @param requested [in] The instruction set (0 = SSE4.1, 1 = AVX2, 2 = AVX-512).
+        @return The instruction set now in use.
+    */
+    int qmx_use_instruction_set(int requested){
+        if (requested < JASS::compress_integer_qmx_improved::SSE41)
+            requested = JASS::compress_integer_qmx_improved::SSE41;
+        else if (requested > JASS::compress_integer_qmx_improved::AVX512)
+            requested = JASS::compress_integer_qmx_improved::AVX512;
+        return JASS::compress_integer_qmx_improved::use_instruction_set((JASS::compress_integer_qmx_improved::instruction_set)requested);
+    }
+
     /*!
         @brief Constructor
     */
@@ -110,6 +408,44 @@ extern "C" {
         delete ((JASS::compress_integer_qmx_improved *) self);
     }
 
+    /*!
+	    @brief Choose between the greedy (the default) and the optimal (smallest, but slower to encode) choice of selectors.
+	    @param on [in] Non-zero for the optimal choice.
+	*/
+    void qmx_use_optimal_partitioning(void *self, int on) {
+        ((JASS::compress_integer_qmx_improved *)self)->use_optimal_partitioning(on != 0);
+    }
+
+    /*!
+	    @brief Choose the encoding the encoder writes (every decoder decodes both).
+	    @param version [in] 1 for the original selectors only, 2 to also patch outliers with selector 15.
+	*/
+    void qmx_use_format_version(void *self, int version) {
+        ((JASS::compress_integer_qmx_improved *)self)->use_format_version(version >= JASS::compress_integer_qmx_improved::PATCHED ? JASS::compress_integer_qmx_improved::PATCHED : JASS::compress_integer_qmx_improved::ORIGINAL);
+    }
+
+    /*!
+	    @brief Start (on != 0) or stop adding what the encoder writes to its statistics, see qmx_statistics().
+	*/
+    void qmx_collect_statistics(void *self, int on) {
+        ((JASS::compress_integer_qmx_improved *)self)->collect_statistics(on != 0);
+    }
+
+    /*!
+	    @brief Copy out what the encoder has written while collecting statistics (since the last qmx_reset_statistics()).
+	    @param statistics [out] The statistics.
+	*/
+    void qmx_statistics(const void *self, JASS::compress_integer_qmx_improved::statistics *statistics) {
+        *statistics = ((const JASS::compress_integer_qmx_improved *)self)->get_statistics();
+    }
+
+    /*!
+	    @brief Zero the encoder's statistics.
+	*/
+    void qmx_reset_statistics(void *self) {
+        ((JASS::compress_integer_qmx_improved *)self)->reset_statistics();
+    }
+
     /*!
 	    @brief Encode a sequence of integers returning the number of bytes used for the encoding, or 0 if the encoded sequence doesn't fit in the buffer.
 	    @param encoded [out] The sequence of bytes that is the encoded sequence.
@@ -123,5346 +459,284 @@ extern "C" {
     }
 
     /*!
-		@brief Decode a sequence of integers encoded with this codex.
+	    @brief Encode a sorted sequence of integers as d-gaps, differencing and classifying them in one pass.
+	    @param encoded [out] The sequence of bytes that is the encoded sequence.
+	    @param encoded_buffer_length [in] The length (in bytes) of the output buffer, encoded.
+	    @param source [in] The sorted sequence of integers to encode.
+	    @param source_integers [in] The length (in integers) of the source buffer.
+	    @param previous [in] The integer before source[0] (0 for the start of a list).
+	    @return The number of bytes used to encode the integer sequence.
+	*/
+    size_t qmx_encode_d1(void *self, uint8_t *encoded, size_t encoded_buffer_length, const uint32_t *source, size_t source_integers, uint32_t previous) {
+        return ((JASS::compress_integer_qmx_improved *)self)->encode_d1(encoded, encoded_buffer_length, source, source_integers, previous);
+    }
+
+    /*!
+	    @brief Return the largest number of bytes qmx_encode() can write for a sequence of the given length.
+	    @param source_integers [in] The length (in integers) of the sequence to be encoded.
+	    @return The worst case encoded length (in bytes).
+	*/
+    size_t qmx_max_encoded_length(size_t source_integers) {
+        return JASS::compress_integer_qmx_improved::max_encoded_length(source_integers);
+    }
+
+    /*!
+	    @brief Return the largest number of bytes qmx_encode_d1_batch() can write for sequences of the given lengths.
+	    @param lengths [in] The length (in integers) of each of the sequences.
+	    @param list_count [in] The number of sequences.
+	    @return The worst case encoded length (in bytes) of all the sequences together.
+	*/
+    size_t qmx_max_encoded_length_batch(const size_t *lengths, size_t list_count) {
+        size_t needed = 0;
+        for (size_t list = 0; list < list_count; list++)
+            needed += JASS::compress_integer_qmx_improved::max_encoded_length(lengths[list]);
+        return needed;
+    }
+
+    /*!
+	    @brief Encode many sorted sequences (each as d-gaps from 0) back to back into one buffer using one encoder.
+	    @param encoded [out] The encoded sequences, one after the other.
+	    @param encoded_buffer_length [in] The length (in bytes) of encoded, at least qmx_max_encoded_length_batch() of the lengths.
+	    @param lists [in] The sorted sequences of integers to encode.
+	    @param lengths [in] The length (in integers) of each of the sequences.
+	    @param list_count [in] The number of sequences.
+	    @param offsets [out] list_count + 1 offsets into encoded, sequence i is encoded[offsets[i]] to encoded[offsets[i + 1] - 1].
+	    @return The number of bytes used to encode all the sequences, or 0 if encoded is too short.
+	*/
+    size_t qmx_encode_d1_batch(void *self, uint8_t *encoded, size_t encoded_buffer_length, const uint32_t *const *lists, const size_t *lengths, size_t list_count, size_t *offsets) {
+        JASS::compress_integer_qmx_improved *encoder = (JASS::compress_integer_qmx_improved *)self;
+
+        if (encoded_buffer_length < qmx_max_encoded_length_batch(lengths, list_count))
+            return 0;
+
+        size_t used = 0;
+        for (size_t list = 0; list < list_count; list++) {
+            offsets[list] = used;
+            used += encoder->encode_d1(encoded + used, encoded_buffer_length - used, lists[list], lengths[list], 0);
+        }
+        offsets[list_count] = used;
+
+        return used;
+    }
+
+    /*!
+		@brief Decode a sequence of d-gaps straight into the sequence they are the d-gaps of (i.e. qmx_decode() and cumulative_sum_256() in one pass).
 		@param to [out] The sequence of decoded integers.
-		@param destination_integers [in] The minimum number of integers to decode (it may decode more).
+		@param destination_integers [in] The room (in integers) in to, a key whose words don't fit isn't decoded.
+		@param source [in] The encoded integers, followed by 15 bytes that can be read.
+		@param len [in] The length (in bytes) of the source buffer.
+		@param previous [in] The value the cumulative sum starts from (0 for the start of a list).
+		@return The number of integers written (the number encoded plus the padding in the last payload word), or SIZE_MAX if
+		a key doesn't fit in to, claims words past the slack, or patches before to[0] (it stops before that key).
+	*/
+    size_t qmx_decode_d1(uint32_t *to, size_t destination_integers, const uint8_t *source, size_t len, uint32_t previous){
+        TRACE_START;
+        size_t written = JASS::compress_integer_qmx_improved::decode_d1(to, destination_integers, source, len, previous);
+        TRACE_DECODE(QMX_TRACE_DECODE_D1, source, len, written == SIZE_MAX ? 0 : written);
+        return written;
+    }
+
+    /*!
+		@brief Decode exactly destination_integers integers without reading or writing outside either buffer (no slack needed).
+		@param to [out] The sequence of decoded integers, destination_integers long.
+		@param destination_integers [in] The number of integers to decode.
 		@param source [in] The encoded integers.
 		@param len [in] The length (in bytes) of the source buffer.
+		@return The number of integers written.
 	*/
-    void qmx_decode(uint32_t *to, size_t destination_integers, const uint8_t *source, size_t len){
-		__m128i byte_stream, byte_stream_2, tmp, tmp2, mask_21, mask_12, mask_10, mask_9, mask_7, mask_6, mask_5, mask_4, mask_3, mask_2, mask_1;
-		uint8_t *in = (uint8_t *)source;
-		uint8_t *keys = ((uint8_t *)source) + len - 1;
+    size_t qmx_decode_checked(uint32_t *to, size_t destination_integers, const uint8_t *source, size_t len){
+        TRACE_START;
+        size_t written = JASS::compress_integer_qmx_improved::decode_checked(to, destination_integers, source, len);
+        TRACE_DECODE(QMX_TRACE_DECODE_CHECKED, source, len, written);
+        return written;
+    }
 
-		mask_21 = _mm_loadu_si128((__m128i *)static_mask_21);
-		mask_12 = _mm_loadu_si128((__m128i *)static_mask_12);
-		mask_10 = _mm_loadu_si128((__m128i *)static_mask_10);
-		mask_9 = _mm_loadu_si128((__m128i *)static_mask_9);
-		mask_7 = _mm_loadu_si128((__m128i *)static_mask_7);
-		mask_6 = _mm_loadu_si128((__m128i *)static_mask_6);
-		mask_5 = _mm_loadu_si128((__m128i *)static_mask_5);
-		mask_4 = _mm_loadu_si128((__m128i *)static_mask_4);
-		mask_3 = _mm_loadu_si128((__m128i *)static_mask_3);
-		mask_2 = _mm_loadu_si128((__m128i *)static_mask_2);
-		mask_1 = _mm_loadu_si128((__m128i *)static_mask_1);
+    /*!
+		@brief qmx_decode_d1() without reading or writing outside either buffer (no slack needed).
+		@param to [out] The sequence of decoded integers, destination_integers long.
+		@param destination_integers [in] The number of integers to decode.
+		@param source [in] The encoded integers.
+		@param len [in] The length (in bytes) of the source buffer.
+		@param previous [in] The value the cumulative sum starts from (0 for the start of a list).
+		@return The number of integers written.
+	*/
+    size_t qmx_decode_d1_checked(uint32_t *to, size_t destination_integers, const uint8_t *source, size_t len, uint32_t previous){
+        TRACE_START;
+        size_t written = JASS::compress_integer_qmx_improved::decode_d1_checked(to, destination_integers, source, len, previous);
+        TRACE_DECODE(QMX_TRACE_DECODE_D1_CHECKED, source, len, written);
+        return written;
+    }
 
-		while (in <= keys)                      // <= because there can be a boundary case where the final key is 255*0 bit integers
-			{
-			switch (*keys--)
-				{
-				case 0x00:
-					tmp = _mm_loadu_si128((__m128i *)static_mask_1);
-					_mm_storeu_si128((__m128i *)to, tmp);
-					_mm_storeu_si128((__m128i *)to + 1, tmp);
-					_mm_storeu_si128((__m128i *)to + 2, tmp);
-					_mm_storeu_si128((__m128i *)to + 3, tmp);
-					_mm_storeu_si128((__m128i *)to + 4, tmp);
-					_mm_storeu_si128((__m128i *)to + 5, tmp);
-					_mm_storeu_si128((__m128i *)to + 6, tmp);
-					_mm_storeu_si128((__m128i *)to + 7, tmp);
-					_mm_storeu_si128((__m128i *)to + 8, tmp);
-					_mm_storeu_si128((__m128i *)to + 9, tmp);
-					_mm_storeu_si128((__m128i *)to + 10, tmp);
-					_mm_storeu_si128((__m128i *)to + 11, tmp);
-					_mm_storeu_si128((__m128i *)to + 12, tmp);
-					_mm_storeu_si128((__m128i *)to + 13, tmp);
-					_mm_storeu_si128((__m128i *)to + 14, tmp);
-					_mm_storeu_si128((__m128i *)to + 15, tmp);
-					_mm_storeu_si128((__m128i *)to + 16, tmp);
-					_mm_storeu_si128((__m128i *)to + 17, tmp);
-					_mm_storeu_si128((__m128i *)to + 18, tmp);
-					_mm_storeu_si128((__m128i *)to + 19, tmp);
-					_mm_storeu_si128((__m128i *)to + 20, tmp);
-					_mm_storeu_si128((__m128i *)to + 21, tmp);
-					_mm_storeu_si128((__m128i *)to + 22, tmp);
-					_mm_storeu_si128((__m128i *)to + 23, tmp);
-					_mm_storeu_si128((__m128i *)to + 24, tmp);
-					_mm_storeu_si128((__m128i *)to + 25, tmp);
-					_mm_storeu_si128((__m128i *)to + 26, tmp);
-					_mm_storeu_si128((__m128i *)to + 27, tmp);
-					_mm_storeu_si128((__m128i *)to + 28, tmp);
-					_mm_storeu_si128((__m128i *)to + 29, tmp);
-					_mm_storeu_si128((__m128i *)to + 30, tmp);
-					_mm_storeu_si128((__m128i *)to + 31, tmp);
-					_mm_storeu_si128((__m128i *)to + 32, tmp);
-					_mm_storeu_si128((__m128i *)to + 33, tmp);
-					_mm_storeu_si128((__m128i *)to + 34, tmp);
-					_mm_storeu_si128((__m128i *)to + 35, tmp);
-					_mm_storeu_si128((__m128i *)to + 36, tmp);
-					_mm_storeu_si128((__m128i *)to + 37, tmp);
-					_mm_storeu_si128((__m128i *)to + 38, tmp);
-					_mm_storeu_si128((__m128i *)to + 39, tmp);
-					_mm_storeu_si128((__m128i *)to + 40, tmp);
-					_mm_storeu_si128((__m128i *)to + 41, tmp);
-					_mm_storeu_si128((__m128i *)to + 42, tmp);
-					_mm_storeu_si128((__m128i *)to + 43, tmp);
-					_mm_storeu_si128((__m128i *)to + 44, tmp);
-					_mm_storeu_si128((__m128i *)to + 45, tmp);
-					_mm_storeu_si128((__m128i *)to + 46, tmp);
-					_mm_storeu_si128((__m128i *)to + 47, tmp);
-					_mm_storeu_si128((__m128i *)to + 48, tmp);
-					_mm_storeu_si128((__m128i *)to + 49, tmp);
-					_mm_storeu_si128((__m128i *)to + 50, tmp);
-					_mm_storeu_si128((__m128i *)to + 51, tmp);
-					_mm_storeu_si128((__m128i *)to + 52, tmp);
-					_mm_storeu_si128((__m128i *)to + 53, tmp);
-					_mm_storeu_si128((__m128i *)to + 54, tmp);
-					_mm_storeu_si128((__m128i *)to + 55, tmp);
-					_mm_storeu_si128((__m128i *)to + 56, tmp);
-					_mm_storeu_si128((__m128i *)to + 57, tmp);
-					_mm_storeu_si128((__m128i *)to + 58, tmp);
-					_mm_storeu_si128((__m128i *)to + 59, tmp);
-					_mm_storeu_si128((__m128i *)to + 60, tmp);
-					_mm_storeu_si128((__m128i *)to + 61, tmp);
-					_mm_storeu_si128((__m128i *)to + 62, tmp);
-					_mm_storeu_si128((__m128i *)to + 63, tmp);
-					to += 256;
-				case 0x01:
-					tmp = _mm_loadu_si128((__m128i *)static_mask_1);
-					_mm_storeu_si128((__m128i *)to, tmp);
-					_mm_storeu_si128((__m128i *)to + 1, tmp);
-					_mm_storeu_si128((__m128i *)to + 2, tmp);
-					_mm_storeu_si128((__m128i *)to + 3, tmp);
-					_mm_storeu_si128((__m128i *)to + 4, tmp);
-					_mm_storeu_si128((__m128i *)to + 5, tmp);
-					_mm_storeu_si128((__m128i *)to + 6, tmp);
-					_mm_storeu_si128((__m128i *)to + 7, tmp);
-					_mm_storeu_si128((__m128i *)to + 8, tmp);
-					_mm_storeu_si128((__m128i *)to + 9, tmp);
-					_mm_storeu_si128((__m128i *)to + 10, tmp);
-					_mm_storeu_si128((__m128i *)to + 11, tmp);
-					_mm_storeu_si128((__m128i *)to + 12, tmp);
-					_mm_storeu_si128((__m128i *)to + 13, tmp);
-					_mm_storeu_si128((__m128i *)to + 14, tmp);
-					_mm_storeu_si128((__m128i *)to + 15, tmp);
-					_mm_storeu_si128((__m128i *)to + 16, tmp);
-					_mm_storeu_si128((__m128i *)to + 17, tmp);
-					_mm_storeu_si128((__m128i *)to + 18, tmp);
-					_mm_storeu_si128((__m128i *)to + 19, tmp);
-					_mm_storeu_si128((__m128i *)to + 20, tmp);
-					_mm_storeu_si128((__m128i *)to + 21, tmp);
-					_mm_storeu_si128((__m128i *)to + 22, tmp);
-					_mm_storeu_si128((__m128i *)to + 23, tmp);
-					_mm_storeu_si128((__m128i *)to + 24, tmp);
-					_mm_storeu_si128((__m128i *)to + 25, tmp);
-					_mm_storeu_si128((__m128i *)to + 26, tmp);
-					_mm_storeu_si128((__m128i *)to + 27, tmp);
-					_mm_storeu_si128((__m128i *)to + 28, tmp);
-					_mm_storeu_si128((__m128i *)to + 29, tmp);
-					_mm_storeu_si128((__m128i *)to + 30, tmp);
-					_mm_storeu_si128((__m128i *)to + 31, tmp);
-					_mm_storeu_si128((__m128i *)to + 32, tmp);
-					_mm_storeu_si128((__m128i *)to + 33, tmp);
-					_mm_storeu_si128((__m128i *)to + 34, tmp);
-					_mm_storeu_si128((__m128i *)to + 35, tmp);
-					_mm_storeu_si128((__m128i *)to + 36, tmp);
-					_mm_storeu_si128((__m128i *)to + 37, tmp);
-					_mm_storeu_si128((__m128i *)to + 38, tmp);
-					_mm_storeu_si128((__m128i *)to + 39, tmp);
-					_mm_storeu_si128((__m128i *)to + 40, tmp);
-					_mm_storeu_si128((__m128i *)to + 41, tmp);
-					_mm_storeu_si128((__m128i *)to + 42, tmp);
-					_mm_storeu_si128((__m128i *)to + 43, tmp);
-					_mm_storeu_si128((__m128i *)to + 44, tmp);
-					_mm_storeu_si128((__m128i *)to + 45, tmp);
-					_mm_storeu_si128((__m128i *)to + 46, tmp);
-					_mm_storeu_si128((__m128i *)to + 47, tmp);
-					_mm_storeu_si128((__m128i *)to + 48, tmp);
-					_mm_storeu_si128((__m128i *)to + 49, tmp);
-					_mm_storeu_si128((__m128i *)to + 50, tmp);
-					_mm_storeu_si128((__m128i *)to + 51, tmp);
-					_mm_storeu_si128((__m128i *)to + 52, tmp);
-					_mm_storeu_si128((__m128i *)to + 53, tmp);
-					_mm_storeu_si128((__m128i *)to + 54, tmp);
-					_mm_storeu_si128((__m128i *)to + 55, tmp);
-					_mm_storeu_si128((__m128i *)to + 56, tmp);
-					_mm_storeu_si128((__m128i *)to + 57, tmp);
-					_mm_storeu_si128((__m128i *)to + 58, tmp);
-					_mm_storeu_si128((__m128i *)to + 59, tmp);
-					_mm_storeu_si128((__m128i *)to + 60, tmp);
-					_mm_storeu_si128((__m128i *)to + 61, tmp);
-					_mm_storeu_si128((__m128i *)to + 62, tmp);
-					_mm_storeu_si128((__m128i *)to + 63, tmp);
-					to += 256;
-				case 0x02:
-					tmp = _mm_loadu_si128((__m128i *)static_mask_1);
-					_mm_storeu_si128((__m128i *)to, tmp);
-					_mm_storeu_si128((__m128i *)to + 1, tmp);
-					_mm_storeu_si128((__m128i *)to + 2, tmp);
-					_mm_storeu_si128((__m128i *)to + 3, tmp);
-					_mm_storeu_si128((__m128i *)to + 4, tmp);
-					_mm_storeu_si128((__m128i *)to + 5, tmp);
-					_mm_storeu_si128((__m128i *)to + 6, tmp);
-					_mm_storeu_si128((__m128i *)to + 7, tmp);
-					_mm_storeu_si128((__m128i *)to + 8, tmp);
-					_mm_storeu_si128((__m128i *)to + 9, tmp);
-					_mm_storeu_si128((__m128i *)to + 10, tmp);
-					_mm_storeu_si128((__m128i *)to + 11, tmp);
-					_mm_storeu_si128((__m128i *)to + 12, tmp);
-					_mm_storeu_si128((__m128i *)to + 13, tmp);
-					_mm_storeu_si128((__m128i *)to + 14, tmp);
-					_mm_storeu_si128((__m128i *)to + 15, tmp);
-					_mm_storeu_si128((__m128i *)to + 16, tmp);
-					_mm_storeu_si128((__m128i *)to + 17, tmp);
-					_mm_storeu_si128((__m128i *)to + 18, tmp);
-					_mm_storeu_si128((__m128i *)to + 19, tmp);
-					_mm_storeu_si128((__m128i *)to + 20, tmp);
-					_mm_storeu_si128((__m128i *)to + 21, tmp);
-					_mm_storeu_si128((__m128i *)to + 22, tmp);
-					_mm_storeu_si128((__m128i *)to + 23, tmp);
-					_mm_storeu_si128((__m128i *)to + 24, tmp);
-					_mm_storeu_si128((__m128i *)to + 25, tmp);
-					_mm_storeu_si128((__m128i *)to + 26, tmp);
-					_mm_storeu_si128((__m128i *)to + 27, tmp);
-					_mm_storeu_si128((__m128i *)to + 28, tmp);
-					_mm_storeu_si128((__m128i *)to + 29, tmp);
-					_mm_storeu_si128((__m128i *)to + 30, tmp);
-					_mm_storeu_si128((__m128i *)to + 31, tmp);
-					_mm_storeu_si128((__m128i *)to + 32, tmp);
-					_mm_storeu_si128((__m128i *)to + 33, tmp);
-					_mm_storeu_si128((__m128i *)to + 34, tmp);
-					_mm_storeu_si128((__m128i *)to + 35, tmp);
-					_mm_storeu_si128((__m128i *)to + 36, tmp);
-					_mm_storeu_si128((__m128i *)to + 37, tmp);
-					_mm_storeu_si128((__m128i *)to + 38, tmp);
-					_mm_storeu_si128((__m128i *)to + 39, tmp);
-					_mm_storeu_si128((__m128i *)to + 40, tmp);
-					_mm_storeu_si128((__m128i *)to + 41, tmp);
-					_mm_storeu_si128((__m128i *)to + 42, tmp);
-					_mm_storeu_si128((__m128i *)to + 43, tmp);
-					_mm_storeu_si128((__m128i *)to + 44, tmp);
-					_mm_storeu_si128((__m128i *)to + 45, tmp);
-					_mm_storeu_si128((__m128i *)to + 46, tmp);
-					_mm_storeu_si128((__m128i *)to + 47, tmp);
-					_mm_storeu_si128((__m128i *)to + 48, tmp);
-					_mm_storeu_si128((__m128i *)to + 49, tmp);
-					_mm_storeu_si128((__m128i *)to + 50, tmp);
-					_mm_storeu_si128((__m128i *)to + 51, tmp);
-					_mm_storeu_si128((__m128i *)to + 52, tmp);
-					_mm_storeu_si128((__m128i *)to + 53, tmp);
-					_mm_storeu_si128((__m128i *)to + 54, tmp);
-					_mm_storeu_si128((__m128i *)to + 55, tmp);
-					_mm_storeu_si128((__m128i *)to + 56, tmp);
-					_mm_storeu_si128((__m128i *)to + 57, tmp);
-					_mm_storeu_si128((__m128i *)to + 58, tmp);
-					_mm_storeu_si128((__m128i *)to + 59, tmp);
-					_mm_storeu_si128((__m128i *)to + 60, tmp);
-					_mm_storeu_si128((__m128i *)to + 61, tmp);
-					_mm_storeu_si128((__m128i *)to + 62, tmp);
-					_mm_storeu_si128((__m128i *)to + 63, tmp);
-					to += 256;
-				case 0x03:
-					tmp = _mm_loadu_si128((__m128i *)static_mask_1);
-					_mm_storeu_si128((__m128i *)to, tmp);
-					_mm_storeu_si128((__m128i *)to + 1, tmp);
-					_mm_storeu_si128((__m128i *)to + 2, tmp);
-					_mm_storeu_si128((__m128i *)to + 3, tmp);
-					_mm_storeu_si128((__m128i *)to + 4, tmp);
-					_mm_storeu_si128((__m128i *)to + 5, tmp);
-					_mm_storeu_si128((__m128i *)to + 6, tmp);
-					_mm_storeu_si128((__m128i *)to + 7, tmp);
-					_mm_storeu_si128((__m128i *)to + 8, tmp);
-					_mm_storeu_si128((__m128i *)to + 9, tmp);
-					_mm_storeu_si128((__m128i *)to + 10, tmp);
-					_mm_storeu_si128((__m128i *)to + 11, tmp);
-					_mm_storeu_si128((__m128i *)to + 12, tmp);
-					_mm_storeu_si128((__m128i *)to + 13, tmp);
-					_mm_storeu_si128((__m128i *)to + 14, tmp);
-					_mm_storeu_si128((__m128i *)to + 15, tmp);
-					_mm_storeu_si128((__m128i *)to + 16, tmp);
-					_mm_storeu_si128((__m128i *)to + 17, tmp);
-					_mm_storeu_si128((__m128i *)to + 18, tmp);
-					_mm_storeu_si128((__m128i *)to + 19, tmp);
-					_mm_storeu_si128((__m128i *)to + 20, tmp);
-					_mm_storeu_si128((__m128i *)to + 21, tmp);
-					_mm_storeu_si128((__m128i *)to + 22, tmp);
-					_mm_storeu_si128((__m128i *)to + 23, tmp);
-					_mm_storeu_si128((__m128i *)to + 24, tmp);
-					_mm_storeu_si128((__m128i *)to + 25, tmp);
-					_mm_storeu_si128((__m128i *)to + 26, tmp);
-					_mm_storeu_si128((__m128i *)to + 27, tmp);
-					_mm_storeu_si128((__m128i *)to + 28, tmp);
-					_mm_storeu_si128((__m128i *)to + 29, tmp);
-					_mm_storeu_si128((__m128i *)to + 30, tmp);
-					_mm_storeu_si128((__m128i *)to + 31, tmp);
-					_mm_storeu_si128((__m128i *)to + 32, tmp);
-					_mm_storeu_si128((__m128i *)to + 33, tmp);
-					_mm_storeu_si128((__m128i *)to + 34, tmp);
-					_mm_storeu_si128((__m128i *)to + 35, tmp);
-					_mm_storeu_si128((__m128i *)to + 36, tmp);
-					_mm_storeu_si128((__m128i *)to + 37, tmp);
-					_mm_storeu_si128((__m128i *)to + 38, tmp);
-					_mm_storeu_si128((__m128i *)to + 39, tmp);
-					_mm_storeu_si128((__m128i *)to + 40, tmp);
-					_mm_storeu_si128((__m128i *)to + 41, tmp);
-					_mm_storeu_si128((__m128i *)to + 42, tmp);
-					_mm_storeu_si128((__m128i *)to + 43, tmp);
-					_mm_storeu_si128((__m128i *)to + 44, tmp);
-					_mm_storeu_si128((__m128i *)to + 45, tmp);
-					_mm_storeu_si128((__m128i *)to + 46, tmp);
-					_mm_storeu_si128((__m128i *)to + 47, tmp);
-					_mm_storeu_si128((__m128i *)to + 48, tmp);
-					_mm_storeu_si128((__m128i *)to + 49, tmp);
-					_mm_storeu_si128((__m128i *)to + 50, tmp);
-					_mm_storeu_si128((__m128i *)to + 51, tmp);
-					_mm_storeu_si128((__m128i *)to + 52, tmp);
-					_mm_storeu_si128((__m128i *)to + 53, tmp);
-					_mm_storeu_si128((__m128i *)to + 54, tmp);
-					_mm_storeu_si128((__m128i *)to + 55, tmp);
-					_mm_storeu_si128((__m128i *)to + 56, tmp);
-					_mm_storeu_si128((__m128i *)to + 57, tmp);
-					_mm_storeu_si128((__m128i *)to + 58, tmp);
-					_mm_storeu_si128((__m128i *)to + 59, tmp);
-					_mm_storeu_si128((__m128i *)to + 60, tmp);
-					_mm_storeu_si128((__m128i *)to + 61, tmp);
-					_mm_storeu_si128((__m128i *)to + 62, tmp);
-					_mm_storeu_si128((__m128i *)to + 63, tmp);
-					to += 256;
-				case 0x04:
-					tmp = _mm_loadu_si128((__m128i *)static_mask_1);
-					_mm_storeu_si128((__m128i *)to, tmp);
-					_mm_storeu_si128((__m128i *)to + 1, tmp);
-					_mm_storeu_si128((__m128i *)to + 2, tmp);
-					_mm_storeu_si128((__m128i *)to + 3, tmp);
-					_mm_storeu_si128((__m128i *)to + 4, tmp);
-					_mm_storeu_si128((__m128i *)to + 5, tmp);
-					_mm_storeu_si128((__m128i *)to + 6, tmp);
-					_mm_storeu_si128((__m128i *)to + 7, tmp);
-					_mm_storeu_si128((__m128i *)to + 8, tmp);
-					_mm_storeu_si128((__m128i *)to + 9, tmp);
-					_mm_storeu_si128((__m128i *)to + 10, tmp);
-					_mm_storeu_si128((__m128i *)to + 11, tmp);
-					_mm_storeu_si128((__m128i *)to + 12, tmp);
-					_mm_storeu_si128((__m128i *)to + 13, tmp);
-					_mm_storeu_si128((__m128i *)to + 14, tmp);
-					_mm_storeu_si128((__m128i *)to + 15, tmp);
-					_mm_storeu_si128((__m128i *)to + 16, tmp);
-					_mm_storeu_si128((__m128i *)to + 17, tmp);
-					_mm_storeu_si128((__m128i *)to + 18, tmp);
-					_mm_storeu_si128((__m128i *)to + 19, tmp);
-					_mm_storeu_si128((__m128i *)to + 20, tmp);
-					_mm_storeu_si128((__m128i *)to + 21, tmp);
-					_mm_storeu_si128((__m128i *)to + 22, tmp);
-					_mm_storeu_si128((__m128i *)to + 23, tmp);
-					_mm_storeu_si128((__m128i *)to + 24, tmp);
-					_mm_storeu_si128((__m128i *)to + 25, tmp);
-					_mm_storeu_si128((__m128i *)to + 26, tmp);
-					_mm_storeu_si128((__m128i *)to + 27, tmp);
-					_mm_storeu_si128((__m128i *)to + 28, tmp);
-					_mm_storeu_si128((__m128i *)to + 29, tmp);
-					_mm_storeu_si128((__m128i *)to + 30, tmp);
-					_mm_storeu_si128((__m128i *)to + 31, tmp);
-					_mm_storeu_si128((__m128i *)to + 32, tmp);
-					_mm_storeu_si128((__m128i *)to + 33, tmp);
-					_mm_storeu_si128((__m128i *)to + 34, tmp);
-					_mm_storeu_si128((__m128i *)to + 35, tmp);
-					_mm_storeu_si128((__m128i *)to + 36, tmp);
-					_mm_storeu_si128((__m128i *)to + 37, tmp);
-					_mm_storeu_si128((__m128i *)to + 38, tmp);
-					_mm_storeu_si128((__m128i *)to + 39, tmp);
-					_mm_storeu_si128((__m128i *)to + 40, tmp);
-					_mm_storeu_si128((__m128i *)to + 41, tmp);
-					_mm_storeu_si128((__m128i *)to + 42, tmp);
-					_mm_storeu_si128((__m128i *)to + 43, tmp);
-					_mm_storeu_si128((__m128i *)to + 44, tmp);
-					_mm_storeu_si128((__m128i *)to + 45, tmp);
-					_mm_storeu_si128((__m128i *)to + 46, tmp);
-					_mm_storeu_si128((__m128i *)to + 47, tmp);
-					_mm_storeu_si128((__m128i *)to + 48, tmp);
-					_mm_storeu_si128((__m128i *)to + 49, tmp);
-					_mm_storeu_si128((__m128i *)to + 50, tmp);
-					_mm_storeu_si128((__m128i *)to + 51, tmp);
-					_mm_storeu_si128((__m128i *)to + 52, tmp);
-					_mm_storeu_si128((__m128i *)to + 53, tmp);
-					_mm_storeu_si128((__m128i *)to + 54, tmp);
-					_mm_storeu_si128((__m128i *)to + 55, tmp);
-					_mm_storeu_si128((__m128i *)to + 56, tmp);
-					_mm_storeu_si128((__m128i *)to + 57, tmp);
-					_mm_storeu_si128((__m128i *)to + 58, tmp);
-					_mm_storeu_si128((__m128i *)to + 59, tmp);
-					_mm_storeu_si128((__m128i *)to + 60, tmp);
-					_mm_storeu_si128((__m128i *)to + 61, tmp);
-					_mm_storeu_si128((__m128i *)to + 62, tmp);
-					_mm_storeu_si128((__m128i *)to + 63, tmp);
-					to += 256;
-				case 0x05:
-					tmp = _mm_loadu_si128((__m128i *)static_mask_1);
-					_mm_storeu_si128((__m128i *)to, tmp);
-					_mm_storeu_si128((__m128i *)to + 1, tmp);
-					_mm_storeu_si128((__m128i *)to + 2, tmp);
-					_mm_storeu_si128((__m128i *)to + 3, tmp);
-					_mm_storeu_si128((__m128i *)to + 4, tmp);
-					_mm_storeu_si128((__m128i *)to + 5, tmp);
-					_mm_storeu_si128((__m128i *)to + 6, tmp);
-					_mm_storeu_si128((__m128i *)to + 7, tmp);
-					_mm_storeu_si128((__m128i *)to + 8, tmp);
-					_mm_storeu_si128((__m128i *)to + 9, tmp);
-					_mm_storeu_si128((__m128i *)to + 10, tmp);
-					_mm_storeu_si128((__m128i *)to + 11, tmp);
-					_mm_storeu_si128((__m128i *)to + 12, tmp);
-					_mm_storeu_si128((__m128i *)to + 13, tmp);
-					_mm_storeu_si128((__m128i *)to + 14, tmp);
-					_mm_storeu_si128((__m128i *)to + 15, tmp);
-					_mm_storeu_si128((__m128i *)to + 16, tmp);
-					_mm_storeu_si128((__m128i *)to + 17, tmp);
-					_mm_storeu_si128((__m128i *)to + 18, tmp);
-					_mm_storeu_si128((__m128i *)to + 19, tmp);
-					_mm_storeu_si128((__m128i *)to + 20, tmp);
-					_mm_storeu_si128((__m128i *)to + 21, tmp);
-					_mm_storeu_si128((__m128i *)to + 22, tmp);
-					_mm_storeu_si128((__m128i *)to + 23, tmp);
-					_mm_storeu_si128((__m128i *)to + 24, tmp);
-					_mm_storeu_si128((__m128i *)to + 25, tmp);
-					_mm_storeu_si128((__m128i *)to + 26, tmp);
-					_mm_storeu_si128((__m128i *)to + 27, tmp);
-					_mm_storeu_si128((__m128i *)to + 28, tmp);
-					_mm_storeu_si128((__m128i *)to + 29, tmp);
-					_mm_storeu_si128((__m128i *)to + 30, tmp);
-					_mm_storeu_si128((__m128i *)to + 31, tmp);
-					_mm_storeu_si128((__m128i *)to + 32, tmp);
-					_mm_storeu_si128((__m128i *)to + 33, tmp);
-					_mm_storeu_si128((__m128i *)to + 34, tmp);
-					_mm_storeu_si128((__m128i *)to + 35, tmp);
-					_mm_storeu_si128((__m128i *)to + 36, tmp);
-					_mm_storeu_si128((__m128i *)to + 37, tmp);
-					_mm_storeu_si128((__m128i *)to + 38, tmp);
-					_mm_storeu_si128((__m128i *)to + 39, tmp);
-					_mm_storeu_si128((__m128i *)to + 40, tmp);
-					_mm_storeu_si128((__m128i *)to + 41, tmp);
-					_mm_storeu_si128((__m128i *)to + 42, tmp);
-					_mm_storeu_si128((__m128i *)to + 43, tmp);
-					_mm_storeu_si128((__m128i *)to + 44, tmp);
-					_mm_storeu_si128((__m128i *)to + 45, tmp);
-					_mm_storeu_si128((__m128i *)to + 46, tmp);
-					_mm_storeu_si128((__m128i *)to + 47, tmp);
-					_mm_storeu_si128((__m128i *)to + 48, tmp);
-					_mm_storeu_si128((__m128i *)to + 49, tmp);
-					_mm_storeu_si128((__m128i *)to + 50, tmp);
-					_mm_storeu_si128((__m128i *)to + 51, tmp);
-					_mm_storeu_si128((__m128i *)to + 52, tmp);
-					_mm_storeu_si128((__m128i *)to + 53, tmp);
-					_mm_storeu_si128((__m128i *)to + 54, tmp);
-					_mm_storeu_si128((__m128i *)to + 55, tmp);
-					_mm_storeu_si128((__m128i *)to + 56, tmp);
-					_mm_storeu_si128((__m128i *)to + 57, tmp);
-					_mm_storeu_si128((__m128i *)to + 58, tmp);
-					_mm_storeu_si128((__m128i *)to + 59, tmp);
-					_mm_storeu_si128((__m128i *)to + 60, tmp);
-					_mm_storeu_si128((__m128i *)to + 61, tmp);
-					_mm_storeu_si128((__m128i *)to + 62, tmp);
-					_mm_storeu_si128((__m128i *)to + 63, tmp);
-					to += 256;
-				case 0x06:
-					tmp = _mm_loadu_si128((__m128i *)static_mask_1);
-					_mm_storeu_si128((__m128i *)to, tmp);
-					_mm_storeu_si128((__m128i *)to + 1, tmp);
-					_mm_storeu_si128((__m128i *)to + 2, tmp);
-					_mm_storeu_si128((__m128i *)to + 3, tmp);
-					_mm_storeu_si128((__m128i *)to + 4, tmp);
-					_mm_storeu_si128((__m128i *)to + 5, tmp);
-					_mm_storeu_si128((__m128i *)to + 6, tmp);
-					_mm_storeu_si128((__m128i *)to + 7, tmp);
-					_mm_storeu_si128((__m128i *)to + 8, tmp);
-					_mm_storeu_si128((__m128i *)to + 9, tmp);
-					_mm_storeu_si128((__m128i *)to + 10, tmp);
-					_mm_storeu_si128((__m128i *)to + 11, tmp);
-					_mm_storeu_si128((__m128i *)to + 12, tmp);
-					_mm_storeu_si128((__m128i *)to + 13, tmp);
-					_mm_storeu_si128((__m128i *)to + 14, tmp);
-					_mm_storeu_si128((__m128i *)to + 15, tmp);
-					_mm_storeu_si128((__m128i *)to + 16, tmp);
-					_mm_storeu_si128((__m128i *)to + 17, tmp);
-					_mm_storeu_si128((__m128i *)to + 18, tmp);
-					_mm_storeu_si128((__m128i *)to + 19, tmp);
-					_mm_storeu_si128((__m128i *)to + 20, tmp);
-					_mm_storeu_si128((__m128i *)to + 21, tmp);
-					_mm_storeu_si128((__m128i *)to + 22, tmp);
-					_mm_storeu_si128((__m128i *)to + 23, tmp);
-					_mm_storeu_si128((__m128i *)to + 24, tmp);
-					_mm_storeu_si128((__m128i *)to + 25, tmp);
-					_mm_storeu_si128((__m128i *)to + 26, tmp);
-					_mm_storeu_si128((__m128i *)to + 27, tmp);
-					_mm_storeu_si128((__m128i *)to + 28, tmp);
-					_mm_storeu_si128((__m128i *)to + 29, tmp);
-					_mm_storeu_si128((__m128i *)to + 30, tmp);
-					_mm_storeu_si128((__m128i *)to + 31, tmp);
-					_mm_storeu_si128((__m128i *)to + 32, tmp);
-					_mm_storeu_si128((__m128i *)to + 33, tmp);
-					_mm_storeu_si128((__m128i *)to + 34, tmp);
-					_mm_storeu_si128((__m128i *)to + 35, tmp);
-					_mm_storeu_si128((__m128i *)to + 36, tmp);
-					_mm_storeu_si128((__m128i *)to + 37, tmp);
-					_mm_storeu_si128((__m128i *)to + 38, tmp);
-					_mm_storeu_si128((__m128i *)to + 39, tmp);
-					_mm_storeu_si128((__m128i *)to + 40, tmp);
-					_mm_storeu_si128((__m128i *)to + 41, tmp);
-					_mm_storeu_si128((__m128i *)to + 42, tmp);
-					_mm_storeu_si128((__m128i *)to + 43, tmp);
-					_mm_storeu_si128((__m128i *)to + 44, tmp);
-					_mm_storeu_si128((__m128i *)to + 45, tmp);
-					_mm_storeu_si128((__m128i *)to + 46, tmp);
-					_mm_storeu_si128((__m128i *)to + 47, tmp);
-					_mm_storeu_si128((__m128i *)to + 48, tmp);
-					_mm_storeu_si128((__m128i *)to + 49, tmp);
-					_mm_storeu_si128((__m128i *)to + 50, tmp);
-					_mm_storeu_si128((__m128i *)to + 51, tmp);
-					_mm_storeu_si128((__m128i *)to + 52, tmp);
-					_mm_storeu_si128((__m128i *)to + 53, tmp);
-					_mm_storeu_si128((__m128i *)to + 54, tmp);
-					_mm_storeu_si128((__m128i *)to + 55, tmp);
-					_mm_storeu_si128((__m128i *)to + 56, tmp);
-					_mm_storeu_si128((__m128i *)to + 57, tmp);
-					_mm_storeu_si128((__m128i *)to + 58, tmp);
-					_mm_storeu_si128((__m128i *)to + 59, tmp);
-					_mm_storeu_si128((__m128i *)to + 60, tmp);
-					_mm_storeu_si128((__m128i *)to + 61, tmp);
-					_mm_storeu_si128((__m128i *)to + 62, tmp);
-					_mm_storeu_si128((__m128i *)to + 63, tmp);
-					to += 256;
-				case 0x07:
-					tmp = _mm_loadu_si128((__m128i *)static_mask_1);
-					_mm_storeu_si128((__m128i *)to, tmp);
-					_mm_storeu_si128((__m128i *)to + 1, tmp);
-					_mm_storeu_si128((__m128i *)to + 2, tmp);
-					_mm_storeu_si128((__m128i *)to + 3, tmp);
-					_mm_storeu_si128((__m128i *)to + 4, tmp);
-					_mm_storeu_si128((__m128i *)to + 5, tmp);
-					_mm_storeu_si128((__m128i *)to + 6, tmp);
-					_mm_storeu_si128((__m128i *)to + 7, tmp);
-					_mm_storeu_si128((__m128i *)to + 8, tmp);
-					_mm_storeu_si128((__m128i *)to + 9, tmp);
-					_mm_storeu_si128((__m128i *)to + 10, tmp);
-					_mm_storeu_si128((__m128i *)to + 11, tmp);
-					_mm_storeu_si128((__m128i *)to + 12, tmp);
-					_mm_storeu_si128((__m128i *)to + 13, tmp);
-					_mm_storeu_si128((__m128i *)to + 14, tmp);
-					_mm_storeu_si128((__m128i *)to + 15, tmp);
-					_mm_storeu_si128((__m128i *)to + 16, tmp);
-					_mm_storeu_si128((__m128i *)to + 17, tmp);
-					_mm_storeu_si128((__m128i *)to + 18, tmp);
-					_mm_storeu_si128((__m128i *)to + 19, tmp);
-					_mm_storeu_si128((__m128i *)to + 20, tmp);
-					_mm_storeu_si128((__m128i *)to + 21, tmp);
-					_mm_storeu_si128((__m128i *)to + 22, tmp);
-					_mm_storeu_si128((__m128i *)to + 23, tmp);
-					_mm_storeu_si128((__m128i *)to + 24, tmp);
-					_mm_storeu_si128((__m128i *)to + 25, tmp);
-					_mm_storeu_si128((__m128i *)to + 26, tmp);
-					_mm_storeu_si128((__m128i *)to + 27, tmp);
-					_mm_storeu_si128((__m128i *)to + 28, tmp);
-					_mm_storeu_si128((__m128i *)to + 29, tmp);
-					_mm_storeu_si128((__m128i *)to + 30, tmp);
-					_mm_storeu_si128((__m128i *)to + 31, tmp);
-					_mm_storeu_si128((__m128i *)to + 32, tmp);
-					_mm_storeu_si128((__m128i *)to + 33, tmp);
-					_mm_storeu_si128((__m128i *)to + 34, tmp);
-					_mm_storeu_si128((__m128i *)to + 35, tmp);
-					_mm_storeu_si128((__m128i *)to + 36, tmp);
-					_mm_storeu_si128((__m128i *)to + 37, tmp);
-					_mm_storeu_si128((__m128i *)to + 38, tmp);
-					_mm_storeu_si128((__m128i *)to + 39, tmp);
-					_mm_storeu_si128((__m128i *)to + 40, tmp);
-					_mm_storeu_si128((__m128i *)to + 41, tmp);
-					_mm_storeu_si128((__m128i *)to + 42, tmp);
-					_mm_storeu_si128((__m128i *)to + 43, tmp);
-					_mm_storeu_si128((__m128i *)to + 44, tmp);
-					_mm_storeu_si128((__m128i *)to + 45, tmp);
-					_mm_storeu_si128((__m128i *)to + 46, tmp);
-					_mm_storeu_si128((__m128i *)to + 47, tmp);
-					_mm_storeu_si128((__m128i *)to + 48, tmp);
-					_mm_storeu_si128((__m128i *)to + 49, tmp);
-					_mm_storeu_si128((__m128i *)to + 50, tmp);
-					_mm_storeu_si128((__m128i *)to + 51, tmp);
-					_mm_storeu_si128((__m128i *)to + 52, tmp);
-					_mm_storeu_si128((__m128i *)to + 53, tmp);
-					_mm_storeu_si128((__m128i *)to + 54, tmp);
-					_mm_storeu_si128((__m128i *)to + 55, tmp);
-					_mm_storeu_si128((__m128i *)to + 56, tmp);
-					_mm_storeu_si128((__m128i *)to + 57, tmp);
-					_mm_storeu_si128((__m128i *)to + 58, tmp);
-					_mm_storeu_si128((__m128i *)to + 59, tmp);
-					_mm_storeu_si128((__m128i *)to + 60, tmp);
-					_mm_storeu_si128((__m128i *)to + 61, tmp);
-					_mm_storeu_si128((__m128i *)to + 62, tmp);
-					_mm_storeu_si128((__m128i *)to + 63, tmp);
-					to += 256;
-				case 0x08:
-					tmp = _mm_loadu_si128((__m128i *)static_mask_1);
-					_mm_storeu_si128((__m128i *)to, tmp);
-					_mm_storeu_si128((__m128i *)to + 1, tmp);
-					_mm_storeu_si128((__m128i *)to + 2, tmp);
-					_mm_storeu_si128((__m128i *)to + 3, tmp);
-					_mm_storeu_si128((__m128i *)to + 4, tmp);
-					_mm_storeu_si128((__m128i *)to + 5, tmp);
-					_mm_storeu_si128((__m128i *)to + 6, tmp);
-					_mm_storeu_si128((__m128i *)to + 7, tmp);
-					_mm_storeu_si128((__m128i *)to + 8, tmp);
-					_mm_storeu_si128((__m128i *)to + 9, tmp);
-					_mm_storeu_si128((__m128i *)to + 10, tmp);
-					_mm_storeu_si128((__m128i *)to + 11, tmp);
-					_mm_storeu_si128((__m128i *)to + 12, tmp);
-					_mm_storeu_si128((__m128i *)to + 13, tmp);
-					_mm_storeu_si128((__m128i *)to + 14, tmp);
-					_mm_storeu_si128((__m128i *)to + 15, tmp);
-					_mm_storeu_si128((__m128i *)to + 16, tmp);
-					_mm_storeu_si128((__m128i *)to + 17, tmp);
-					_mm_storeu_si128((__m128i *)to + 18, tmp);
-					_mm_storeu_si128((__m128i *)to + 19, tmp);
-					_mm_storeu_si128((__m128i *)to + 20, tmp);
-					_mm_storeu_si128((__m128i *)to + 21, tmp);
-					_mm_storeu_si128((__m128i *)to + 22, tmp);
-					_mm_storeu_si128((__m128i *)to + 23, tmp);
-					_mm_storeu_si128((__m128i *)to + 24, tmp);
-					_mm_storeu_si128((__m128i *)to + 25, tmp);
-					_mm_storeu_si128((__m128i *)to + 26, tmp);
-					_mm_storeu_si128((__m128i *)to + 27, tmp);
-					_mm_storeu_si128((__m128i *)to + 28, tmp);
-					_mm_storeu_si128((__m128i *)to + 29, tmp);
-					_mm_storeu_si128((__m128i *)to + 30, tmp);
-					_mm_storeu_si128((__m128i *)to + 31, tmp);
-					_mm_storeu_si128((__m128i *)to + 32, tmp);
-					_mm_storeu_si128((__m128i *)to + 33, tmp);
-					_mm_storeu_si128((__m128i *)to + 34, tmp);
-					_mm_storeu_si128((__m128i *)to + 35, tmp);
-					_mm_storeu_si128((__m128i *)to + 36, tmp);
-					_mm_storeu_si128((__m128i *)to + 37, tmp);
-					_mm_storeu_si128((__m128i *)to + 38, tmp);
-					_mm_storeu_si128((__m128i *)to + 39, tmp);
-					_mm_storeu_si128((__m128i *)to + 40, tmp);
-					_mm_storeu_si128((__m128i *)to + 41, tmp);
-					_mm_storeu_si128((__m128i *)to + 42, tmp);
-					_mm_storeu_si128((__m128i *)to + 43, tmp);
-					_mm_storeu_si128((__m128i *)to + 44, tmp);
-					_mm_storeu_si128((__m128i *)to + 45, tmp);
-					_mm_storeu_si128((__m128i *)to + 46, tmp);
-					_mm_storeu_si128((__m128i *)to + 47, tmp);
-					_mm_storeu_si128((__m128i *)to + 48, tmp);
-					_mm_storeu_si128((__m128i *)to + 49, tmp);
-					_mm_storeu_si128((__m128i *)to + 50, tmp);
-					_mm_storeu_si128((__m128i *)to + 51, tmp);
-					_mm_storeu_si128((__m128i *)to + 52, tmp);
-					_mm_storeu_si128((__m128i *)to + 53, tmp);
-					_mm_storeu_si128((__m128i *)to + 54, tmp);
-					_mm_storeu_si128((__m128i *)to + 55, tmp);
-					_mm_storeu_si128((__m128i *)to + 56, tmp);
-					_mm_storeu_si128((__m128i *)to + 57, tmp);
-					_mm_storeu_si128((__m128i *)to + 58, tmp);
-					_mm_storeu_si128((__m128i *)to + 59, tmp);
-					_mm_storeu_si128((__m128i *)to + 60, tmp);
-					_mm_storeu_si128((__m128i *)to + 61, tmp);
-					_mm_storeu_si128((__m128i *)to + 62, tmp);
-					_mm_storeu_si128((__m128i *)to + 63, tmp);
-					to += 256;
-				case 0x09:
-					tmp = _mm_loadu_si128((__m128i *)static_mask_1);
-					_mm_storeu_si128((__m128i *)to, tmp);
-					_mm_storeu_si128((__m128i *)to + 1, tmp);
-					_mm_storeu_si128((__m128i *)to + 2, tmp);
-					_mm_storeu_si128((__m128i *)to + 3, tmp);
-					_mm_storeu_si128((__m128i *)to + 4, tmp);
-					_mm_storeu_si128((__m128i *)to + 5, tmp);
-					_mm_storeu_si128((__m128i *)to + 6, tmp);
-					_mm_storeu_si128((__m128i *)to + 7, tmp);
-					_mm_storeu_si128((__m128i *)to + 8, tmp);
-					_mm_storeu_si128((__m128i *)to + 9, tmp);
-					_mm_storeu_si128((__m128i *)to + 10, tmp);
-					_mm_storeu_si128((__m128i *)to + 11, tmp);
-					_mm_storeu_si128((__m128i *)to + 12, tmp);
-					_mm_storeu_si128((__m128i *)to + 13, tmp);
-					_mm_storeu_si128((__m128i *)to + 14, tmp);
-					_mm_storeu_si128((__m128i *)to + 15, tmp);
-					_mm_storeu_si128((__m128i *)to + 16, tmp);
-					_mm_storeu_si128((__m128i *)to + 17, tmp);
-					_mm_storeu_si128((__m128i *)to + 18, tmp);
-					_mm_storeu_si128((__m128i *)to + 19, tmp);
-					_mm_storeu_si128((__m128i *)to + 20, tmp);
-					_mm_storeu_si128((__m128i *)to + 21, tmp);
-					_mm_storeu_si128((__m128i *)to + 22, tmp);
-					_mm_storeu_si128((__m128i *)to + 23, tmp);
-					_mm_storeu_si128((__m128i *)to + 24, tmp);
-					_mm_storeu_si128((__m128i *)to + 25, tmp);
-					_mm_storeu_si128((__m128i *)to + 26, tmp);
-					_mm_storeu_si128((__m128i *)to + 27, tmp);
-					_mm_storeu_si128((__m128i *)to + 28, tmp);
-					_mm_storeu_si128((__m128i *)to + 29, tmp);
-					_mm_storeu_si128((__m128i *)to + 30, tmp);
-					_mm_storeu_si128((__m128i *)to + 31, tmp);
-					_mm_storeu_si128((__m128i *)to + 32, tmp);
-					_mm_storeu_si128((__m128i *)to + 33, tmp);
-					_mm_storeu_si128((__m128i *)to + 34, tmp);
-					_mm_storeu_si128((__m128i *)to + 35, tmp);
-					_mm_storeu_si128((__m128i *)to + 36, tmp);
-					_mm_storeu_si128((__m128i *)to + 37, tmp);
-					_mm_storeu_si128((__m128i *)to + 38, tmp);
-					_mm_storeu_si128((__m128i *)to + 39, tmp);
-					_mm_storeu_si128((__m128i *)to + 40, tmp);
-					_mm_storeu_si128((__m128i *)to + 41, tmp);
-					_mm_storeu_si128((__m128i *)to + 42, tmp);
-					_mm_storeu_si128((__m128i *)to + 43, tmp);
-					_mm_storeu_si128((__m128i *)to + 44, tmp);
-					_mm_storeu_si128((__m128i *)to + 45, tmp);
-					_mm_storeu_si128((__m128i *)to + 46, tmp);
-					_mm_storeu_si128((__m128i *)to + 47, tmp);
-					_mm_storeu_si128((__m128i *)to + 48, tmp);
-					_mm_storeu_si128((__m128i *)to + 49, tmp);
-					_mm_storeu_si128((__m128i *)to + 50, tmp);
-					_mm_storeu_si128((__m128i *)to + 51, tmp);
-					_mm_storeu_si128((__m128i *)to + 52, tmp);
-					_mm_storeu_si128((__m128i *)to + 53, tmp);
-					_mm_storeu_si128((__m128i *)to + 54, tmp);
-					_mm_storeu_si128((__m128i *)to + 55, tmp);
-					_mm_storeu_si128((__m128i *)to + 56, tmp);
-					_mm_storeu_si128((__m128i *)to + 57, tmp);
-					_mm_storeu_si128((__m128i *)to + 58, tmp);
-					_mm_storeu_si128((__m128i *)to + 59, tmp);
-					_mm_storeu_si128((__m128i *)to + 60, tmp);
-					_mm_storeu_si128((__m128i *)to + 61, tmp);
-					_mm_storeu_si128((__m128i *)to + 62, tmp);
-					_mm_storeu_si128((__m128i *)to + 63, tmp);
-					to += 256;
-				case 0x0a:
-					tmp = _mm_loadu_si128((__m128i *)static_mask_1);
-					_mm_storeu_si128((__m128i *)to, tmp);
-					_mm_storeu_si128((__m128i *)to + 1, tmp);
-					_mm_storeu_si128((__m128i *)to + 2, tmp);
-					_mm_storeu_si128((__m128i *)to + 3, tmp);
-					_mm_storeu_si128((__m128i *)to + 4, tmp);
-					_mm_storeu_si128((__m128i *)to + 5, tmp);
-					_mm_storeu_si128((__m128i *)to + 6, tmp);
-					_mm_storeu_si128((__m128i *)to + 7, tmp);
-					_mm_storeu_si128((__m128i *)to + 8, tmp);
-					_mm_storeu_si128((__m128i *)to + 9, tmp);
-					_mm_storeu_si128((__m128i *)to + 10, tmp);
-					_mm_storeu_si128((__m128i *)to + 11, tmp);
-					_mm_storeu_si128((__m128i *)to + 12, tmp);
-					_mm_storeu_si128((__m128i *)to + 13, tmp);
-					_mm_storeu_si128((__m128i *)to + 14, tmp);
-					_mm_storeu_si128((__m128i *)to + 15, tmp);
-					_mm_storeu_si128((__m128i *)to + 16, tmp);
-					_mm_storeu_si128((__m128i *)to + 17, tmp);
-					_mm_storeu_si128((__m128i *)to + 18, tmp);
-					_mm_storeu_si128((__m128i *)to + 19, tmp);
-					_mm_storeu_si128((__m128i *)to + 20, tmp);
-					_mm_storeu_si128((__m128i *)to + 21, tmp);
-					_mm_storeu_si128((__m128i *)to + 22, tmp);
-					_mm_storeu_si128((__m128i *)to + 23, tmp);
-					_mm_storeu_si128((__m128i *)to + 24, tmp);
-					_mm_storeu_si128((__m128i *)to + 25, tmp);
-					_mm_storeu_si128((__m128i *)to + 26, tmp);
-					_mm_storeu_si128((__m128i *)to + 27, tmp);
-					_mm_storeu_si128((__m128i *)to + 28, tmp);
-					_mm_storeu_si128((__m128i *)to + 29, tmp);
-					_mm_storeu_si128((__m128i *)to + 30, tmp);
-					_mm_storeu_si128((__m128i *)to + 31, tmp);
-					_mm_storeu_si128((__m128i *)to + 32, tmp);
-					_mm_storeu_si128((__m128i *)to + 33, tmp);
-					_mm_storeu_si128((__m128i *)to + 34, tmp);
-					_mm_storeu_si128((__m128i *)to + 35, tmp);
-					_mm_storeu_si128((__m128i *)to + 36, tmp);
-					_mm_storeu_si128((__m128i *)to + 37, tmp);
-					_mm_storeu_si128((__m128i *)to + 38, tmp);
-					_mm_storeu_si128((__m128i *)to + 39, tmp);
-					_mm_storeu_si128((__m128i *)to + 40, tmp);
-					_mm_storeu_si128((__m128i *)to + 41, tmp);
-					_mm_storeu_si128((__m128i *)to + 42, tmp);
-					_mm_storeu_si128((__m128i *)to + 43, tmp);
-					_mm_storeu_si128((__m128i *)to + 44, tmp);
-					_mm_storeu_si128((__m128i *)to + 45, tmp);
-					_mm_storeu_si128((__m128i *)to + 46, tmp);
-					_mm_storeu_si128((__m128i *)to + 47, tmp);
-					_mm_storeu_si128((__m128i *)to + 48, tmp);
-					_mm_storeu_si128((__m128i *)to + 49, tmp);
-					_mm_storeu_si128((__m128i *)to + 50, tmp);
-					_mm_storeu_si128((__m128i *)to + 51, tmp);
-					_mm_storeu_si128((__m128i *)to + 52, tmp);
-					_mm_storeu_si128((__m128i *)to + 53, tmp);
-					_mm_storeu_si128((__m128i *)to + 54, tmp);
-					_mm_storeu_si128((__m128i *)to + 55, tmp);
-					_mm_storeu_si128((__m128i *)to + 56, tmp);
-					_mm_storeu_si128((__m128i *)to + 57, tmp);
-					_mm_storeu_si128((__m128i *)to + 58, tmp);
-					_mm_storeu_si128((__m128i *)to + 59, tmp);
-					_mm_storeu_si128((__m128i *)to + 60, tmp);
-					_mm_storeu_si128((__m128i *)to + 61, tmp);
-					_mm_storeu_si128((__m128i *)to + 62, tmp);
-					_mm_storeu_si128((__m128i *)to + 63, tmp);
-					to += 256;
-				case 0x0b:
-					tmp = _mm_loadu_si128((__m128i *)static_mask_1);
-					_mm_storeu_si128((__m128i *)to, tmp);
-					_mm_storeu_si128((__m128i *)to + 1, tmp);
-					_mm_storeu_si128((__m128i *)to + 2, tmp);
-					_mm_storeu_si128((__m128i *)to + 3, tmp);
-					_mm_storeu_si128((__m128i *)to + 4, tmp);
-					_mm_storeu_si128((__m128i *)to + 5, tmp);
-					_mm_storeu_si128((__m128i *)to + 6, tmp);
-					_mm_storeu_si128((__m128i *)to + 7, tmp);
-					_mm_storeu_si128((__m128i *)to + 8, tmp);
-					_mm_storeu_si128((__m128i *)to + 9, tmp);
-					_mm_storeu_si128((__m128i *)to + 10, tmp);
-					_mm_storeu_si128((__m128i *)to + 11, tmp);
-					_mm_storeu_si128((__m128i *)to + 12, tmp);
-					_mm_storeu_si128((__m128i *)to + 13, tmp);
-					_mm_storeu_si128((__m128i *)to + 14, tmp);
-					_mm_storeu_si128((__m128i *)to + 15, tmp);
-					_mm_storeu_si128((__m128i *)to + 16, tmp);
-					_mm_storeu_si128((__m128i *)to + 17, tmp);
-					_mm_storeu_si128((__m128i *)to + 18, tmp);
-					_mm_storeu_si128((__m128i *)to + 19, tmp);
-					_mm_storeu_si128((__m128i *)to + 20, tmp);
-					_mm_storeu_si128((__m128i *)to + 21, tmp);
-					_mm_storeu_si128((__m128i *)to + 22, tmp);
-					_mm_storeu_si128((__m128i *)to + 23, tmp);
-					_mm_storeu_si128((__m128i *)to + 24, tmp);
-					_mm_storeu_si128((__m128i *)to + 25, tmp);
-					_mm_storeu_si128((__m128i *)to + 26, tmp);
-					_mm_storeu_si128((__m128i *)to + 27, tmp);
-					_mm_storeu_si128((__m128i *)to + 28, tmp);
-					_mm_storeu_si128((__m128i *)to + 29, tmp);
-					_mm_storeu_si128((__m128i *)to + 30, tmp);
-					_mm_storeu_si128((__m128i *)to + 31, tmp);
-					_mm_storeu_si128((__m128i *)to + 32, tmp);
-					_mm_storeu_si128((__m128i *)to + 33, tmp);
-					_mm_storeu_si128((__m128i *)to + 34, tmp);
-					_mm_storeu_si128((__m128i *)to + 35, tmp);
-					_mm_storeu_si128((__m128i *)to + 36, tmp);
-					_mm_storeu_si128((__m128i *)to + 37, tmp);
-					_mm_storeu_si128((__m128i *)to + 38, tmp);
-					_mm_storeu_si128((__m128i *)to + 39, tmp);
-					_mm_storeu_si128((__m128i *)to + 40, tmp);
-					_mm_storeu_si128((__m128i *)to + 41, tmp);
-					_mm_storeu_si128((__m128i *)to + 42, tmp);
-					_mm_storeu_si128((__m128i *)to + 43, tmp);
-					_mm_storeu_si128((__m128i *)to + 44, tmp);
-					_mm_storeu_si128((__m128i *)to + 45, tmp);
-					_mm_storeu_si128((__m128i *)to + 46, tmp);
-					_mm_storeu_si128((__m128i *)to + 47, tmp);
-					_mm_storeu_si128((__m128i *)to + 48, tmp);
-					_mm_storeu_si128((__m128i *)to + 49, tmp);
-					_mm_storeu_si128((__m128i *)to + 50, tmp);
-					_mm_storeu_si128((__m128i *)to + 51, tmp);
-					_mm_storeu_si128((__m128i *)to + 52, tmp);
-					_mm_storeu_si128((__m128i *)to + 53, tmp);
-					_mm_storeu_si128((__m128i *)to + 54, tmp);
-					_mm_storeu_si128((__m128i *)to + 55, tmp);
-					_mm_storeu_si128((__m128i *)to + 56, tmp);
-					_mm_storeu_si128((__m128i *)to + 57, tmp);
-					_mm_storeu_si128((__m128i *)to + 58, tmp);
-					_mm_storeu_si128((__m128i *)to + 59, tmp);
-					_mm_storeu_si128((__m128i *)to + 60, tmp);
-					_mm_storeu_si128((__m128i *)to + 61, tmp);
-					_mm_storeu_si128((__m128i *)to + 62, tmp);
-					_mm_storeu_si128((__m128i *)to + 63, tmp);
-					to += 256;
-				case 0x0c:
-					tmp = _mm_loadu_si128((__m128i *)static_mask_1);
-					_mm_storeu_si128((__m128i *)to, tmp);
-					_mm_storeu_si128((__m128i *)to + 1, tmp);
-					_mm_storeu_si128((__m128i *)to + 2, tmp);
-					_mm_storeu_si128((__m128i *)to + 3, tmp);
-					_mm_storeu_si128((__m128i *)to + 4, tmp);
-					_mm_storeu_si128((__m128i *)to + 5, tmp);
-					_mm_storeu_si128((__m128i *)to + 6, tmp);
-					_mm_storeu_si128((__m128i *)to + 7, tmp);
-					_mm_storeu_si128((__m128i *)to + 8, tmp);
-					_mm_storeu_si128((__m128i *)to + 9, tmp);
-					_mm_storeu_si128((__m128i *)to + 10, tmp);
-					_mm_storeu_si128((__m128i *)to + 11, tmp);
-					_mm_storeu_si128((__m128i *)to + 12, tmp);
-					_mm_storeu_si128((__m128i *)to + 13, tmp);
-					_mm_storeu_si128((__m128i *)to + 14, tmp);
-					_mm_storeu_si128((__m128i *)to + 15, tmp);
-					_mm_storeu_si128((__m128i *)to + 16, tmp);
-					_mm_storeu_si128((__m128i *)to + 17, tmp);
-					_mm_storeu_si128((__m128i *)to + 18, tmp);
-					_mm_storeu_si128((__m128i *)to + 19, tmp);
-					_mm_storeu_si128((__m128i *)to + 20, tmp);
-					_mm_storeu_si128((__m128i *)to + 21, tmp);
-					_mm_storeu_si128((__m128i *)to + 22, tmp);
-					_mm_storeu_si128((__m128i *)to + 23, tmp);
-					_mm_storeu_si128((__m128i *)to + 24, tmp);
-					_mm_storeu_si128((__m128i *)to + 25, tmp);
-					_mm_storeu_si128((__m128i *)to + 26, tmp);
-					_mm_storeu_si128((__m128i *)to + 27, tmp);
-					_mm_storeu_si128((__m128i *)to + 28, tmp);
-					_mm_storeu_si128((__m128i *)to + 29, tmp);
-					_mm_storeu_si128((__m128i *)to + 30, tmp);
-					_mm_storeu_si128((__m128i *)to + 31, tmp);
-					_mm_storeu_si128((__m128i *)to + 32, tmp);
-					_mm_storeu_si128((__m128i *)to + 33, tmp);
-					_mm_storeu_si128((__m128i *)to + 34, tmp);
-					_mm_storeu_si128((__m128i *)to + 35, tmp);
-					_mm_storeu_si128((__m128i *)to + 36, tmp);
-					_mm_storeu_si128((__m128i *)to + 37, tmp);
-					_mm_storeu_si128((__m128i *)to + 38, tmp);
-					_mm_storeu_si128((__m128i *)to + 39, tmp);
-					_mm_storeu_si128((__m128i *)to + 40, tmp);
-					_mm_storeu_si128((__m128i *)to + 41, tmp);
-					_mm_storeu_si128((__m128i *)to + 42, tmp);
-					_mm_storeu_si128((__m128i *)to + 43, tmp);
-					_mm_storeu_si128((__m128i *)to + 44, tmp);
-					_mm_storeu_si128((__m128i *)to + 45, tmp);
-					_mm_storeu_si128((__m128i *)to + 46, tmp);
-					_mm_storeu_si128((__m128i *)to + 47, tmp);
-					_mm_storeu_si128((__m128i *)to + 48, tmp);
-					_mm_storeu_si128((__m128i *)to + 49, tmp);
-					_mm_storeu_si128((__m128i *)to + 50, tmp);
-					_mm_storeu_si128((__m128i *)to + 51, tmp);
-					_mm_storeu_si128((__m128i *)to + 52, tmp);
-					_mm_storeu_si128((__m128i *)to + 53, tmp);
-					_mm_storeu_si128((__m128i *)to + 54, tmp);
-					_mm_storeu_si128((__m128i *)to + 55, tmp);
-					_mm_storeu_si128((__m128i *)to + 56, tmp);
-					_mm_storeu_si128((__m128i *)to + 57, tmp);
-					_mm_storeu_si128((__m128i *)to + 58, tmp);
-					_mm_storeu_si128((__m128i *)to + 59, tmp);
-					_mm_storeu_si128((__m128i *)to + 60, tmp);
-					_mm_storeu_si128((__m128i *)to + 61, tmp);
-					_mm_storeu_si128((__m128i *)to + 62, tmp);
-					_mm_storeu_si128((__m128i *)to + 63, tmp);
-					to += 256;
-				case 0x0d:
-					tmp = _mm_loadu_si128((__m128i *)static_mask_1);
-					_mm_storeu_si128((__m128i *)to, tmp);
-					_mm_storeu_si128((__m128i *)to + 1, tmp);
-					_mm_storeu_si128((__m128i *)to + 2, tmp);
-					_mm_storeu_si128((__m128i *)to + 3, tmp);
-					_mm_storeu_si128((__m128i *)to + 4, tmp);
-					_mm_storeu_si128((__m128i *)to + 5, tmp);
-					_mm_storeu_si128((__m128i *)to + 6, tmp);
-					_mm_storeu_si128((__m128i *)to + 7, tmp);
-					_mm_storeu_si128((__m128i *)to + 8, tmp);
-					_mm_storeu_si128((__m128i *)to + 9, tmp);
-					_mm_storeu_si128((__m128i *)to + 10, tmp);
-					_mm_storeu_si128((__m128i *)to + 11, tmp);
-					_mm_storeu_si128((__m128i *)to + 12, tmp);
-					_mm_storeu_si128((__m128i *)to + 13, tmp);
-					_mm_storeu_si128((__m128i *)to + 14, tmp);
-					_mm_storeu_si128((__m128i *)to + 15, tmp);
-					_mm_storeu_si128((__m128i *)to + 16, tmp);
-					_mm_storeu_si128((__m128i *)to + 17, tmp);
-					_mm_storeu_si128((__m128i *)to + 18, tmp);
-					_mm_storeu_si128((__m128i *)to + 19, tmp);
-					_mm_storeu_si128((__m128i *)to + 20, tmp);
-					_mm_storeu_si128((__m128i *)to + 21, tmp);
-					_mm_storeu_si128((__m128i *)to + 22, tmp);
-					_mm_storeu_si128((__m128i *)to + 23, tmp);
-					_mm_storeu_si128((__m128i *)to + 24, tmp);
-					_mm_storeu_si128((__m128i *)to + 25, tmp);
-					_mm_storeu_si128((__m128i *)to + 26, tmp);
-					_mm_storeu_si128((__m128i *)to + 27, tmp);
-					_mm_storeu_si128((__m128i *)to + 28, tmp);
-					_mm_storeu_si128((__m128i *)to + 29, tmp);
-					_mm_storeu_si128((__m128i *)to + 30, tmp);
-					_mm_storeu_si128((__m128i *)to + 31, tmp);
-					_mm_storeu_si128((__m128i *)to + 32, tmp);
-					_mm_storeu_si128((__m128i *)to + 33, tmp);
-					_mm_storeu_si128((__m128i *)to + 34, tmp);
-					_mm_storeu_si128((__m128i *)to + 35, tmp);
-					_mm_storeu_si128((__m128i *)to + 36, tmp);
-					_mm_storeu_si128((__m128i *)to + 37, tmp);
-					_mm_storeu_si128((__m128i *)to + 38, tmp);
-					_mm_storeu_si128((__m128i *)to + 39, tmp);
-					_mm_storeu_si128((__m128i *)to + 40, tmp);
-					_mm_storeu_si128((__m128i *)to + 41, tmp);
-					_mm_storeu_si128((__m128i *)to + 42, tmp);
-					_mm_storeu_si128((__m128i *)to + 43, tmp);
-					_mm_storeu_si128((__m128i *)to + 44, tmp);
-					_mm_storeu_si128((__m128i *)to + 45, tmp);
-					_mm_storeu_si128((__m128i *)to + 46, tmp);
-					_mm_storeu_si128((__m128i *)to + 47, tmp);
-					_mm_storeu_si128((__m128i *)to + 48, tmp);
-					_mm_storeu_si128((__m128i *)to + 49, tmp);
-					_mm_storeu_si128((__m128i *)to + 50, tmp);
-					_mm_storeu_si128((__m128i *)to + 51, tmp);
-					_mm_storeu_si128((__m128i *)to + 52, tmp);
-					_mm_storeu_si128((__m128i *)to + 53, tmp);
-					_mm_storeu_si128((__m128i *)to + 54, tmp);
-					_mm_storeu_si128((__m128i *)to + 55, tmp);
-					_mm_storeu_si128((__m128i *)to + 56, tmp);
-					_mm_storeu_si128((__m128i *)to + 57, tmp);
-					_mm_storeu_si128((__m128i *)to + 58, tmp);
-					_mm_storeu_si128((__m128i *)to + 59, tmp);
-					_mm_storeu_si128((__m128i *)to + 60, tmp);
-					_mm_storeu_si128((__m128i *)to + 61, tmp);
-					_mm_storeu_si128((__m128i *)to + 62, tmp);
-					_mm_storeu_si128((__m128i *)to + 63, tmp);
-					to += 256;
-				case 0x0e:
-					tmp = _mm_loadu_si128((__m128i *)static_mask_1);
-					_mm_storeu_si128((__m128i *)to, tmp);
-					_mm_storeu_si128((__m128i *)to + 1, tmp);
-					_mm_storeu_si128((__m128i *)to + 2, tmp);
-					_mm_storeu_si128((__m128i *)to + 3, tmp);
-					_mm_storeu_si128((__m128i *)to + 4, tmp);
-					_mm_storeu_si128((__m128i *)to + 5, tmp);
-					_mm_storeu_si128((__m128i *)to + 6, tmp);
-					_mm_storeu_si128((__m128i *)to + 7, tmp);
-					_mm_storeu_si128((__m128i *)to + 8, tmp);
-					_mm_storeu_si128((__m128i *)to + 9, tmp);
-					_mm_storeu_si128((__m128i *)to + 10, tmp);
-					_mm_storeu_si128((__m128i *)to + 11, tmp);
-					_mm_storeu_si128((__m128i *)to + 12, tmp);
-					_mm_storeu_si128((__m128i *)to + 13, tmp);
-					_mm_storeu_si128((__m128i *)to + 14, tmp);
-					_mm_storeu_si128((__m128i *)to + 15, tmp);
-					_mm_storeu_si128((__m128i *)to + 16, tmp);
-					_mm_storeu_si128((__m128i *)to + 17, tmp);
-					_mm_storeu_si128((__m128i *)to + 18, tmp);
-					_mm_storeu_si128((__m128i *)to + 19, tmp);
-					_mm_storeu_si128((__m128i *)to + 20, tmp);
-					_mm_storeu_si128((__m128i *)to + 21, tmp);
-					_mm_storeu_si128((__m128i *)to + 22, tmp);
-					_mm_storeu_si128((__m128i *)to + 23, tmp);
-					_mm_storeu_si128((__m128i *)to + 24, tmp);
-					_mm_storeu_si128((__m128i *)to + 25, tmp);
-					_mm_storeu_si128((__m128i *)to + 26, tmp);
-					_mm_storeu_si128((__m128i *)to + 27, tmp);
-					_mm_storeu_si128((__m128i *)to + 28, tmp);
-					_mm_storeu_si128((__m128i *)to + 29, tmp);
-					_mm_storeu_si128((__m128i *)to + 30, tmp);
-					_mm_storeu_si128((__m128i *)to + 31, tmp);
-					_mm_storeu_si128((__m128i *)to + 32, tmp);
-					_mm_storeu_si128((__m128i *)to + 33, tmp);
-					_mm_storeu_si128((__m128i *)to + 34, tmp);
-					_mm_storeu_si128((__m128i *)to + 35, tmp);
-					_mm_storeu_si128((__m128i *)to + 36, tmp);
-					_mm_storeu_si128((__m128i *)to + 37, tmp);
-					_mm_storeu_si128((__m128i *)to + 38, tmp);
-					_mm_storeu_si128((__m128i *)to + 39, tmp);
-					_mm_storeu_si128((__m128i *)to + 40, tmp);
-					_mm_storeu_si128((__m128i *)to + 41, tmp);
-					_mm_storeu_si128((__m128i *)to + 42, tmp);
-					_mm_storeu_si128((__m128i *)to + 43, tmp);
-					_mm_storeu_si128((__m128i *)to + 44, tmp);
-					_mm_storeu_si128((__m128i *)to + 45, tmp);
-					_mm_storeu_si128((__m128i *)to + 46, tmp);
-					_mm_storeu_si128((__m128i *)to + 47, tmp);
-					_mm_storeu_si128((__m128i *)to + 48, tmp);
-					_mm_storeu_si128((__m128i *)to + 49, tmp);
-					_mm_storeu_si128((__m128i *)to + 50, tmp);
-					_mm_storeu_si128((__m128i *)to + 51, tmp);
-					_mm_storeu_si128((__m128i *)to + 52, tmp);
-					_mm_storeu_si128((__m128i *)to + 53, tmp);
-					_mm_storeu_si128((__m128i *)to + 54, tmp);
-					_mm_storeu_si128((__m128i *)to + 55, tmp);
-					_mm_storeu_si128((__m128i *)to + 56, tmp);
-					_mm_storeu_si128((__m128i *)to + 57, tmp);
-					_mm_storeu_si128((__m128i *)to + 58, tmp);
-					_mm_storeu_si128((__m128i *)to + 59, tmp);
-					_mm_storeu_si128((__m128i *)to + 60, tmp);
-					_mm_storeu_si128((__m128i *)to + 61, tmp);
-					_mm_storeu_si128((__m128i *)to + 62, tmp);
-					_mm_storeu_si128((__m128i *)to + 63, tmp);
-					to += 256;
-				case 0x0f:
-					tmp = _mm_loadu_si128((__m128i *)static_mask_1);
-					_mm_storeu_si128((__m128i *)to, tmp);
-					_mm_storeu_si128((__m128i *)to + 1, tmp);
-					_mm_storeu_si128((__m128i *)to + 2, tmp);
-					_mm_storeu_si128((__m128i *)to + 3, tmp);
-					_mm_storeu_si128((__m128i *)to + 4, tmp);
-					_mm_storeu_si128((__m128i *)to + 5, tmp);
-					_mm_storeu_si128((__m128i *)to + 6, tmp);
-					_mm_storeu_si128((__m128i *)to + 7, tmp);
-					_mm_storeu_si128((__m128i *)to + 8, tmp);
-					_mm_storeu_si128((__m128i *)to + 9, tmp);
-					_mm_storeu_si128((__m128i *)to + 10, tmp);
-					_mm_storeu_si128((__m128i *)to + 11, tmp);
-					_mm_storeu_si128((__m128i *)to + 12, tmp);
-					_mm_storeu_si128((__m128i *)to + 13, tmp);
-					_mm_storeu_si128((__m128i *)to + 14, tmp);
-					_mm_storeu_si128((__m128i *)to + 15, tmp);
-					_mm_storeu_si128((__m128i *)to + 16, tmp);
-					_mm_storeu_si128((__m128i *)to + 17, tmp);
-					_mm_storeu_si128((__m128i *)to + 18, tmp);
-					_mm_storeu_si128((__m128i *)to + 19, tmp);
-					_mm_storeu_si128((__m128i *)to + 20, tmp);
-					_mm_storeu_si128((__m128i *)to + 21, tmp);
-					_mm_storeu_si128((__m128i *)to + 22, tmp);
-					_mm_storeu_si128((__m128i *)to + 23, tmp);
-					_mm_storeu_si128((__m128i *)to + 24, tmp);
-					_mm_storeu_si128((__m128i *)to + 25, tmp);
-					_mm_storeu_si128((__m128i *)to + 26, tmp);
-					_mm_storeu_si128((__m128i *)to + 27, tmp);
-					_mm_storeu_si128((__m128i *)to + 28, tmp);
-					_mm_storeu_si128((__m128i *)to + 29, tmp);
-					_mm_storeu_si128((__m128i *)to + 30, tmp);
-					_mm_storeu_si128((__m128i *)to + 31, tmp);
-					_mm_storeu_si128((__m128i *)to + 32, tmp);
-					_mm_storeu_si128((__m128i *)to + 33, tmp);
-					_mm_storeu_si128((__m128i *)to + 34, tmp);
-					_mm_storeu_si128((__m128i *)to + 35, tmp);
-					_mm_storeu_si128((__m128i *)to + 36, tmp);
-					_mm_storeu_si128((__m128i *)to + 37, tmp);
-					_mm_storeu_si128((__m128i *)to + 38, tmp);
-					_mm_storeu_si128((__m128i *)to + 39, tmp);
-					_mm_storeu_si128((__m128i *)to + 40, tmp);
-					_mm_storeu_si128((__m128i *)to + 41, tmp);
-					_mm_storeu_si128((__m128i *)to + 42, tmp);
-					_mm_storeu_si128((__m128i *)to + 43, tmp);
-					_mm_storeu_si128((__m128i *)to + 44, tmp);
-					_mm_storeu_si128((__m128i *)to + 45, tmp);
-					_mm_storeu_si128((__m128i *)to + 46, tmp);
-					_mm_storeu_si128((__m128i *)to + 47, tmp);
-					_mm_storeu_si128((__m128i *)to + 48, tmp);
-					_mm_storeu_si128((__m128i *)to + 49, tmp);
-					_mm_storeu_si128((__m128i *)to + 50, tmp);
-					_mm_storeu_si128((__m128i *)to + 51, tmp);
-					_mm_storeu_si128((__m128i *)to + 52, tmp);
-					_mm_storeu_si128((__m128i *)to + 53, tmp);
-					_mm_storeu_si128((__m128i *)to + 54, tmp);
-					_mm_storeu_si128((__m128i *)to + 55, tmp);
-					_mm_storeu_si128((__m128i *)to + 56, tmp);
-					_mm_storeu_si128((__m128i *)to + 57, tmp);
-					_mm_storeu_si128((__m128i *)to + 58, tmp);
-					_mm_storeu_si128((__m128i *)to + 59, tmp);
-					_mm_storeu_si128((__m128i *)to + 60, tmp);
-					_mm_storeu_si128((__m128i *)to + 61, tmp);
-					_mm_storeu_si128((__m128i *)to + 62, tmp);
-					_mm_storeu_si128((__m128i *)to + 63, tmp);
-					to += 256;
-					break;
-				case 0x10:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 9, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 10, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 11, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 12, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 13, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 14, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 15, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 16, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 17, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 18, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 19, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 20, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 21, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 22, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 23, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 24, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 25, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 26, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 27, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 28, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 29, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 30, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 31, _mm_and_si128(byte_stream, mask_1));
-					in += 16;
-					to += 128;
-				case 0x11:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 9, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 10, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 11, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 12, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 13, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 14, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 15, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 16, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 17, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 18, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 19, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 20, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 21, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 22, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 23, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 24, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 25, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 26, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 27, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 28, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 29, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 30, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 31, _mm_and_si128(byte_stream, mask_1));
-					in += 16;
-					to += 128;
-				case 0x12:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 9, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 10, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 11, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 12, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 13, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 14, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 15, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 16, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 17, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 18, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 19, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 20, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 21, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 22, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 23, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 24, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 25, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 26, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 27, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 28, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 29, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 30, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 31, _mm_and_si128(byte_stream, mask_1));
-					in += 16;
-					to += 128;
-				case 0x13:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 9, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 10, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 11, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 12, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 13, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 14, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 15, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 16, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 17, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 18, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 19, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 20, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 21, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 22, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 23, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 24, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 25, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 26, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 27, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 28, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 29, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 30, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 31, _mm_and_si128(byte_stream, mask_1));
-					in += 16;
-					to += 128;
-				case 0x14:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 9, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 10, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 11, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 12, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 13, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 14, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 15, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 16, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 17, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 18, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 19, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 20, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 21, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 22, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 23, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 24, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 25, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 26, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 27, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 28, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 29, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 30, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 31, _mm_and_si128(byte_stream, mask_1));
-					in += 16;
-					to += 128;
-				case 0x15:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 9, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 10, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 11, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 12, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 13, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 14, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 15, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 16, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 17, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 18, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 19, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 20, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 21, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 22, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 23, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 24, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 25, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 26, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 27, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 28, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 29, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 30, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 31, _mm_and_si128(byte_stream, mask_1));
-					in += 16;
-					to += 128;
-				case 0x16:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 9, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 10, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 11, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 12, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 13, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 14, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 15, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 16, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 17, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 18, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 19, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 20, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 21, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 22, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 23, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 24, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 25, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 26, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 27, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 28, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 29, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 30, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 31, _mm_and_si128(byte_stream, mask_1));
-					in += 16;
-					to += 128;
-				case 0x17:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 9, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 10, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 11, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 12, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 13, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 14, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 15, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 16, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 17, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 18, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 19, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 20, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 21, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 22, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 23, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 24, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 25, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 26, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 27, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 28, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 29, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 30, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 31, _mm_and_si128(byte_stream, mask_1));
-					in += 16;
-					to += 128;
-				case 0x18:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 9, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 10, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 11, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 12, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 13, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 14, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 15, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 16, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 17, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 18, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 19, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 20, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 21, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 22, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 23, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 24, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 25, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 26, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 27, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 28, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 29, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 30, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 31, _mm_and_si128(byte_stream, mask_1));
-					in += 16;
-					to += 128;
-				case 0x19:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 9, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 10, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 11, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 12, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 13, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 14, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 15, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 16, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 17, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 18, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 19, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 20, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 21, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 22, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 23, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 24, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 25, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 26, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 27, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 28, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 29, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 30, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 31, _mm_and_si128(byte_stream, mask_1));
-					in += 16;
-					to += 128;
-				case 0x1a:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 9, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 10, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 11, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 12, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 13, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 14, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 15, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 16, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 17, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 18, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 19, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 20, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 21, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 22, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 23, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 24, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 25, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 26, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 27, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 28, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 29, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 30, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 31, _mm_and_si128(byte_stream, mask_1));
-					in += 16;
-					to += 128;
-				case 0x1b:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 9, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 10, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 11, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 12, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 13, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 14, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 15, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 16, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 17, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 18, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 19, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 20, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 21, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 22, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 23, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 24, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 25, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 26, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 27, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 28, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 29, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 30, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 31, _mm_and_si128(byte_stream, mask_1));
-					in += 16;
-					to += 128;
-				case 0x1c:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 9, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 10, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 11, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 12, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 13, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 14, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 15, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 16, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 17, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 18, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 19, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 20, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 21, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 22, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 23, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 24, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 25, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 26, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 27, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 28, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 29, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 30, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 31, _mm_and_si128(byte_stream, mask_1));
-					in += 16;
-					to += 128;
-				case 0x1d:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 9, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 10, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 11, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 12, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 13, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 14, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 15, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 16, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 17, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 18, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 19, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 20, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 21, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 22, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 23, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 24, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 25, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 26, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 27, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 28, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 29, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 30, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 31, _mm_and_si128(byte_stream, mask_1));
-					in += 16;
-					to += 128;
-				case 0x1e:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 9, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 10, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 11, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 12, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 13, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 14, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 15, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 16, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 17, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 18, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 19, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 20, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 21, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 22, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 23, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 24, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 25, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 26, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 27, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 28, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 29, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 30, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 31, _mm_and_si128(byte_stream, mask_1));
-					in += 16;
-					to += 128;
-				case 0x1f:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 9, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 10, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 11, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 12, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 13, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 14, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 15, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 16, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 17, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 18, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 19, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 20, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 21, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 22, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 23, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 24, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 25, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 26, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 27, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 28, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 29, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 30, _mm_and_si128(byte_stream, mask_1));
-					byte_stream = _mm_srli_epi64(byte_stream, 1);
-					_mm_storeu_si128((__m128i *)to + 31, _mm_and_si128(byte_stream, mask_1));
-					in += 16;
-					to += 128;
-					break;
-				case 0x20:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 9, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 10, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 11, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 12, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 13, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 14, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 15, _mm_and_si128(byte_stream, mask_2));
-					in += 16;
-					to += 64;
-				case 0x21:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 9, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 10, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 11, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 12, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 13, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 14, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 15, _mm_and_si128(byte_stream, mask_2));
-					in += 16;
-					to += 64;
-				case 0x22:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 9, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 10, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 11, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 12, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 13, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 14, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 15, _mm_and_si128(byte_stream, mask_2));
-					in += 16;
-					to += 64;
-				case 0x23:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 9, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 10, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 11, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 12, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 13, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 14, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 15, _mm_and_si128(byte_stream, mask_2));
-					in += 16;
-					to += 64;
-				case 0x24:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 9, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 10, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 11, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 12, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 13, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 14, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 15, _mm_and_si128(byte_stream, mask_2));
-					in += 16;
-					to += 64;
-				case 0x25:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 9, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 10, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 11, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 12, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 13, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 14, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 15, _mm_and_si128(byte_stream, mask_2));
-					in += 16;
-					to += 64;
-				case 0x26:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 9, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 10, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 11, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 12, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 13, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 14, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 15, _mm_and_si128(byte_stream, mask_2));
-					in += 16;
-					to += 64;
-				case 0x27:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 9, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 10, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 11, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 12, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 13, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 14, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 15, _mm_and_si128(byte_stream, mask_2));
-					in += 16;
-					to += 64;
-				case 0x28:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 9, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 10, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 11, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 12, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 13, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 14, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 15, _mm_and_si128(byte_stream, mask_2));
-					in += 16;
-					to += 64;
-				case 0x29:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 9, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 10, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 11, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 12, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 13, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 14, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 15, _mm_and_si128(byte_stream, mask_2));
-					in += 16;
-					to += 64;
-				case 0x2a:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 9, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 10, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 11, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 12, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 13, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 14, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 15, _mm_and_si128(byte_stream, mask_2));
-					in += 16;
-					to += 64;
-				case 0x2b:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 9, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 10, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 11, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 12, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 13, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 14, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 15, _mm_and_si128(byte_stream, mask_2));
-					in += 16;
-					to += 64;
-				case 0x2c:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 9, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 10, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 11, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 12, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 13, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 14, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 15, _mm_and_si128(byte_stream, mask_2));
-					in += 16;
-					to += 64;
-				case 0x2d:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 9, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 10, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 11, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 12, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 13, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 14, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 15, _mm_and_si128(byte_stream, mask_2));
-					in += 16;
-					to += 64;
-				case 0x2e:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 9, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 10, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 11, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 12, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 13, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 14, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 15, _mm_and_si128(byte_stream, mask_2));
-					in += 16;
-					to += 64;
-				case 0x2f:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 9, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 10, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 11, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 12, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 13, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 14, _mm_and_si128(byte_stream, mask_2));
-					byte_stream = _mm_srli_epi64(byte_stream, 2);
-					_mm_storeu_si128((__m128i *)to + 15, _mm_and_si128(byte_stream, mask_2));
-					in += 16;
-					to += 64;
-					break;
-				case 0x30:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 9, _mm_and_si128(byte_stream, mask_3));
-					in += 16;
-					to += 40;
-				case 0x31:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 9, _mm_and_si128(byte_stream, mask_3));
-					in += 16;
-					to += 40;
-				case 0x32:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 9, _mm_and_si128(byte_stream, mask_3));
-					in += 16;
-					to += 40;
-				case 0x33:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 9, _mm_and_si128(byte_stream, mask_3));
-					in += 16;
-					to += 40;
-				case 0x34:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 9, _mm_and_si128(byte_stream, mask_3));
-					in += 16;
-					to += 40;
-				case 0x35:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 9, _mm_and_si128(byte_stream, mask_3));
-					in += 16;
-					to += 40;
-				case 0x36:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 9, _mm_and_si128(byte_stream, mask_3));
-					in += 16;
-					to += 40;
-				case 0x37:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 9, _mm_and_si128(byte_stream, mask_3));
-					in += 16;
-					to += 40;
-				case 0x38:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 9, _mm_and_si128(byte_stream, mask_3));
-					in += 16;
-					to += 40;
-				case 0x39:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 9, _mm_and_si128(byte_stream, mask_3));
-					in += 16;
-					to += 40;
-				case 0x3a:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 9, _mm_and_si128(byte_stream, mask_3));
-					in += 16;
-					to += 40;
-				case 0x3b:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 9, _mm_and_si128(byte_stream, mask_3));
-					in += 16;
-					to += 40;
-				case 0x3c:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 9, _mm_and_si128(byte_stream, mask_3));
-					in += 16;
-					to += 40;
-				case 0x3d:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 9, _mm_and_si128(byte_stream, mask_3));
-					in += 16;
-					to += 40;
-				case 0x3e:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 9, _mm_and_si128(byte_stream, mask_3));
-					in += 16;
-					to += 40;
-				case 0x3f:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_3));
-					byte_stream = _mm_srli_epi64(byte_stream, 3);
-					_mm_storeu_si128((__m128i *)to + 9, _mm_and_si128(byte_stream, mask_3));
-					in += 16;
-					to += 40;
-					break;
-				case 0x40:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_4));
-					in += 16;
-					to += 32;
-				case 0x41:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_4));
-					in += 16;
-					to += 32;
-				case 0x42:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_4));
-					in += 16;
-					to += 32;
-				case 0x43:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_4));
-					in += 16;
-					to += 32;
-				case 0x44:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_4));
-					in += 16;
-					to += 32;
-				case 0x45:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_4));
-					in += 16;
-					to += 32;
-				case 0x46:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_4));
-					in += 16;
-					to += 32;
-				case 0x47:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_4));
-					in += 16;
-					to += 32;
-				case 0x48:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_4));
-					in += 16;
-					to += 32;
-				case 0x49:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_4));
-					in += 16;
-					to += 32;
-				case 0x4a:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_4));
-					in += 16;
-					to += 32;
-				case 0x4b:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_4));
-					in += 16;
-					to += 32;
-				case 0x4c:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_4));
-					in += 16;
-					to += 32;
-				case 0x4d:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_4));
-					in += 16;
-					to += 32;
-				case 0x4e:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_4));
-					in += 16;
-					to += 32;
-				case 0x4f:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_4));
-					byte_stream = _mm_srli_epi64(byte_stream, 4);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_4));
-					in += 16;
-					to += 32;
-					break;
-				case 0x50:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_5));
-					in += 16;
-					to += 24;
-				case 0x51:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_5));
-					in += 16;
-					to += 24;
-				case 0x52:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_5));
-					in += 16;
-					to += 24;
-				case 0x53:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_5));
-					in += 16;
-					to += 24;
-				case 0x54:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_5));
-					in += 16;
-					to += 24;
-				case 0x55:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_5));
-					in += 16;
-					to += 24;
-				case 0x56:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_5));
-					in += 16;
-					to += 24;
-				case 0x57:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_5));
-					in += 16;
-					to += 24;
-				case 0x58:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_5));
-					in += 16;
-					to += 24;
-				case 0x59:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_5));
-					in += 16;
-					to += 24;
-				case 0x5a:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_5));
-					in += 16;
-					to += 24;
-				case 0x5b:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_5));
-					in += 16;
-					to += 24;
-				case 0x5c:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_5));
-					in += 16;
-					to += 24;
-				case 0x5d:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_5));
-					in += 16;
-					to += 24;
-				case 0x5e:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_5));
-					in += 16;
-					to += 24;
-				case 0x5f:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_5));
-					byte_stream = _mm_srli_epi64(byte_stream, 5);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_5));
-					in += 16;
-					to += 24;
-					break;
-				case 0x60:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_6));
-					in += 16;
-					to += 20;
-				case 0x61:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_6));
-					in += 16;
-					to += 20;
-				case 0x62:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_6));
-					in += 16;
-					to += 20;
-				case 0x63:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_6));
-					in += 16;
-					to += 20;
-				case 0x64:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_6));
-					in += 16;
-					to += 20;
-				case 0x65:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_6));
-					in += 16;
-					to += 20;
-				case 0x66:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_6));
-					in += 16;
-					to += 20;
-				case 0x67:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_6));
-					in += 16;
-					to += 20;
-				case 0x68:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_6));
-					in += 16;
-					to += 20;
-				case 0x69:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_6));
-					in += 16;
-					to += 20;
-				case 0x6a:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_6));
-					in += 16;
-					to += 20;
-				case 0x6b:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_6));
-					in += 16;
-					to += 20;
-				case 0x6c:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_6));
-					in += 16;
-					to += 20;
-				case 0x6d:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_6));
-					in += 16;
-					to += 20;
-				case 0x6e:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_6));
-					in += 16;
-					to += 20;
-				case 0x6f:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_6));
-					byte_stream = _mm_srli_epi64(byte_stream, 6);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_6));
-					in += 16;
-					to += 20;
-					break;
-				case 0x70:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_7));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 4), _mm_srli_epi32(byte_stream, 7)), mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream_2, 3);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_7));
-					in += 32;
-					to += 36;
-				case 0x71:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_7));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 4), _mm_srli_epi32(byte_stream, 7)), mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream_2, 3);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_7));
-					in += 32;
-					to += 36;
-				case 0x72:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_7));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 4), _mm_srli_epi32(byte_stream, 7)), mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream_2, 3);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_7));
-					in += 32;
-					to += 36;
-				case 0x73:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_7));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 4), _mm_srli_epi32(byte_stream, 7)), mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream_2, 3);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_7));
-					in += 32;
-					to += 36;
-				case 0x74:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_7));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 4), _mm_srli_epi32(byte_stream, 7)), mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream_2, 3);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_7));
-					in += 32;
-					to += 36;
-				case 0x75:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_7));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 4), _mm_srli_epi32(byte_stream, 7)), mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream_2, 3);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_7));
-					in += 32;
-					to += 36;
-				case 0x76:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_7));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 4), _mm_srli_epi32(byte_stream, 7)), mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream_2, 3);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_7));
-					in += 32;
-					to += 36;
-				case 0x77:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_7));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 4), _mm_srli_epi32(byte_stream, 7)), mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream_2, 3);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_7));
-					in += 32;
-					to += 36;
-				case 0x78:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_7));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 4), _mm_srli_epi32(byte_stream, 7)), mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream_2, 3);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_7));
-					in += 32;
-					to += 36;
-				case 0x79:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_7));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 4), _mm_srli_epi32(byte_stream, 7)), mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream_2, 3);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_7));
-					in += 32;
-					to += 36;
-				case 0x7a:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_7));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 4), _mm_srli_epi32(byte_stream, 7)), mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream_2, 3);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_7));
-					in += 32;
-					to += 36;
-				case 0x7b:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_7));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 4), _mm_srli_epi32(byte_stream, 7)), mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream_2, 3);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_7));
-					in += 32;
-					to += 36;
-				case 0x7c:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_7));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 4), _mm_srli_epi32(byte_stream, 7)), mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream_2, 3);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_7));
-					in += 32;
-					to += 36;
-				case 0x7d:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_7));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 4), _mm_srli_epi32(byte_stream, 7)), mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream_2, 3);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_7));
-					in += 32;
-					to += 36;
-				case 0x7e:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_7));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 4), _mm_srli_epi32(byte_stream, 7)), mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream_2, 3);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_7));
-					in += 32;
-					to += 36;
-				case 0x7f:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_7));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 4), _mm_srli_epi32(byte_stream, 7)), mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream_2, 3);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 7, _mm_and_si128(byte_stream, mask_7));
-					byte_stream = _mm_srli_epi32(byte_stream, 7);
-					_mm_storeu_si128((__m128i *)to + 8, _mm_and_si128(byte_stream, mask_7));
-					in += 32;
-					to += 36;
-					break;
-				case 0x80:
-					tmp = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_cvtepu8_epi32(tmp));
-					tmp2 = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp), 0x01));
-					_mm_storeu_si128((__m128i *)to + 1, _mm_cvtepu8_epi32(tmp2));
-					tmp = _mm_castps_si128(_mm_movehl_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp)));
-					_mm_storeu_si128((__m128i *)to + 2, _mm_cvtepu8_epi32(tmp));
-					tmp2 = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp), 0x01));
-					_mm_storeu_si128((__m128i *)to + 3, _mm_cvtepu8_epi32(tmp2));
-					in += 16;
-					to += 16;
-				case 0x81:
-					tmp = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_cvtepu8_epi32(tmp));
-					tmp2 = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp), 0x01));
-					_mm_storeu_si128((__m128i *)to + 1, _mm_cvtepu8_epi32(tmp2));
-					tmp = _mm_castps_si128(_mm_movehl_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp)));
-					_mm_storeu_si128((__m128i *)to + 2, _mm_cvtepu8_epi32(tmp));
-					tmp2 = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp), 0x01));
-					_mm_storeu_si128((__m128i *)to + 3, _mm_cvtepu8_epi32(tmp2));
-					in += 16;
-					to += 16;
-				case 0x82:
-					tmp = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_cvtepu8_epi32(tmp));
-					tmp2 = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp), 0x01));
-					_mm_storeu_si128((__m128i *)to + 1, _mm_cvtepu8_epi32(tmp2));
-					tmp = _mm_castps_si128(_mm_movehl_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp)));
-					_mm_storeu_si128((__m128i *)to + 2, _mm_cvtepu8_epi32(tmp));
-					tmp2 = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp), 0x01));
-					_mm_storeu_si128((__m128i *)to + 3, _mm_cvtepu8_epi32(tmp2));
-					in += 16;
-					to += 16;
-				case 0x83:
-					tmp = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_cvtepu8_epi32(tmp));
-					tmp2 = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp), 0x01));
-					_mm_storeu_si128((__m128i *)to + 1, _mm_cvtepu8_epi32(tmp2));
-					tmp = _mm_castps_si128(_mm_movehl_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp)));
-					_mm_storeu_si128((__m128i *)to + 2, _mm_cvtepu8_epi32(tmp));
-					tmp2 = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp), 0x01));
-					_mm_storeu_si128((__m128i *)to + 3, _mm_cvtepu8_epi32(tmp2));
-					in += 16;
-					to += 16;
-				case 0x84:
-					tmp = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_cvtepu8_epi32(tmp));
-					tmp2 = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp), 0x01));
-					_mm_storeu_si128((__m128i *)to + 1, _mm_cvtepu8_epi32(tmp2));
-					tmp = _mm_castps_si128(_mm_movehl_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp)));
-					_mm_storeu_si128((__m128i *)to + 2, _mm_cvtepu8_epi32(tmp));
-					tmp2 = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp), 0x01));
-					_mm_storeu_si128((__m128i *)to + 3, _mm_cvtepu8_epi32(tmp2));
-					in += 16;
-					to += 16;
-				case 0x85:
-					tmp = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_cvtepu8_epi32(tmp));
-					tmp2 = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp), 0x01));
-					_mm_storeu_si128((__m128i *)to + 1, _mm_cvtepu8_epi32(tmp2));
-					tmp = _mm_castps_si128(_mm_movehl_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp)));
-					_mm_storeu_si128((__m128i *)to + 2, _mm_cvtepu8_epi32(tmp));
-					tmp2 = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp), 0x01));
-					_mm_storeu_si128((__m128i *)to + 3, _mm_cvtepu8_epi32(tmp2));
-					in += 16;
-					to += 16;
-				case 0x86:
-					tmp = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_cvtepu8_epi32(tmp));
-					tmp2 = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp), 0x01));
-					_mm_storeu_si128((__m128i *)to + 1, _mm_cvtepu8_epi32(tmp2));
-					tmp = _mm_castps_si128(_mm_movehl_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp)));
-					_mm_storeu_si128((__m128i *)to + 2, _mm_cvtepu8_epi32(tmp));
-					tmp2 = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp), 0x01));
-					_mm_storeu_si128((__m128i *)to + 3, _mm_cvtepu8_epi32(tmp2));
-					in += 16;
-					to += 16;
-				case 0x87:
-					tmp = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_cvtepu8_epi32(tmp));
-					tmp2 = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp), 0x01));
-					_mm_storeu_si128((__m128i *)to + 1, _mm_cvtepu8_epi32(tmp2));
-					tmp = _mm_castps_si128(_mm_movehl_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp)));
-					_mm_storeu_si128((__m128i *)to + 2, _mm_cvtepu8_epi32(tmp));
-					tmp2 = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp), 0x01));
-					_mm_storeu_si128((__m128i *)to + 3, _mm_cvtepu8_epi32(tmp2));
-					in += 16;
-					to += 16;
-				case 0x88:
-					tmp = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_cvtepu8_epi32(tmp));
-					tmp2 = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp), 0x01));
-					_mm_storeu_si128((__m128i *)to + 1, _mm_cvtepu8_epi32(tmp2));
-					tmp = _mm_castps_si128(_mm_movehl_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp)));
-					_mm_storeu_si128((__m128i *)to + 2, _mm_cvtepu8_epi32(tmp));
-					tmp2 = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp), 0x01));
-					_mm_storeu_si128((__m128i *)to + 3, _mm_cvtepu8_epi32(tmp2));
-					in += 16;
-					to += 16;
-				case 0x89:
-					tmp = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_cvtepu8_epi32(tmp));
-					tmp2 = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp), 0x01));
-					_mm_storeu_si128((__m128i *)to + 1, _mm_cvtepu8_epi32(tmp2));
-					tmp = _mm_castps_si128(_mm_movehl_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp)));
-					_mm_storeu_si128((__m128i *)to + 2, _mm_cvtepu8_epi32(tmp));
-					tmp2 = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp), 0x01));
-					_mm_storeu_si128((__m128i *)to + 3, _mm_cvtepu8_epi32(tmp2));
-					in += 16;
-					to += 16;
-				case 0x8a:
-					tmp = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_cvtepu8_epi32(tmp));
-					tmp2 = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp), 0x01));
-					_mm_storeu_si128((__m128i *)to + 1, _mm_cvtepu8_epi32(tmp2));
-					tmp = _mm_castps_si128(_mm_movehl_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp)));
-					_mm_storeu_si128((__m128i *)to + 2, _mm_cvtepu8_epi32(tmp));
-					tmp2 = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp), 0x01));
-					_mm_storeu_si128((__m128i *)to + 3, _mm_cvtepu8_epi32(tmp2));
-					in += 16;
-					to += 16;
-				case 0x8b:
-					tmp = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_cvtepu8_epi32(tmp));
-					tmp2 = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp), 0x01));
-					_mm_storeu_si128((__m128i *)to + 1, _mm_cvtepu8_epi32(tmp2));
-					tmp = _mm_castps_si128(_mm_movehl_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp)));
-					_mm_storeu_si128((__m128i *)to + 2, _mm_cvtepu8_epi32(tmp));
-					tmp2 = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp), 0x01));
-					_mm_storeu_si128((__m128i *)to + 3, _mm_cvtepu8_epi32(tmp2));
-					in += 16;
-					to += 16;
-				case 0x8c:
-					tmp = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_cvtepu8_epi32(tmp));
-					tmp2 = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp), 0x01));
-					_mm_storeu_si128((__m128i *)to + 1, _mm_cvtepu8_epi32(tmp2));
-					tmp = _mm_castps_si128(_mm_movehl_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp)));
-					_mm_storeu_si128((__m128i *)to + 2, _mm_cvtepu8_epi32(tmp));
-					tmp2 = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp), 0x01));
-					_mm_storeu_si128((__m128i *)to + 3, _mm_cvtepu8_epi32(tmp2));
-					in += 16;
-					to += 16;
-				case 0x8d:
-					tmp = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_cvtepu8_epi32(tmp));
-					tmp2 = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp), 0x01));
-					_mm_storeu_si128((__m128i *)to + 1, _mm_cvtepu8_epi32(tmp2));
-					tmp = _mm_castps_si128(_mm_movehl_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp)));
-					_mm_storeu_si128((__m128i *)to + 2, _mm_cvtepu8_epi32(tmp));
-					tmp2 = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp), 0x01));
-					_mm_storeu_si128((__m128i *)to + 3, _mm_cvtepu8_epi32(tmp2));
-					in += 16;
-					to += 16;
-				case 0x8e:
-					tmp = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_cvtepu8_epi32(tmp));
-					tmp2 = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp), 0x01));
-					_mm_storeu_si128((__m128i *)to + 1, _mm_cvtepu8_epi32(tmp2));
-					tmp = _mm_castps_si128(_mm_movehl_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp)));
-					_mm_storeu_si128((__m128i *)to + 2, _mm_cvtepu8_epi32(tmp));
-					tmp2 = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp), 0x01));
-					_mm_storeu_si128((__m128i *)to + 3, _mm_cvtepu8_epi32(tmp2));
-					in += 16;
-					to += 16;
-				case 0x8f:
-					tmp = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_cvtepu8_epi32(tmp));
-					tmp2 = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp), 0x01));
-					_mm_storeu_si128((__m128i *)to + 1, _mm_cvtepu8_epi32(tmp2));
-					tmp = _mm_castps_si128(_mm_movehl_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp)));
-					_mm_storeu_si128((__m128i *)to + 2, _mm_cvtepu8_epi32(tmp));
-					tmp2 = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp), 0x01));
-					_mm_storeu_si128((__m128i *)to + 3, _mm_cvtepu8_epi32(tmp2));
-					in += 16;
-					to += 16;
-					break;
-				case 0x90:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_9));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 5), _mm_srli_epi32(byte_stream, 9)), mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream_2, 4);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_9));
-					in += 32;
-					to += 28;
-				case 0x91:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_9));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 5), _mm_srli_epi32(byte_stream, 9)), mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream_2, 4);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_9));
-					in += 32;
-					to += 28;
-				case 0x92:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_9));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 5), _mm_srli_epi32(byte_stream, 9)), mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream_2, 4);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_9));
-					in += 32;
-					to += 28;
-				case 0x93:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_9));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 5), _mm_srli_epi32(byte_stream, 9)), mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream_2, 4);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_9));
-					in += 32;
-					to += 28;
-				case 0x94:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_9));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 5), _mm_srli_epi32(byte_stream, 9)), mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream_2, 4);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_9));
-					in += 32;
-					to += 28;
-				case 0x95:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_9));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 5), _mm_srli_epi32(byte_stream, 9)), mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream_2, 4);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_9));
-					in += 32;
-					to += 28;
-				case 0x96:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_9));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 5), _mm_srli_epi32(byte_stream, 9)), mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream_2, 4);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_9));
-					in += 32;
-					to += 28;
-				case 0x97:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_9));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 5), _mm_srli_epi32(byte_stream, 9)), mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream_2, 4);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_9));
-					in += 32;
-					to += 28;
-				case 0x98:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_9));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 5), _mm_srli_epi32(byte_stream, 9)), mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream_2, 4);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_9));
-					in += 32;
-					to += 28;
-				case 0x99:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_9));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 5), _mm_srli_epi32(byte_stream, 9)), mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream_2, 4);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_9));
-					in += 32;
-					to += 28;
-				case 0x9a:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_9));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 5), _mm_srli_epi32(byte_stream, 9)), mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream_2, 4);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_9));
-					in += 32;
-					to += 28;
-				case 0x9b:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_9));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 5), _mm_srli_epi32(byte_stream, 9)), mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream_2, 4);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_9));
-					in += 32;
-					to += 28;
-				case 0x9c:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_9));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 5), _mm_srli_epi32(byte_stream, 9)), mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream_2, 4);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_9));
-					in += 32;
-					to += 28;
-				case 0x9d:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_9));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 5), _mm_srli_epi32(byte_stream, 9)), mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream_2, 4);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_9));
-					in += 32;
-					to += 28;
-				case 0x9e:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_9));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 5), _mm_srli_epi32(byte_stream, 9)), mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream_2, 4);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_9));
-					in += 32;
-					to += 28;
-				case 0x9f:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_9));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 5), _mm_srli_epi32(byte_stream, 9)), mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream_2, 4);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 5, _mm_and_si128(byte_stream, mask_9));
-					byte_stream = _mm_srli_epi32(byte_stream, 9);
-					_mm_storeu_si128((__m128i *)to + 6, _mm_and_si128(byte_stream, mask_9));
-					in += 32;
-					to += 28;
-					break;
-				case 0xa0:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_10));
-					byte_stream = _mm_srli_epi64(byte_stream, 10);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_10));
-					byte_stream = _mm_srli_epi64(byte_stream, 10);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_10));
-					in += 16;
-					to += 12;
-				case 0xa1:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_10));
-					byte_stream = _mm_srli_epi64(byte_stream, 10);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_10));
-					byte_stream = _mm_srli_epi64(byte_stream, 10);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_10));
-					in += 16;
-					to += 12;
-				case 0xa2:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_10));
-					byte_stream = _mm_srli_epi64(byte_stream, 10);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_10));
-					byte_stream = _mm_srli_epi64(byte_stream, 10);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_10));
-					in += 16;
-					to += 12;
-				case 0xa3:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_10));
-					byte_stream = _mm_srli_epi64(byte_stream, 10);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_10));
-					byte_stream = _mm_srli_epi64(byte_stream, 10);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_10));
-					in += 16;
-					to += 12;
-				case 0xa4:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_10));
-					byte_stream = _mm_srli_epi64(byte_stream, 10);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_10));
-					byte_stream = _mm_srli_epi64(byte_stream, 10);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_10));
-					in += 16;
-					to += 12;
-				case 0xa5:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_10));
-					byte_stream = _mm_srli_epi64(byte_stream, 10);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_10));
-					byte_stream = _mm_srli_epi64(byte_stream, 10);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_10));
-					in += 16;
-					to += 12;
-				case 0xa6:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_10));
-					byte_stream = _mm_srli_epi64(byte_stream, 10);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_10));
-					byte_stream = _mm_srli_epi64(byte_stream, 10);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_10));
-					in += 16;
-					to += 12;
-				case 0xa7:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_10));
-					byte_stream = _mm_srli_epi64(byte_stream, 10);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_10));
-					byte_stream = _mm_srli_epi64(byte_stream, 10);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_10));
-					in += 16;
-					to += 12;
-				case 0xa8:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_10));
-					byte_stream = _mm_srli_epi64(byte_stream, 10);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_10));
-					byte_stream = _mm_srli_epi64(byte_stream, 10);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_10));
-					in += 16;
-					to += 12;
-				case 0xa9:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_10));
-					byte_stream = _mm_srli_epi64(byte_stream, 10);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_10));
-					byte_stream = _mm_srli_epi64(byte_stream, 10);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_10));
-					in += 16;
-					to += 12;
-				case 0xaa:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_10));
-					byte_stream = _mm_srli_epi64(byte_stream, 10);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_10));
-					byte_stream = _mm_srli_epi64(byte_stream, 10);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_10));
-					in += 16;
-					to += 12;
-				case 0xab:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_10));
-					byte_stream = _mm_srli_epi64(byte_stream, 10);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_10));
-					byte_stream = _mm_srli_epi64(byte_stream, 10);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_10));
-					in += 16;
-					to += 12;
-				case 0xac:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_10));
-					byte_stream = _mm_srli_epi64(byte_stream, 10);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_10));
-					byte_stream = _mm_srli_epi64(byte_stream, 10);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_10));
-					in += 16;
-					to += 12;
-				case 0xad:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_10));
-					byte_stream = _mm_srli_epi64(byte_stream, 10);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_10));
-					byte_stream = _mm_srli_epi64(byte_stream, 10);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_10));
-					in += 16;
-					to += 12;
-				case 0xae:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_10));
-					byte_stream = _mm_srli_epi64(byte_stream, 10);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_10));
-					byte_stream = _mm_srli_epi64(byte_stream, 10);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_10));
-					in += 16;
-					to += 12;
-				case 0xaf:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_10));
-					byte_stream = _mm_srli_epi64(byte_stream, 10);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_10));
-					byte_stream = _mm_srli_epi64(byte_stream, 10);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(byte_stream, mask_10));
-					in += 16;
-					to += 12;
-					break;
-				case 0xb0:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_12));
-					byte_stream = _mm_srli_epi32(byte_stream, 12);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_12));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 8), _mm_srli_epi32(byte_stream, 12)), mask_12));
-					byte_stream = _mm_srli_epi32(byte_stream_2, 8);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_12));
-					byte_stream = _mm_srli_epi32(byte_stream, 12);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_12));
-					in += 32;
-					to += 20;
-				case 0xb1:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_12));
-					byte_stream = _mm_srli_epi32(byte_stream, 12);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_12));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 8), _mm_srli_epi32(byte_stream, 12)), mask_12));
-					byte_stream = _mm_srli_epi32(byte_stream_2, 8);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_12));
-					byte_stream = _mm_srli_epi32(byte_stream, 12);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_12));
-					in += 32;
-					to += 20;
-				case 0xb2:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_12));
-					byte_stream = _mm_srli_epi32(byte_stream, 12);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_12));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 8), _mm_srli_epi32(byte_stream, 12)), mask_12));
-					byte_stream = _mm_srli_epi32(byte_stream_2, 8);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_12));
-					byte_stream = _mm_srli_epi32(byte_stream, 12);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_12));
-					in += 32;
-					to += 20;
-				case 0xb3:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_12));
-					byte_stream = _mm_srli_epi32(byte_stream, 12);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_12));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 8), _mm_srli_epi32(byte_stream, 12)), mask_12));
-					byte_stream = _mm_srli_epi32(byte_stream_2, 8);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_12));
-					byte_stream = _mm_srli_epi32(byte_stream, 12);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_12));
-					in += 32;
-					to += 20;
-				case 0xb4:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_12));
-					byte_stream = _mm_srli_epi32(byte_stream, 12);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_12));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 8), _mm_srli_epi32(byte_stream, 12)), mask_12));
-					byte_stream = _mm_srli_epi32(byte_stream_2, 8);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_12));
-					byte_stream = _mm_srli_epi32(byte_stream, 12);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_12));
-					in += 32;
-					to += 20;
-				case 0xb5:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_12));
-					byte_stream = _mm_srli_epi32(byte_stream, 12);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_12));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 8), _mm_srli_epi32(byte_stream, 12)), mask_12));
-					byte_stream = _mm_srli_epi32(byte_stream_2, 8);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_12));
-					byte_stream = _mm_srli_epi32(byte_stream, 12);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_12));
-					in += 32;
-					to += 20;
-				case 0xb6:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_12));
-					byte_stream = _mm_srli_epi32(byte_stream, 12);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_12));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 8), _mm_srli_epi32(byte_stream, 12)), mask_12));
-					byte_stream = _mm_srli_epi32(byte_stream_2, 8);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_12));
-					byte_stream = _mm_srli_epi32(byte_stream, 12);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_12));
-					in += 32;
-					to += 20;
-				case 0xb7:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_12));
-					byte_stream = _mm_srli_epi32(byte_stream, 12);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_12));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 8), _mm_srli_epi32(byte_stream, 12)), mask_12));
-					byte_stream = _mm_srli_epi32(byte_stream_2, 8);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_12));
-					byte_stream = _mm_srli_epi32(byte_stream, 12);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_12));
-					in += 32;
-					to += 20;
-				case 0xb8:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_12));
-					byte_stream = _mm_srli_epi32(byte_stream, 12);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_12));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 8), _mm_srli_epi32(byte_stream, 12)), mask_12));
-					byte_stream = _mm_srli_epi32(byte_stream_2, 8);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_12));
-					byte_stream = _mm_srli_epi32(byte_stream, 12);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_12));
-					in += 32;
-					to += 20;
-				case 0xb9:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_12));
-					byte_stream = _mm_srli_epi32(byte_stream, 12);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_12));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 8), _mm_srli_epi32(byte_stream, 12)), mask_12));
-					byte_stream = _mm_srli_epi32(byte_stream_2, 8);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_12));
-					byte_stream = _mm_srli_epi32(byte_stream, 12);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_12));
-					in += 32;
-					to += 20;
-				case 0xba:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_12));
-					byte_stream = _mm_srli_epi32(byte_stream, 12);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_12));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 8), _mm_srli_epi32(byte_stream, 12)), mask_12));
-					byte_stream = _mm_srli_epi32(byte_stream_2, 8);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_12));
-					byte_stream = _mm_srli_epi32(byte_stream, 12);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_12));
-					in += 32;
-					to += 20;
-				case 0xbb:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_12));
-					byte_stream = _mm_srli_epi32(byte_stream, 12);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_12));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 8), _mm_srli_epi32(byte_stream, 12)), mask_12));
-					byte_stream = _mm_srli_epi32(byte_stream_2, 8);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_12));
-					byte_stream = _mm_srli_epi32(byte_stream, 12);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_12));
-					in += 32;
-					to += 20;
-				case 0xbc:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_12));
-					byte_stream = _mm_srli_epi32(byte_stream, 12);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_12));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 8), _mm_srli_epi32(byte_stream, 12)), mask_12));
-					byte_stream = _mm_srli_epi32(byte_stream_2, 8);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_12));
-					byte_stream = _mm_srli_epi32(byte_stream, 12);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_12));
-					in += 32;
-					to += 20;
-				case 0xbd:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_12));
-					byte_stream = _mm_srli_epi32(byte_stream, 12);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_12));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 8), _mm_srli_epi32(byte_stream, 12)), mask_12));
-					byte_stream = _mm_srli_epi32(byte_stream_2, 8);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_12));
-					byte_stream = _mm_srli_epi32(byte_stream, 12);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_12));
-					in += 32;
-					to += 20;
-				case 0xbe:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_12));
-					byte_stream = _mm_srli_epi32(byte_stream, 12);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_12));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 8), _mm_srli_epi32(byte_stream, 12)), mask_12));
-					byte_stream = _mm_srli_epi32(byte_stream_2, 8);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_12));
-					byte_stream = _mm_srli_epi32(byte_stream, 12);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_12));
-					in += 32;
-					to += 20;
-				case 0xbf:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_12));
-					byte_stream = _mm_srli_epi32(byte_stream, 12);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(byte_stream, mask_12));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 8), _mm_srli_epi32(byte_stream, 12)), mask_12));
-					byte_stream = _mm_srli_epi32(byte_stream_2, 8);
-					_mm_storeu_si128((__m128i *)to + 3, _mm_and_si128(byte_stream, mask_12));
-					byte_stream = _mm_srli_epi32(byte_stream, 12);
-					_mm_storeu_si128((__m128i *)to + 4, _mm_and_si128(byte_stream, mask_12));
-					in += 32;
-					to += 20;
-					break;
-				case 0xc0:
-					tmp = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_cvtepu16_epi32(tmp));
-					_mm_storeu_si128((__m128i *)to + 1, _mm_cvtepu16_epi32(_mm_castps_si128(_mm_movehl_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp)))));
-					in += 16;
-					to += 8;
-				case 0xc1:
-					tmp = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_cvtepu16_epi32(tmp));
-					_mm_storeu_si128((__m128i *)to + 1, _mm_cvtepu16_epi32(_mm_castps_si128(_mm_movehl_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp)))));
-					in += 16;
-					to += 8;
-				case 0xc2:
-					tmp = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_cvtepu16_epi32(tmp));
-					_mm_storeu_si128((__m128i *)to + 1, _mm_cvtepu16_epi32(_mm_castps_si128(_mm_movehl_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp)))));
-					in += 16;
-					to += 8;
-				case 0xc3:
-					tmp = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_cvtepu16_epi32(tmp));
-					_mm_storeu_si128((__m128i *)to + 1, _mm_cvtepu16_epi32(_mm_castps_si128(_mm_movehl_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp)))));
-					in += 16;
-					to += 8;
-				case 0xc4:
-					tmp = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_cvtepu16_epi32(tmp));
-					_mm_storeu_si128((__m128i *)to + 1, _mm_cvtepu16_epi32(_mm_castps_si128(_mm_movehl_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp)))));
-					in += 16;
-					to += 8;
-				case 0xc5:
-					tmp = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_cvtepu16_epi32(tmp));
-					_mm_storeu_si128((__m128i *)to + 1, _mm_cvtepu16_epi32(_mm_castps_si128(_mm_movehl_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp)))));
-					in += 16;
-					to += 8;
-				case 0xc6:
-					tmp = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_cvtepu16_epi32(tmp));
-					_mm_storeu_si128((__m128i *)to + 1, _mm_cvtepu16_epi32(_mm_castps_si128(_mm_movehl_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp)))));
-					in += 16;
-					to += 8;
-				case 0xc7:
-					tmp = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_cvtepu16_epi32(tmp));
-					_mm_storeu_si128((__m128i *)to + 1, _mm_cvtepu16_epi32(_mm_castps_si128(_mm_movehl_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp)))));
-					in += 16;
-					to += 8;
-				case 0xc8:
-					tmp = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_cvtepu16_epi32(tmp));
-					_mm_storeu_si128((__m128i *)to + 1, _mm_cvtepu16_epi32(_mm_castps_si128(_mm_movehl_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp)))));
-					in += 16;
-					to += 8;
-				case 0xc9:
-					tmp = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_cvtepu16_epi32(tmp));
-					_mm_storeu_si128((__m128i *)to + 1, _mm_cvtepu16_epi32(_mm_castps_si128(_mm_movehl_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp)))));
-					in += 16;
-					to += 8;
-				case 0xca:
-					tmp = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_cvtepu16_epi32(tmp));
-					_mm_storeu_si128((__m128i *)to + 1, _mm_cvtepu16_epi32(_mm_castps_si128(_mm_movehl_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp)))));
-					in += 16;
-					to += 8;
-				case 0xcb:
-					tmp = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_cvtepu16_epi32(tmp));
-					_mm_storeu_si128((__m128i *)to + 1, _mm_cvtepu16_epi32(_mm_castps_si128(_mm_movehl_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp)))));
-					in += 16;
-					to += 8;
-				case 0xcc:
-					tmp = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_cvtepu16_epi32(tmp));
-					_mm_storeu_si128((__m128i *)to + 1, _mm_cvtepu16_epi32(_mm_castps_si128(_mm_movehl_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp)))));
-					in += 16;
-					to += 8;
-				case 0xcd:
-					tmp = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_cvtepu16_epi32(tmp));
-					_mm_storeu_si128((__m128i *)to + 1, _mm_cvtepu16_epi32(_mm_castps_si128(_mm_movehl_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp)))));
-					in += 16;
-					to += 8;
-				case 0xce:
-					tmp = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_cvtepu16_epi32(tmp));
-					_mm_storeu_si128((__m128i *)to + 1, _mm_cvtepu16_epi32(_mm_castps_si128(_mm_movehl_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp)))));
-					in += 16;
-					to += 8;
-				case 0xcf:
-					tmp = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_cvtepu16_epi32(tmp));
-					_mm_storeu_si128((__m128i *)to + 1, _mm_cvtepu16_epi32(_mm_castps_si128(_mm_movehl_ps(_mm_castsi128_ps(tmp), _mm_castsi128_ps(tmp)))));
-					in += 16;
-					to += 8;
-					break;
-				case 0xd0:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_21));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 11), _mm_srli_epi32(byte_stream, 21)), mask_21));
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(_mm_srli_epi32(byte_stream_2, 11), mask_21));
-					in += 32;
-					to += 12;
-				case 0xd1:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_21));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 11), _mm_srli_epi32(byte_stream, 21)), mask_21));
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(_mm_srli_epi32(byte_stream_2, 11), mask_21));
-					in += 32;
-					to += 12;
-				case 0xd2:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_21));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 11), _mm_srli_epi32(byte_stream, 21)), mask_21));
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(_mm_srli_epi32(byte_stream_2, 11), mask_21));
-					in += 32;
-					to += 12;
-				case 0xd3:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_21));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 11), _mm_srli_epi32(byte_stream, 21)), mask_21));
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(_mm_srli_epi32(byte_stream_2, 11), mask_21));
-					in += 32;
-					to += 12;
-				case 0xd4:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_21));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 11), _mm_srli_epi32(byte_stream, 21)), mask_21));
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(_mm_srli_epi32(byte_stream_2, 11), mask_21));
-					in += 32;
-					to += 12;
-				case 0xd5:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_21));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 11), _mm_srli_epi32(byte_stream, 21)), mask_21));
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(_mm_srli_epi32(byte_stream_2, 11), mask_21));
-					in += 32;
-					to += 12;
-				case 0xd6:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_21));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 11), _mm_srli_epi32(byte_stream, 21)), mask_21));
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(_mm_srli_epi32(byte_stream_2, 11), mask_21));
-					in += 32;
-					to += 12;
-				case 0xd7:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_21));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 11), _mm_srli_epi32(byte_stream, 21)), mask_21));
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(_mm_srli_epi32(byte_stream_2, 11), mask_21));
-					in += 32;
-					to += 12;
-				case 0xd8:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_21));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 11), _mm_srli_epi32(byte_stream, 21)), mask_21));
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(_mm_srli_epi32(byte_stream_2, 11), mask_21));
-					in += 32;
-					to += 12;
-				case 0xd9:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_21));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 11), _mm_srli_epi32(byte_stream, 21)), mask_21));
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(_mm_srli_epi32(byte_stream_2, 11), mask_21));
-					in += 32;
-					to += 12;
-				case 0xda:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_21));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 11), _mm_srli_epi32(byte_stream, 21)), mask_21));
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(_mm_srli_epi32(byte_stream_2, 11), mask_21));
-					in += 32;
-					to += 12;
-				case 0xdb:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_21));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 11), _mm_srli_epi32(byte_stream, 21)), mask_21));
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(_mm_srli_epi32(byte_stream_2, 11), mask_21));
-					in += 32;
-					to += 12;
-				case 0xdc:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_21));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 11), _mm_srli_epi32(byte_stream, 21)), mask_21));
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(_mm_srli_epi32(byte_stream_2, 11), mask_21));
-					in += 32;
-					to += 12;
-				case 0xdd:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_21));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 11), _mm_srli_epi32(byte_stream, 21)), mask_21));
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(_mm_srli_epi32(byte_stream_2, 11), mask_21));
-					in += 32;
-					to += 12;
-				case 0xde:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_21));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 11), _mm_srli_epi32(byte_stream, 21)), mask_21));
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(_mm_srli_epi32(byte_stream_2, 11), mask_21));
-					in += 32;
-					to += 12;
-				case 0xdf:
-					byte_stream = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, _mm_and_si128(byte_stream, mask_21));
-					byte_stream_2 = _mm_loadu_si128((__m128i *)in + 1);
-					_mm_storeu_si128((__m128i *)to + 1, _mm_and_si128(_mm_or_si128(_mm_slli_epi32(byte_stream_2, 11), _mm_srli_epi32(byte_stream, 21)), mask_21));
-					_mm_storeu_si128((__m128i *)to + 2, _mm_and_si128(_mm_srli_epi32(byte_stream_2, 11), mask_21));
-					in += 32;
-					to += 12;
-					break;
-				case 0xe0:
-					tmp = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, tmp);
-					in += 16;
-					to += 4;
-				case 0xe1:
-					tmp = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, tmp);
-					in += 16;
-					to += 4;
-				case 0xe2:
-					tmp = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, tmp);
-					in += 16;
-					to += 4;
-				case 0xe3:
-					tmp = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, tmp);
-					in += 16;
-					to += 4;
-				case 0xe4:
-					tmp = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, tmp);
-					in += 16;
-					to += 4;
-				case 0xe5:
-					tmp = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, tmp);
-					in += 16;
-					to += 4;
-				case 0xe6:
-					tmp = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, tmp);
-					in += 16;
-					to += 4;
-				case 0xe7:
-					tmp = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, tmp);
-					in += 16;
-					to += 4;
-				case 0xe8:
-					tmp = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, tmp);
-					in += 16;
-					to += 4;
-				case 0xe9:
-					tmp = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, tmp);
-					in += 16;
-					to += 4;
-				case 0xea:
-					tmp = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, tmp);
-					in += 16;
-					to += 4;
-				case 0xeb:
-					tmp = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, tmp);
-					in += 16;
-					to += 4;
-				case 0xec:
-					tmp = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, tmp);
-					in += 16;
-					to += 4;
-				case 0xed:
-					tmp = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, tmp);
-					in += 16;
-					to += 4;
-				case 0xee:
-					tmp = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, tmp);
-					in += 16;
-					to += 4;
-				case 0xef:
-					tmp = _mm_loadu_si128((__m128i *)in);
-					_mm_storeu_si128((__m128i *)to, tmp);
-					in += 16;
-					to += 4;
-					break;
-				case 0xf0:
-					in++;// LCOV_EXCL_LINE
-				case 0xf1:
-					in++;// LCOV_EXCL_LINE
-				case 0xf2:
-					in++;// LCOV_EXCL_LINE
-				case 0xf3:
-					in++;// LCOV_EXCL_LINE
-				case 0xf4:
-					in++;// LCOV_EXCL_LINE
-				case 0xf5:
-					in++;// LCOV_EXCL_LINE
-				case 0xf6:
-					in++;// LCOV_EXCL_LINE
-				case 0xf7:
-					in++;// LCOV_EXCL_LINE
-				case 0xf8:
-					in++;// LCOV_EXCL_LINE
-				case 0xf9:
-					in++;// LCOV_EXCL_LINE
-				case 0xfa:
-					in++;// LCOV_EXCL_LINE
-				case 0xfb:
-					in++;// LCOV_EXCL_LINE
-				case 0xfc:
-					in++;// LCOV_EXCL_LINE
-				case 0xfd:
-					in++;// LCOV_EXCL_LINE
-				case 0xfe:
-					in++;// LCOV_EXCL_LINE
-				case 0xff:
-					in++;// LCOV_EXCL_LINE
-					break; // LCOV_EXCL_LINE
-				}
-			}
-        }
+    /*!
+		@brief Decode the next few words of a sequence (up to 256 integers), for decoding a long sequence a little at a time.
+		@param to [out] The decoded integers, room for at least 256 of them.
+		@param source [in] The encoded integers.
+		@param len [in] The length (in bytes) of the source buffer.
+		@param payload_offset [in, out] Where the next payload word starts (0 to start).
+		@param key_offset [in, out] The number of keys already decoded (0 to start).
+		@param word_offset [in, out] The number of words of the next key already decoded (0 to start).
+		@param cumulative [in] Non-zero to decode d-gaps into the sequence they are the d-gaps of (as qmx_decode_d1() does).
+		@param previous [in] The value the cumulative sum starts from (the last integer the previous call wrote).
+		@return The number of integers written, 0 at the end of the sequence.
+	*/
+    size_t qmx_decode_next(uint32_t *to, const uint8_t *source, size_t len, size_t *payload_offset, size_t *key_offset, size_t *word_offset, int cumulative, uint32_t previous){
+#ifdef QMX_TRACE
+        uint64_t trace_start = trace_clock();
+        size_t payload_from = *payload_offset;
+        size_t key_from = *key_offset;
+        size_t word_from = *word_offset;
+        size_t written = JASS::compress_integer_qmx_improved::decode_next(to, source, len, payload_offset, key_offset, word_offset, cumulative != 0, previous);
+        trace_decode(QMX_TRACE_DECODE_NEXT, trace_start, source, len, payload_from, key_from, word_from, written);
+        return written;
+#else
+        return JASS::compress_integer_qmx_improved::decode_next(to, source, len, payload_offset, key_offset, word_offset, cumulative != 0, previous);
+#endif
+    }
+
+    /*!
+		@brief Return the number of integers a sequence decodes to, reading only its keys.
+		@param source [in] The encoded integers.
+		@param len [in] The length (in bytes) of the source buffer.
+		@return The number of integers encoded plus the padding in the last payload word.
+	*/
+    size_t qmx_encoded_integers(const uint8_t *source, size_t len){
+        return JASS::compress_integer_qmx_improved::encoded_integers(source, len);
+    }
+
+    /*!
+		@brief Add up the first integers of a sequence (the d-gaps, if it was encoded with qmx_encode_d1()) without decoding them.
+		@param source [in] The encoded integers.
+		@param len [in] The length (in bytes) of the source buffer.
+		@param integers [in] The number of integers to add up.
+		@return Their sum.
+	*/
+    uint64_t qmx_sum(const uint8_t *source, size_t len, size_t integers){
+        TRACE_START;
+        size_t summed;
+        uint64_t total = JASS::compress_integer_qmx_improved::sum(source, len, integers, &summed);
+        TRACE_DECODE(QMX_TRACE_SUM, source, len, summed);
+        return total;
+    }
+
+    /*!
+		@brief Check that every encoder mode and every decoder agree on one sequence (see compress_integer_qmx_improved::unittest_one()).
+		@param sequence [in] The integers.
+		@param length [in] How many.
+		@return 1 if they all agree, 0 if not (the disagreements are written to stderr).
+	*/
+    int qmx_unittest_one(const uint32_t *sequence, size_t length){
+        return JASS::compress_integer_qmx_improved::unittest_one(std::vector<uint32_t>(sequence, sequence + length));
+    }
+
+    /*!
+		@brief Run compress_integer_qmx_improved::unittest(), every encoder mode and decoder on the sequences most likely to break them.
+		@return 1 if it passes, 0 if not.
+	*/
+    int qmx_unittest(void){
+        return JASS::compress_integer_qmx_improved::unittest();
+    }
+
+    /*!
+		@brief Decode a sequence of integers encoded with this codex.
+		@param to [out] The sequence of decoded integers.
+		@param destination_integers [in] The room (in integers) in to, a key whose words don't fit isn't decoded.
+		@param source [in] The encoded integers, followed by 15 bytes that can be read.
+		@param len [in] The length (in bytes) of the source buffer.
+		@return The number of integers written (the number encoded plus the padding in the last payload word), or SIZE_MAX if
+		a key doesn't fit in to, claims words past the slack, or patches before to[0] (it stops before that key).
+	*/
+    size_t qmx_decode(uint32_t *to, size_t destination_integers, const uint8_t *source, size_t len){
+        TRACE_START;
+        size_t written = JASS::compress_integer_qmx_improved::decode(to, destination_integers, source, len);
+        TRACE_DECODE(QMX_TRACE_DECODE, source, len, written == SIZE_MAX ? 0 : written);
+        return written;
+    }
+
+    /*!
+	    @brief Return the largest number of bytes qmx_encode_pairs() can write for a postings list of the given length.
+	    @param source_integers [in] The number of (docid, tf) pairs.
+	    @return The worst case encoded length (in bytes).
+	*/
+    size_t qmx_max_encoded_length_pairs(size_t source_integers) {
+        return sizeof(uint32_t) + 2 * JASS::compress_integer_qmx_improved::max_encoded_length(source_integers);
+    }
+
+    /*!
+	    @brief Encode a postings list of docids and their term frequencies into one buffer.
+	    @details The buffer is the length (in bytes, as a little-endian 32-bit integer) of the docid encoding, then the
+	    docids encoded as d-gaps, then the term frequencies encoded as they are.  Both halves are ordinary QMX sequences side
+	    by side, so one read of the buffer streams through both.
+	    @param encoded [out] The encoded postings list.
+	    @param encoded_buffer_length [in] The length (in bytes) of encoded, at least qmx_max_encoded_length_pairs().
+	    @param docids [in] The sorted docids.
+	    @param tfs [in] The term frequency of each docid.
+	    @param source_integers [in] The number of (docid, tf) pairs.
+	    @return The number of bytes used, or 0 if encoded is too short.
+	*/
+    size_t qmx_encode_pairs(void *self, uint8_t *encoded, size_t encoded_buffer_length, const uint32_t *docids, const uint32_t *tfs, size_t source_integers) {
+        JASS::compress_integer_qmx_improved *encoder = (JASS::compress_integer_qmx_improved *)self;
+
+        if (encoded_buffer_length < qmx_max_encoded_length_pairs(source_integers))
+            return 0;
+
+        size_t docid_bytes = encoder->encode_d1(encoded + sizeof(uint32_t), encoded_buffer_length - sizeof(uint32_t), docids, source_integers, 0);
+        uint32_t header = (uint32_t)docid_bytes;
+        memcpy(encoded, &header, sizeof(header));
+
+        size_t used = sizeof(uint32_t) + docid_bytes;
+        return used + encoder->encode(encoded + used, encoded_buffer_length - used, tfs, source_integers);
+    }
+
+    /*!
+		@brief Decode a postings list encoded by qmx_encode_pairs() into its docids and term frequencies in one call.
+		@param docids [out] The docids.
+		@param tfs [out] The term frequencies.
+		@param destination_integers [in] The room (in integers) in each of docids and tfs.
+		@param source [in] The encoded postings list, followed by 15 bytes that can be read.
+		@param len [in] The length (in bytes) of the source buffer.
+		@return The number of pairs decoded, 0 if the header is corrupt, or SIZE_MAX if either half can't be decoded safely
+		(see qmx_decode()).
+	*/
+    size_t qmx_decode_pairs(uint32_t *docids, uint32_t *tfs, size_t destination_integers, const uint8_t *source, size_t len){
+        uint32_t docid_bytes;
+
+        if (len < sizeof(docid_bytes))
+            return 0;
+        memcpy(&docid_bytes, source, sizeof(docid_bytes));
+        if (docid_bytes > len - sizeof(docid_bytes))
+            return 0;
+
+        const uint8_t *tf_source = source + sizeof(docid_bytes) + docid_bytes;
+        size_t docids_decoded = qmx_decode_d1(docids, destination_integers, source + sizeof(docid_bytes), docid_bytes, 0);
+        size_t tfs_decoded = qmx_decode(tfs, destination_integers, tf_source, source + len - tf_source);
+        if (docids_decoded == SIZE_MAX || tfs_decoded == SIZE_MAX)
+            return SIZE_MAX;
+
+        return docids_decoded < tfs_decoded ? docids_decoded : tfs_decoded;
+    }
+
+    /*!
+		@brief qmx_decode_pairs() without reading or writing outside any buffer (no slack needed).
+		@param docids [out] The docids, destination_integers long.
+		@param tfs [out] The term frequencies, destination_integers long.
+		@param destination_integers [in] The number of pairs to decode.
+		@param source [in] The encoded postings list.
+		@param len [in] The length (in bytes) of the source buffer.
+		@return The number of pairs decoded, or 0 if the header is corrupt.
+	*/
+    size_t qmx_decode_pairs_checked(uint32_t *docids, uint32_t *tfs, size_t destination_integers, const uint8_t *source, size_t len){
+        uint32_t docid_bytes;
+
+        if (len < sizeof(docid_bytes))
+            return 0;
+        memcpy(&docid_bytes, source, sizeof(docid_bytes));
+        if (docid_bytes > len - sizeof(docid_bytes))
+            return 0;
+
+        const uint8_t *tf_source = source + sizeof(docid_bytes) + docid_bytes;
+        size_t docids_decoded = qmx_decode_d1_checked(docids, destination_integers, source + sizeof(docid_bytes), docid_bytes, 0);
+        size_t tfs_decoded = qmx_decode_checked(tfs, destination_integers, tf_source, source + len - tf_source);
+
+        return docids_decoded < tfs_decoded ? docids_decoded : tfs_decoded;
+    }
 }
\ No newline at end of file
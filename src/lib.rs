@@ -1,52 +1,2591 @@
+use std::cell::{Cell, RefCell};
+use std::collections::HashMap;
 use std::ffi::c_void;
+use std::fmt;
+use std::fs::File;
+use std::io;
+use std::io::Write;
+use std::os::unix::io::AsRawFd;
+use std::path::Path;
+use std::sync::{Arc, Mutex};
 
 extern {
     fn qmx_construct() -> *mut c_void;
     fn qmx_destruct(object: *mut c_void);
+    fn qmx_use_optimal_partitioning(object: *mut c_void, on: i32);
+    fn qmx_use_format_version(object: *mut c_void, version: i32);
+    fn qmx_collect_statistics(object: *mut c_void, on: i32);
+    fn qmx_statistics(object: *const c_void, statistics: *mut EncodeStatistics);
+    fn qmx_reset_statistics(object: *mut c_void);
     fn qmx_encode(object: *mut c_void, encoded: *mut u8, encoded_buffer_length: usize, source: *const u32, source_integers: usize) -> usize;
-    fn qmx_decode(to: *mut u32, destination_integers: usize, source: *const u8, len: usize);
-    fn cumulative_sum_256(data: *mut u32, length: usize);
+    fn qmx_encode_d1(object: *mut c_void, encoded: *mut u8, encoded_buffer_length: usize, source: *const u32, source_integers: usize, previous: u32) -> usize;
+    fn qmx_encode_d1_batch(object: *mut c_void, encoded: *mut u8, encoded_buffer_length: usize, lists: *const *const u32, lengths: *const usize, list_count: usize, offsets: *mut usize) -> usize;
+    fn qmx_encode_pairs(object: *mut c_void, encoded: *mut u8, encoded_buffer_length: usize, docids: *const u32, tfs: *const u32, source_integers: usize) -> usize;
+    fn qmx_max_encoded_length(source_integers: usize) -> usize;
+    fn qmx_max_encoded_length_pairs(source_integers: usize) -> usize;
+    fn qmx_max_encoded_length_batch(lengths: *const usize, list_count: usize) -> usize;
+    fn qmx_decode(to: *mut u32, destination_integers: usize, source: *const u8, len: usize) -> usize;
+    fn qmx_decode_checked(to: *mut u32, destination_integers: usize, source: *const u8, len: usize) -> usize;
+    fn qmx_decode_pairs(docids: *mut u32, tfs: *mut u32, destination_integers: usize, source: *const u8, len: usize) -> usize;
+    fn qmx_decode_pairs_checked(docids: *mut u32, tfs: *mut u32, destination_integers: usize, source: *const u8, len: usize) -> usize;
+    fn qmx_decode_next(to: *mut u32, source: *const u8, len: usize, payload_offset: *mut usize, key_offset: *mut usize, word_offset: *mut usize, cumulative: i32, previous: u32) -> usize;
+    fn qmx_decode_d1(to: *mut u32, destination_integers: usize, source: *const u8, len: usize, previous: u32) -> usize;
+    fn qmx_decode_d1_checked(to: *mut u32, destination_integers: usize, source: *const u8, len: usize, previous: u32) -> usize;
+    fn qmx_encoded_integers(source: *const u8, len: usize) -> usize;
+    fn qmx_sum(source: *const u8, len: usize, integers: usize) -> u64;
+    #[cfg(any(test, feature = "fuzzing"))]
+    fn qmx_unittest_one(sequence: *const u32, length: usize) -> i32;
+    #[cfg(any(test, feature = "fuzzing"))]
+    fn qmx_unittest() -> i32;
+    fn qmx_intersect(a: *const u32, a_length: usize, b: *const u32, b_length: usize, out: *mut u32) -> usize;
+    fn qmx_union(a: *const u32, a_length: usize, b: *const u32, b_length: usize, out: *mut u32) -> usize;
+    fn qmx_instruction_set() -> i32;
+    fn qmx_use_instruction_set(requested: i32) -> i32;
 }
 
+/// The instruction sets the native kernels are built for, narrowest first.
+#[derive(Debug, Clone, Copy, PartialEq, Eq, PartialOrd, Ord, Hash)]
+pub enum InstructionSet {
+    Sse41,
+    Avx2,
+    Avx512,
+}
+
+impl InstructionSet {
+    fn from_native(level: i32) -> InstructionSet {
+        return match level {
+            2 => InstructionSet::Avx512,
+            1 => InstructionSet::Avx2,
+            _ => InstructionSet::Sse41,
+        };
+    }
+}
+
+/// The instruction set the encoder and decoder are using.
+///
+/// This is the widest one the CPU supports (found with cpuid on first use) unless changed with [`use_instruction_set`].
+pub fn instruction_set() -> InstructionSet {
+    return InstructionSet::from_native(unsafe { qmx_instruction_set() });
+}
+
+/// Use the kernels for `requested` (or the widest the CPU supports, if that is narrower) from now on in every thread,
+/// returning the instruction set now in use.
+///
+/// The checks built with the `fuzzing` feature (`verify_round_trip()`, `verify_decoders()` and `self_test()`) switch it
+/// themselves while they run.
+pub fn use_instruction_set(requested: InstructionSet) -> InstructionSet {
+    return InstructionSet::from_native(unsafe { qmx_use_instruction_set(requested as i32) });
+}
+
+/// The encodings an encoder can write. Every decoder decodes both.
+#[derive(Debug, Clone, Copy, PartialEq, Eq, PartialOrd, Ord, Hash)]
+pub enum FormatVersion {
+    /// The original QMX selectors only.
+    Original = 1,
+    /// Also patches the odd outlier rather than widening the words around it (smaller, slightly slower to decode).
+    Patched = 2,
+}
+
+/// What an encoder has written while collecting statistics, see [`QmxEncoder::set_statistics`].
+///
+/// Bits are "lost" where an integer is stored wider than it needs: in a group of 4 stored as wide as its widest
+/// (`grouping_bits`), in a word wider than its groups need so as to make a longer run (`promotion_bits`), or in the last
+/// word of a list (`tail_bits`).
+#[repr(C)]
+#[derive(Debug, Clone, Copy, Default, PartialEq, Eq)]
+pub struct EncodeStatistics {
+    /// Lists encoded.
+    pub sequences: u64,
+    /// Integers encoded.
+    pub integers: u64,
+    /// Payload words written with each selector (`words[15]` counts patches).
+    pub words: [u64; 16],
+    /// Bytes of payload words, not counting patches.
+    pub payload_bytes: u64,
+    /// Bytes of keys, including patch keys.
+    pub key_bytes: u64,
+    /// Bytes of patches.
+    pub patch_bytes: u64,
+    /// Integers stored past the end of each list to fill its last word.
+    pub padding_integers: u64,
+    /// Bits lost storing each group of 4 integers as wide as its widest.
+    pub grouping_bits: u64,
+    /// Bits lost storing groups in a word wider than they need, so as to make a longer run.
+    pub promotion_bits: u64,
+    /// Bits lost in the last word of each list.
+    pub tail_bits: u64,
+}
+
+impl EncodeStatistics {
+    /// All the bytes written.
+    pub fn bytes(&self) -> u64 {
+        return self.payload_bytes + self.key_bytes + self.patch_bytes;
+    }
+
+    /// The average number of bytes per integer encoded.
+    pub fn bytes_per_integer(&self) -> f64 {
+        return self.bytes() as f64 / self.integers.max(1) as f64;
+    }
+}
+
+/// Errors reported by the checked entry points.
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub enum QmxError {
+    /// The output buffer is smaller than the worst case the operation may need.
+    BufferTooSmall { needed: usize, available: usize },
+    /// The encoded data is malformed (a bad count header, or fewer integers than the header says).
+    Corrupt,
+}
+
+impl fmt::Display for QmxError {
+    fn fmt(&self, f: &mut fmt::Formatter<'_>) -> fmt::Result {
+        match self {
+            QmxError::BufferTooSmall { needed, available } => write!(f, "buffer too small: need {} but only {} available", needed, available),
+            QmxError::Corrupt => write!(f, "corrupt encoding"),
+        }
+    }
+}
+
+impl std::error::Error for QmxError {}
+
+/// The largest number of bytes encoding `integers` integers can take.
+pub fn max_encoded_len(integers: usize) -> usize {
+    return unsafe { qmx_max_encoded_length(integers) };
+}
+
+/// A reusable QMX encoder.
+///
+/// Owns the native `compress_integer_qmx_improved` object so that its internal
+/// buffers stay allocated (and grown) between calls. Keep one per thread.
+pub struct QmxEncoder {
+    object: *mut c_void,
+    compressed: Vec<u8>,
+    zigzagged: Vec<u32>,
+}
+
+//the native object has no thread affinity, it just can't be shared
+unsafe impl Send for QmxEncoder {}
+
+impl QmxEncoder {
+    pub fn new() -> QmxEncoder {
+        let object = unsafe { qmx_construct() };
+        assert!(!object.is_null());
+        return QmxEncoder { object, compressed: vec![], zigzagged: vec![] };
+    }
+
+    /// Choose the selectors that give the smallest encoding (`true`) rather than the faster greedy choice (the default).
+    ///
+    /// Either decodes with the same decoder.
+    pub fn set_optimal(&mut self, on: bool) {
+        unsafe { qmx_use_optimal_partitioning(self.object, on as i32) };
+    }
+
+    /// Choose the encoding to write, the default is [`FormatVersion::Original`].
+    pub fn set_format_version(&mut self, version: FormatVersion) {
+        unsafe { qmx_use_format_version(self.object, version as i32) };
+    }
+
+    /// Start (or stop) accumulating [`EncodeStatistics`] of what this encoder writes. Off by default, as it costs a pass
+    /// over every encoding.
+    pub fn set_statistics(&mut self, on: bool) {
+        unsafe { qmx_collect_statistics(self.object, on as i32) };
+    }
+
+    /// What has been written while collecting statistics, since they were last reset.
+    pub fn statistics(&self) -> EncodeStatistics {
+        let mut statistics = EncodeStatistics::default();
+        unsafe { qmx_statistics(self.object, &mut statistics) };
+        return statistics;
+    }
+
+    /// Zero the statistics.
+    pub fn reset_statistics(&mut self) {
+        unsafe { qmx_reset_statistics(self.object) };
+    }
+
+    /// Encode a sorted list of docids as d-gaps.
+    ///
+    /// The list must be sorted, a docid smaller than the one before it costs a whole 32-bit word's worth of d-gap. Use
+    /// [`encode_raw`](QmxEncoder::encode_raw) or [`encode_zigzag`](QmxEncoder::encode_zigzag) for anything else.
+    pub fn encode(&mut self, docs: &[u32]) -> Vec<u8> {
+        let mut compressed = std::mem::take(&mut self.compressed);
+        compressed.clear();
+        self.encode_into(docs, &mut compressed);
+        let output = compressed.to_vec();
+        self.compressed = compressed;
+
+        return output;
+    }
+
+    /// Append the encoding of a sorted list of docids to `output`, returning the number of bytes written.
+    ///
+    /// Only grows `output` if it has less than [`max_encoded_len`] bytes of spare capacity.
+    pub fn encode_into(&mut self, docs: &[u32], output: &mut Vec<u8>) -> usize {
+        output.reserve(max_encoded_len(docs.len()));
+        let start = output.len();
+        unsafe {
+            let bytes = self.encode_raw_parts(docs, output.as_mut_ptr().add(start), output.capacity() - start, 0);
+            output.set_len(start + bytes);
+            return bytes;
+        }
+    }
+
+    /// Encode a sorted list of docids into `output`, returning the number of bytes written.
+    ///
+    /// `output` must be at least [`max_encoded_len`]`(docs.len())` bytes long.
+    pub fn encode_into_slice(&mut self, docs: &[u32], output: &mut [u8]) -> Result<usize, QmxError> {
+        let needed = max_encoded_len(docs.len());
+        if output.len() < needed {
+            return Err(QmxError::BufferTooSmall { needed, available: output.len() });
+        }
+
+        return Ok(unsafe { self.encode_raw_parts(docs, output.as_mut_ptr(), output.len(), 0) });
+    }
+
+    /// Encode many sorted lists of docids back to back into one arena in one call to the native encoder.
+    ///
+    /// Returns the arena and `lists.len() + 1` offsets into it, list `i` is `arena[offsets[i]..offsets[i + 1]]`.
+    pub fn encode_batch(&mut self, lists: &[&[u32]]) -> (Vec<u8>, Vec<usize>) {
+        let pointers: Vec<*const u32> = lists.iter().map(|list| list.as_ptr()).collect();
+        let lengths: Vec<usize> = lists.iter().map(|list| list.len()).collect();
+        let mut offsets = vec![0; lists.len() + 1];
+
+        let needed = unsafe { qmx_max_encoded_length_batch(lengths.as_ptr(), lengths.len()) };
+        let mut arena: Vec<u8> = Vec::with_capacity(needed);
+        unsafe {
+            let bytes = qmx_encode_d1_batch(self.object, arena.as_mut_ptr(), arena.capacity(), pointers.as_ptr(), lengths.as_ptr(), lists.len(), offsets.as_mut_ptr());
+            arena.set_len(bytes);
+        }
+
+        return (arena, offsets);
+    }
+
+    /// Encode integers as they are, without converting to d-gaps (e.g. term frequencies or impact scores), for [`decode_raw`].
+    pub fn encode_raw(&mut self, values: &[u32]) -> Vec<u8> {
+        let mut compressed = std::mem::take(&mut self.compressed);
+        compressed.clear();
+        self.encode_raw_into(values, &mut compressed);
+        let output = compressed.to_vec();
+        self.compressed = compressed;
+
+        return output;
+    }
+
+    /// Append the raw encoding of `values` to `output`, returning the number of bytes written.
+    pub fn encode_raw_into(&mut self, values: &[u32], output: &mut Vec<u8>) -> usize {
+        output.reserve(max_encoded_len(values.len()));
+        let start = output.len();
+        unsafe {
+            let bytes = qmx_encode(self.object, output.as_mut_ptr().add(start), output.capacity() - start, values.as_ptr(), values.len());
+            output.set_len(start + bytes);
+            return bytes;
+        }
+    }
+
+    /// Encode unsorted integers (e.g. positions in a document) as zigzagged differences, for [`decode_zigzag`].
+    ///
+    /// Each integer is stored as its difference from the one before, mapped so that small negative differences are small
+    /// too (0, -1, 1, -2, ... become 0, 1, 2, 3, ...).
+    pub fn encode_zigzag(&mut self, values: &[u32]) -> Vec<u8> {
+        let mut zigzagged = std::mem::take(&mut self.zigzagged);
+        zigzagged.clear();
+        let mut previous = 0u32;
+        zigzagged.extend(values.iter().map(|&value| {
+            let difference = value.wrapping_sub(previous) as i32;
+            previous = value;
+            return ((difference << 1) ^ (difference >> 31)) as u32;
+        }));
+        let output = self.encode_raw(&zigzagged);
+        self.zigzagged = zigzagged;
+
+        return output;
+    }
+
+    /// Encode a postings list of sorted docids and the term frequency of each into one buffer, for [`decode_pairs`].
+    ///
+    /// The buffer is the length of the docid encoding (a little-endian `u32`), the docids as d-gaps, then the term
+    /// frequencies as they are, so a scorer reads one contiguous stream rather than two.
+    pub fn encode_pairs(&mut self, docs: &[u32], tfs: &[u32]) -> Vec<u8> {
+        assert_eq!(docs.len(), tfs.len());
+        let mut output: Vec<u8> = Vec::with_capacity(unsafe { qmx_max_encoded_length_pairs(docs.len()) });
+        unsafe {
+            let bytes = qmx_encode_pairs(self.object, output.as_mut_ptr(), output.capacity(), docs.as_ptr(), tfs.as_ptr(), docs.len());
+            output.set_len(bytes);
+        }
+
+        return output;
+    }
+
+    /// Encode a sorted list of docids prefixed with their count, for [`decode_with_count`].
+    pub fn encode_with_count(&mut self, docs: &[u32]) -> Vec<u8> {
+        let mut output = Vec::with_capacity(MAX_COUNT_HEADER_LEN + max_encoded_len(docs.len()));
+        write_count_header(docs.len(), &mut output);
+        self.encode_into(docs, &mut output);
+
+        return output;
+    }
+
+    /// Encode a sorted list of docids as independently decodable blocks of `block_size` docids, see [`BlockedList`].
+    pub fn encode_blocked(&mut self, docs: &[u32], block_size: usize) -> Vec<u8> {
+        assert!(block_size > 0);
+        let blocks = (docs.len() + block_size - 1) / block_size;
+        let mut output: Vec<u8> = Vec::with_capacity(blocks * (max_encoded_len(block_size) + SKIP_ENTRY_LEN) + FOOTER_LEN);
+        let mut table = Vec::with_capacity(blocks * SKIP_ENTRY_LEN + FOOTER_LEN);
+
+        let mut previous = 0;
+        for block in docs.chunks(block_size) {
+            //each block is its own QMX sequence (so its keys are at its end), d-gapped from the last docid of the block before
+            let offset = output.len();
+            output.reserve(max_encoded_len(block.len()));
+            unsafe {
+                let bytes = self.encode_raw_parts(block, output.as_mut_ptr().add(offset), output.capacity() - offset, previous);
+                output.set_len(offset + bytes);
+            }
+            previous = block[block.len() - 1];
+            write_skip_entry(&mut table, previous, offset, output.len());
+        }
+        write_blocked_footer(&mut table, docs.len(), block_size, blocks);
+        output.extend_from_slice(&table);
+
+        return output;
+    }
+
+    //encoded must point to at least max_encoded_len(docs.len()) bytes, they need not be initialised
+    unsafe fn encode_raw_parts(&mut self, docs: &[u32], encoded: *mut u8, encoded_buffer_length: usize, previous: u32) -> usize {
+        //convert to d-gaps and compress postings using qmx in one pass
+        return qmx_encode_d1(self.object, encoded, encoded_buffer_length, docs.as_ptr(), docs.len(), previous);
+    }
+}
+
+impl Default for QmxEncoder {
+    fn default() -> QmxEncoder {
+        return QmxEncoder::new();
+    }
+}
+
+impl Drop for QmxEncoder {
+    fn drop(&mut self) {
+        unsafe {
+            qmx_destruct(self.object);
+        }
+    }
+}
+
+thread_local! {
+    static ENCODER: RefCell<QmxEncoder> = RefCell::new(QmxEncoder::new());
+}
+
+/// Encode a sorted list of docids using this thread's shared [`QmxEncoder`].
 pub fn encode(docs: &[u32]) -> Vec<u8> {
-    //convert to d-gaps
-    let mut source_integers = vec![0u32; docs.len()];
-    let mut prev = 0u32;
-    for curr in 0..docs.len(){
-        source_integers[curr] = docs[curr] - prev;
-        prev = docs[curr];
-    }
-    let source = source_integers.as_mut_ptr();
-    let source_length = source_integers.len();
-
-    let mut compressed = vec![0u8; 8 * docs.len() + 512 + 1024*1024];
-    let encoded = compressed.as_mut_ptr();
-    let encoded_buffer_length = compressed.len();
-
-    //compress postings using qmx
-    let mut output: Vec<u8> = vec![];
-    unsafe {
-        let qmx = qmx_construct();
-        let bytes = qmx_encode(qmx, encoded, encoded_buffer_length, source, source_length);
-        output.extend_from_slice(&compressed[..bytes]);
-        qmx_destruct(qmx);
+    return ENCODER.with(|encoder| encoder.borrow_mut().encode(docs));
+}
+
+/// [`QmxEncoder::encode_into`] using this thread's shared encoder.
+pub fn encode_into(docs: &[u32], output: &mut Vec<u8>) -> usize {
+    return ENCODER.with(|encoder| encoder.borrow_mut().encode_into(docs, output));
+}
+
+/// [`QmxEncoder::encode_into_slice`] using this thread's shared encoder.
+pub fn encode_into_slice(docs: &[u32], output: &mut [u8]) -> Result<usize, QmxError> {
+    return ENCODER.with(|encoder| encoder.borrow_mut().encode_into_slice(docs, output));
+}
+
+/// [`QmxEncoder::encode_batch`] using this thread's shared encoder.
+pub fn encode_batch(lists: &[&[u32]]) -> (Vec<u8>, Vec<usize>) {
+    return ENCODER.with(|encoder| encoder.borrow_mut().encode_batch(lists));
+}
+
+//the number of worker threads to use when asked for 0
+fn worker_threads(threads: usize) -> usize {
+    if threads != 0 {
+        return threads;
+    }
+    return std::thread::available_parallelism().map(|count| count.get()).unwrap_or(1);
+}
+
+//encoders lent to the workers of encode_batch_parallel(), kept between calls so that their buffers stay allocated
+static ENCODER_POOL: Mutex<Vec<QmxEncoder>> = Mutex::new(Vec::new());
+
+/// [`encode_batch`] split across `threads` worker threads (0 for one per core), each with its own encoder.
+///
+/// The lists are split into contiguous runs of about the same number of docids, so the arena and offsets are exactly
+/// those [`encode_batch`] returns. The workers are OS threads spawned for the call (and joined before it returns), so
+/// this only pays for itself on batches big enough to cover that. Their encoders come from a pool shared by every call,
+/// so the encoders' buffers are only allocated the first few times.
+pub fn encode_batch_parallel(lists: &[&[u32]], threads: usize) -> (Vec<u8>, Vec<usize>) {
+    let threads = worker_threads(threads).min(lists.len().max(1));
+    if threads == 1 {
+        return encode_batch(lists);
+    }
+
+    //cut the lists into runs of about total / threads docids
+    let total: usize = lists.iter().map(|list| list.len()).sum();
+    let mut ends = Vec::with_capacity(threads);
+    let mut docids = 0;
+    for (at, list) in lists.iter().enumerate() {
+        docids += list.len();
+        if docids * threads >= total * (ends.len() + 1) && ends.len() + 1 < threads {
+            ends.push(at + 1);
+        }
+    }
+    ends.push(lists.len());
+
+    let parts: Vec<(Vec<u8>, Vec<usize>)> = std::thread::scope(|scope| {
+        let mut start = 0;
+        let mut workers = Vec::with_capacity(ends.len());
+        for &end in &ends {
+            let run = &lists[start..end];
+            workers.push(scope.spawn(move || {
+                let mut encoder = ENCODER_POOL.lock().unwrap().pop().unwrap_or_default();
+                let part = encoder.encode_batch(run);
+                ENCODER_POOL.lock().unwrap().push(encoder);
+                return part;
+            }));
+            start = end;
+        }
+        return workers.into_iter().map(|worker| worker.join().unwrap()).collect();
+    });
+
+    let mut arena = Vec::with_capacity(parts.iter().map(|(part, _)| part.len()).sum());
+    let mut offsets = Vec::with_capacity(lists.len() + 1);
+    for (part, part_offsets) in &parts {
+        let base = arena.len();
+        offsets.extend(part_offsets[..part_offsets.len() - 1].iter().map(|offset| base + offset));
+        arena.extend_from_slice(part);
     }
+    offsets.push(arena.len());
+
+    return (arena, offsets);
+}
+
+/// [`QmxEncoder::encode_blocked`] using this thread's shared encoder.
+pub fn encode_blocked(docs: &[u32], block_size: usize) -> Vec<u8> {
+    return ENCODER.with(|encoder| encoder.borrow_mut().encode_blocked(docs, block_size));
+}
+
+/// [`QmxEncoder::encode_with_count`] using this thread's shared encoder.
+pub fn encode_with_count(docs: &[u32]) -> Vec<u8> {
+    return ENCODER.with(|encoder| encoder.borrow_mut().encode_with_count(docs));
+}
+
+/// [`QmxEncoder::encode_pairs`] using this thread's shared encoder.
+pub fn encode_pairs(docs: &[u32], tfs: &[u32]) -> Vec<u8> {
+    return ENCODER.with(|encoder| encoder.borrow_mut().encode_pairs(docs, tfs));
+}
+
+/// [`QmxEncoder::encode_raw`] using this thread's shared encoder.
+pub fn encode_raw(values: &[u32]) -> Vec<u8> {
+    return ENCODER.with(|encoder| encoder.borrow_mut().encode_raw(values));
+}
+
+/// [`QmxEncoder::encode_zigzag`] using this thread's shared encoder.
+pub fn encode_zigzag(values: &[u32]) -> Vec<u8> {
+    return ENCODER.with(|encoder| encoder.borrow_mut().encode_zigzag(values));
+}
 
-    return output;
+/// Decode sorted docids, returning the number of integers written.
+///
+/// The encoding doesn't record how many docids there are so this is the number encoded rounded up to the end of the
+/// last payload word, the caller has to know `count`. `output_buf` needs 256 integers of slack past it (this panics if it
+/// hasn't), and up to 15 bytes past the end of `data` are read, see [`decode_checked`] for when neither can be arranged.
+/// This also panics on an encoding with a patch that points before the start of `output_buf`, which only a corrupt one has.
+pub fn decode(data: &[u8], output_buf: &mut[u32], count: u32) -> usize {
+    return decode_with_base(data, output_buf, count, 0);
 }
 
-pub fn decode(data: &[u8], output_buf: &mut[u32], count: u32){
+/// Decode d-gaps that continue on from `previous` (e.g. the last docid of the previous block).
+pub fn decode_with_base(data: &[u8], output_buf: &mut[u32], count: u32, previous: u32) -> usize {
+    assert_decode_slack(output_buf.len(), count);
     let source = data.as_ptr();
     let source_length = data.len();
 
     let decoded = output_buf.as_mut_ptr();
-    let integers_to_decode = count as usize;
+    let integers_to_decode = output_buf.len();
 
-    //decompress postings using qmx
+    //decompress postings using qmx, converting from d-gaps as we go
     unsafe{
-        qmx_decode(decoded, integers_to_decode,source, source_length);
-        //convert from d-gaps efficiently
-        cumulative_sum_256(decoded, integers_to_decode);
+        return assert_decoded(qmx_decode_d1(decoded, integers_to_decode, source, source_length, previous));
+    }
+}
+
+/// Decode sorted docids into `output`, filling at most `output.len()` of them, returning the number written.
+///
+/// Unlike [`decode`] neither `data` nor `output` need any slack past their ends.
+pub fn decode_checked(data: &[u8], output: &mut [u32]) -> usize {
+    return decode_checked_with_base(data, output, 0);
+}
+
+/// [`decode_checked`] for d-gaps that continue on from `previous`.
+pub fn decode_checked_with_base(data: &[u8], output: &mut [u32], previous: u32) -> usize {
+    return unsafe { qmx_decode_d1_checked(output.as_mut_ptr(), output.len(), data.as_ptr(), data.len(), previous) };
+}
+
+/// Decode the docids and term frequencies of a postings list encoded by [`encode_pairs`] in one call.
+///
+/// As with [`decode`], the caller has to know `count`, both buffers need 256 integers of slack past it (this panics if
+/// they haven't), and up to 15 bytes past the end of `data` are read. Returns the number of pairs written (at least
+/// `count`), or [`QmxError::Corrupt`] if the header is bad.
+pub fn decode_pairs(data: &[u8], docids_buf: &mut [u32], tfs_buf: &mut [u32], count: u32) -> Result<usize, QmxError> {
+    if data.len() < 4 || read_u32(data, 0) as usize > data.len() - 4 {
+        return Err(QmxError::Corrupt);
+    }
+    let room = docids_buf.len().min(tfs_buf.len());
+    assert_decode_slack(room, count);
+    let written = assert_decoded(unsafe { qmx_decode_pairs(docids_buf.as_mut_ptr(), tfs_buf.as_mut_ptr(), room, data.as_ptr(), data.len()) });
+    if written < count as usize {
+        return Err(QmxError::Corrupt);
+    }
+
+    return Ok(written);
+}
+
+/// [`decode_pairs`] filling at most `docids.len()` pairs, with no slack needed in any buffer.
+pub fn decode_pairs_checked(data: &[u8], docids: &mut [u32], tfs: &mut [u32]) -> Result<usize, QmxError> {
+    if tfs.len() < docids.len() {
+        return Err(QmxError::BufferTooSmall { needed: docids.len(), available: tfs.len() });
+    }
+    if data.len() < 4 || read_u32(data, 0) as usize > data.len() - 4 {
+        return Err(QmxError::Corrupt);
+    }
+
+    return Ok(unsafe { qmx_decode_pairs_checked(docids.as_mut_ptr(), tfs.as_mut_ptr(), docids.len(), data.as_ptr(), data.len()) });
+}
+
+/// Decode integers encoded by [`encode_raw`] (no prefix sum), returning the number of integers written.
+///
+/// As with [`decode`], `output_buf` needs 256 integers of slack past `count` (this panics if it hasn't), and the last
+/// payload word is loaded whole, so up to 15 bytes past the end of `data` are read (a [`Segment`] has them). Use
+/// [`decode_raw_checked`] where neither can be arranged.
+pub fn decode_raw(data: &[u8], output_buf: &mut [u32], count: u32) -> usize {
+    assert_decode_slack(output_buf.len(), count);
+    return assert_decoded(unsafe { qmx_decode(output_buf.as_mut_ptr(), output_buf.len(), data.as_ptr(), data.len()) });
+}
+
+/// [`decode_raw`] filling at most `output.len()` integers, with no slack needed in either buffer.
+pub fn decode_raw_checked(data: &[u8], output: &mut [u32]) -> usize {
+    return unsafe { qmx_decode_checked(output.as_mut_ptr(), output.len(), data.as_ptr(), data.len()) };
+}
+
+//turn zigzagged differences back into the integers they are the differences of
+fn unzigzag(values: &mut [u32]) {
+    let mut previous = 0u32;
+    for value in values {
+        previous = previous.wrapping_add((*value >> 1) ^ (*value & 1).wrapping_neg());
+        *value = previous;
+    }
+}
+
+/// Decode integers encoded by [`encode_zigzag`], returning the number of integers written.
+///
+/// As with [`decode_raw`], `output_buf` needs 256 integers of slack past `count` (this panics if it hasn't) and up to 15
+/// bytes past the end of `data` are read. Only the first `count` integers are meaningful.
+pub fn decode_zigzag(data: &[u8], output_buf: &mut [u32], count: u32) -> usize {
+    let written = decode_raw(data, output_buf, count);
+    unzigzag(&mut output_buf[..(count as usize).min(written)]);
+
+    return written;
+}
+
+/// [`decode_zigzag`] filling at most `output.len()` integers, with no slack needed in either buffer.
+pub fn decode_zigzag_checked(data: &[u8], output: &mut [u32]) -> usize {
+    let written = decode_raw_checked(data, output);
+    unzigzag(&mut output[..written]);
+
+    return written;
+}
+
+/// The number of integers [`decode`] (or any of the decoders) writes for `data`, found from its keys without reading the payload.
+///
+/// This is the number encoded rounded up to the end of the last payload word, so it is an upper bound on the length of the list.
+pub fn encoded_integers(data: &[u8]) -> usize {
+    return unsafe { qmx_encoded_integers(data.as_ptr(), data.len()) };
+}
+
+/// The sum of the first `count` integers encoded by [`encode_raw`] (for example the term frequencies of a postings list),
+/// added up a payload word at a time without decoding them.
+pub fn sum_raw(data: &[u8], count: usize) -> u64 {
+    return unsafe { qmx_sum(data.as_ptr(), data.len(), count) };
+}
+
+/// The last of the `count` docids encoded by [`encode`] (its largest), without decoding them, or 0 if `count` is 0.
+pub fn last_docid(data: &[u8], count: usize) -> u32 {
+    return last_docid_with_base(data, count, 0);
+}
+
+/// [`last_docid`] for d-gaps that continue on from `previous`, which is returned if `count` is 0.
+pub fn last_docid_with_base(data: &[u8], count: usize, previous: u32) -> u32 {
+    //the docids are the cumulative sum of the d-gaps, so the last is the sum of them all
+    return previous.wrapping_add(unsafe { qmx_sum(data.as_ptr(), data.len(), count) } as u32);
+}
+
+/// The last docid and the total of the term frequencies of the `count` pairs of a postings list encoded by [`encode_pairs`],
+/// without decoding either half.
+pub fn pairs_totals(data: &[u8], count: usize) -> Result<(u32, u64), QmxError> {
+    if data.len() < 4 || read_u32(data, 0) as usize > data.len() - 4 {
+        return Err(QmxError::Corrupt);
+    }
+    let tfs = 4 + read_u32(data, 0) as usize;
+
+    return Ok((last_docid(&data[4..tfs], count), sum_raw(&data[tfs..], count)));
+}
+
+//a usize as a varint is at most this long
+const MAX_COUNT_HEADER_LEN: usize = 10;
+
+//write count as a varint (7 bits per byte, low bits first, the top bit set on all but the last byte)
+fn write_count_header(mut count: usize, output: &mut Vec<u8>) {
+    while count >= 0x80 {
+        output.push((count as u8) | 0x80);
+        count >>= 7;
+    }
+    output.push(count as u8);
+}
+
+/// The number of docids in an encoding made by [`encode_with_count`], and the length of the header that says so.
+pub fn encoded_count(data: &[u8]) -> Result<(usize, usize), QmxError> {
+    let mut count: usize = 0;
+    for (at, byte) in data.iter().take(MAX_COUNT_HEADER_LEN).enumerate() {
+        count |= ((byte & 0x7F) as usize).checked_shl(7 * at as u32).ok_or(QmxError::Corrupt)?;
+        if byte & 0x80 == 0 {
+            return Ok((count, at + 1));
+        }
+    }
+    return Err(QmxError::Corrupt);
+}
+
+/// Decode an encoding made by [`encode_with_count`] into `output`, which is resized to exactly the number of docids.
+///
+/// Neither buffer needs any slack, returns the number of docids.
+pub fn decode_with_count(data: &[u8], output: &mut Vec<u32>) -> Result<usize, QmxError> {
+    let (count, header_length) = encoded_count(data)?;
+    //one selector byte stands for at most 16 words of 256 integers, so a count bigger than that is corrupt (and not worth allocating for)
+    if count > (data.len() - header_length).saturating_mul(16 * 256) {
+        return Err(QmxError::Corrupt);
+    }
+    output.clear();
+    output.resize(count, 0);
+    if decode_checked(&data[header_length..], output) != count {
+        return Err(QmxError::Corrupt);
+    }
+
+    return Ok(count);
+}
+
+//decode() may write this many integers past the end of the list
+const DECODE_SLACK: usize = 256;
+
+//the fast decoders write whole payload words, so the last one may end this far past count
+fn assert_decode_slack(output_length: usize, count: u32) {
+    assert!(output_length >= count as usize + DECODE_SLACK, "the output needs {} integers of slack past the {} decoded, it has {}", DECODE_SLACK, count, output_length);
+}
+
+//the fast decoders check each key as they get to it and stop (returning usize::MAX) before one whose words don't fit in
+//the output, that claims more payload than there can be, or that patches before the start of the output
+fn assert_decoded(written: usize) -> usize {
+    assert!(written != usize::MAX, "the encoding doesn't fit in the output or patches an integer before its start");
+    return written;
+}
+
+//the unit an arena hands out, so that every slab starts on a cache line
+#[repr(C, align(64))]
+#[derive(Clone, Copy)]
+struct CacheLine([u32; 16]);
+
+/// A per-thread bump allocator for decode output, so that decoding the lists of a query allocates nothing.
+///
+/// [`slab`](DecodeArena::slab) hands out 64-byte aligned buffers with room for the 256 integers [`decode`] may write
+/// past the end of the list, and [`reset`](DecodeArena::reset) takes them all back at once (in O(1)) when the query is
+/// done. The arena keeps its chunks between queries and hands them out again in the same order, so once it has grown to
+/// fit the largest query it doesn't allocate at all. [`with_decode_arena`] lends out one arena per thread.
+pub struct DecodeArena {
+    //each chunk is a Box<[CacheLine]> turned into a raw pointer (and its length), so the slabs handed out of it don't
+    //alias any reference the arena holds
+    chunks: RefCell<Vec<(*mut CacheLine, usize)>>,
+    //the chunk slabs are being handed out of, and the cache lines of it handed out so far
+    current: Cell<usize>,
+    used: Cell<usize>,
+}
+
+impl DecodeArena {
+    pub fn new() -> DecodeArena {
+        return DecodeArena::with_capacity(0);
+    }
+
+    /// An arena that can hand out `integers` integers (including their slack) before it needs to allocate.
+    pub fn with_capacity(integers: usize) -> DecodeArena {
+        let arena = DecodeArena { chunks: RefCell::new(vec![]), current: Cell::new(0), used: Cell::new(0) };
+        if integers > 0 {
+            arena.add_chunk((integers + 15) / 16);
+        }
+        return arena;
+    }
+
+    fn add_chunk(&self, lines: usize) {
+        let chunk = Box::into_raw(vec![CacheLine([0; 16]); lines].into_boxed_slice()) as *mut CacheLine;
+        self.chunks.borrow_mut().push((chunk, lines));
+    }
+
+    /// The number of integers the arena holds, whether handed out or not.
+    pub fn capacity(&self) -> usize {
+        return self.chunks.borrow().iter().map(|&(_, lines)| lines * 16).sum();
+    }
+
+    /// A buffer of `count` integers plus the slack [`decode`] needs, starting on a 64-byte boundary. What's in it is
+    /// left over from earlier queries.
+    #[allow(clippy::mut_from_ref)]
+    pub fn slab(&self, count: usize) -> &mut [u32] {
+        let lines = (count + DECODE_SLACK + 15) / 16;
+        //move on through the chunks kept from earlier queries to one with room, adding one at the end if none has
+        while self.chunks.borrow().get(self.current.get()).map_or(true, |&(_, length)| length - self.used.get() < lines) {
+            if self.current.get() < self.chunks.borrow().len() {
+                self.current.set(self.current.get() + 1);
+                self.used.set(0);
+            }
+            if self.current.get() == self.chunks.borrow().len() {
+                //at least double, so a query needs only a few chunks however big it is
+                self.add_chunk(lines.max(self.capacity() / 16));
+            }
+        }
+
+        let (chunk, _) = self.chunks.borrow()[self.current.get()];
+        let used = self.used.get();
+        self.used.set(used + lines);
+        //the lines from used on have never been handed out since the last reset(), which needs &mut self
+        return unsafe { std::slice::from_raw_parts_mut(chunk.add(used) as *mut u32, count + DECODE_SLACK) };
+    }
+
+    /// [`decode`] into a slab, returning exactly the `count` docids.
+    pub fn decode(&self, data: &[u8], count: usize) -> &mut [u32] {
+        return self.decode_with_base(data, count, 0);
+    }
+
+    /// [`decode_with_base`] into a slab, returning exactly the `count` docids.
+    #[allow(clippy::mut_from_ref)]
+    pub fn decode_with_base(&self, data: &[u8], count: usize, previous: u32) -> &mut [u32] {
+        let slab = self.slab(count);
+        decode_with_base(data, slab, count as u32, previous);
+        return &mut slab[..count];
+    }
+
+    /// Take back every slab (the borrow checker makes sure none are still in use), keeping the chunks for the next query.
+    pub fn reset(&mut self) {
+        self.current.set(0);
+        self.used.set(0);
+    }
+
+    fn free_chunks(&mut self) {
+        for (chunk, lines) in self.chunks.get_mut().drain(..) {
+            unsafe {
+                drop(Box::from_raw(std::ptr::slice_from_raw_parts_mut(chunk, lines)));
+            }
+        }
+    }
+}
+
+impl Default for DecodeArena {
+    fn default() -> DecodeArena {
+        return DecodeArena::new();
+    }
+}
+
+impl Drop for DecodeArena {
+    fn drop(&mut self) {
+        self.free_chunks();
+    }
+}
+
+thread_local! {
+    static ARENA: RefCell<DecodeArena> = RefCell::new(DecodeArena::new());
+}
+
+/// Run `query` with this thread's [`DecodeArena`], resetting it when `query` returns.
+///
+/// Panics if called again from inside `query` (use the arena it was given instead).
+pub fn with_decode_arena<R>(query: impl FnOnce(&DecodeArena) -> R) -> R {
+    return ARENA.with(|arena| {
+        let mut arena = arena.borrow_mut();
+        let result = query(&arena);
+        arena.reset();
+        return result;
+    });
+}
+
+//the most integers one key can stand for
+const MAX_INTEGERS_PER_KEY: usize = 16 * 256;
+//the most integers one call to qmx_decode_next() writes (it stops part way through a key that stands for more)
+const MAX_INTEGERS_PER_CALL: usize = 256;
+
+/// Decodes a list at most 256 integers at a time into a small buffer of its own, yielding the integers one by one.
+///
+/// The buffer is part of the decoder, so making one allocates nothing, and nothing past the integers consumed is
+/// decoded, so a query that stops early only pays for what it used. Neither slack nor a count header is needed.
+pub struct QmxDecoder<'a> {
+    data: &'a [u8],
+    payload: usize,
+    keys: usize,
+    words: usize,
+    cumulative: bool,
+    previous: u32,
+    remaining: usize,
+    buffer: [u32; MAX_INTEGERS_PER_CALL],
+    position: usize,
+    filled: usize,
+}
+
+impl<'a> QmxDecoder<'a> {
+    /// Decode the `count` sorted docids encoded by [`encode`].
+    pub fn new(data: &'a [u8], count: usize) -> QmxDecoder<'a> {
+        return QmxDecoder::with_base(data, count, 0);
+    }
+
+    /// Decode `count` d-gaps that continue on from `previous`.
+    pub fn with_base(data: &'a [u8], count: usize, previous: u32) -> QmxDecoder<'a> {
+        return QmxDecoder { data, payload: 0, keys: 0, words: 0, cumulative: true, previous, remaining: count, buffer: [0; MAX_INTEGERS_PER_CALL], position: 0, filled: 0 };
+    }
+
+    /// Decode the `count` integers encoded by [`encode_raw`].
+    pub fn raw(data: &'a [u8], count: usize) -> QmxDecoder<'a> {
+        let mut decoder = QmxDecoder::with_base(data, count, 0);
+        decoder.cumulative = false;
+        return decoder;
+    }
+
+    /// Decode the docids encoded by [`encode_with_count`].
+    pub fn with_count(data: &'a [u8]) -> Result<QmxDecoder<'a>, QmxError> {
+        let (count, header_length) = encoded_count(data)?;
+        return Ok(QmxDecoder::new(&data[header_length..], count));
+    }
+
+    /// Decode the next run of integers (at most 256), returning them (empty at the end of the list).
+    ///
+    /// Integers already returned by [`next`](Iterator::next) aren't returned again.
+    pub fn next_run(&mut self) -> &[u32] {
+        if self.position == self.filled {
+            self.refill();
+        }
+        let run = &self.buffer[self.position..self.filled];
+        self.position = self.filled;
+
+        return run;
+    }
+
+    fn refill(&mut self) {
+        self.position = 0;
+        self.filled = 0;
+        if self.remaining == 0 {
+            return;
+        }
+
+        let written = unsafe { qmx_decode_next(self.buffer.as_mut_ptr(), self.data.as_ptr(), self.data.len(), &mut self.payload, &mut self.keys, &mut self.words, self.cumulative as i32, self.previous) };
+        if written == 0 {
+            //the encoding has fewer integers than it should, stop
+            self.remaining = 0;
+            return;
+        }
+        self.previous = self.buffer[written - 1];
+        self.filled = written.min(self.remaining);
+        self.remaining -= self.filled;
+    }
+}
+
+impl<'a> Iterator for QmxDecoder<'a> {
+    type Item = u32;
+
+    fn next(&mut self) -> Option<u32> {
+        if self.position == self.filled {
+            self.refill();
+            if self.filled == 0 {
+                return None;
+            }
+        }
+        self.position += 1;
+
+        return Some(self.buffer[self.position - 1]);
+    }
+
+    //a run at a time, so that sum(), for_each() and the like don't check for the end of the buffer every integer
+    fn fold<B, F: FnMut(B, u32) -> B>(mut self, initial: B, mut f: F) -> B {
+        let mut accumulator = initial;
+        loop {
+            let run = self.next_run();
+            if run.is_empty() {
+                return accumulator;
+            }
+            for &integer in run {
+                accumulator = f(accumulator, integer);
+            }
+        }
+    }
+
+    fn size_hint(&self) -> (usize, Option<usize>) {
+        let most = self.remaining + self.filled - self.position;
+        return (0, Some(most));
+    }
+}
+
+//a skip table entry is the last docid in the block, the offset of its first payload byte, and the offset of its first key (its last byte)
+const SKIP_ENTRY_LEN: usize = 12;
+//the footer is the number of docids, the number of docids per block, and the number of blocks
+const FOOTER_LEN: usize = 12;
+
+//add the skip table entry for a block ending with docid last whose encoding is output[offset..end]
+fn write_skip_entry(table: &mut Vec<u8>, last: u32, offset: usize, end: usize) {
+    table.extend_from_slice(&last.to_le_bytes());
+    table.extend_from_slice(&u32::try_from(offset).expect("blocked list too long").to_le_bytes());
+    table.extend_from_slice(&u32::try_from(end - 1).expect("blocked list too long").to_le_bytes());
+}
+
+fn write_blocked_footer(table: &mut Vec<u8>, count: usize, block_size: usize, blocks: usize) {
+    table.extend_from_slice(&u32::try_from(count).expect("blocked list too long").to_le_bytes());
+    table.extend_from_slice(&u32::try_from(block_size).expect("block too long").to_le_bytes());
+    table.extend_from_slice(&u32::try_from(blocks).expect("blocked list too long").to_le_bytes());
+}
+
+fn read_u32(data: &[u8], at: usize) -> u32 {
+    return u32::from_le_bytes([data[at], data[at + 1], data[at + 2], data[at + 3]]);
+}
+
+/// A postings list encoded by [`encode_blocked`], decoded a block at a time as it's searched.
+///
+/// The blocks are followed by a skip table with one entry per block, then a footer:
+/// ```text
+/// block 0 | block 1 | ... | (last docid, payload offset, key offset) * blocks | docids | docids per block | blocks
+/// ```
+/// all as little-endian `u32`s. Each block is a complete QMX sequence whose d-gaps start from the last docid of the block
+/// before, so any block can be decoded on its own.
+pub struct BlockedList<'a> {
+    data: &'a [u8],
+    table: usize,
+    count: usize,
+    block_size: usize,
+    blocks: usize,
+    block: usize,
+    position: usize,
+    decoded_block: usize,
+    decoded: Vec<u32>,
+}
+
+impl<'a> BlockedList<'a> {
+    /// Check the footer of `data` and that its skip table fits, and get ready to search it.
+    ///
+    /// This doesn't walk the skip table, so it costs the same however long the list is. Each entry is checked against the
+    /// ones around it when its block is decoded, so a corrupt entry is an error from the search that reaches it.
+    pub fn new(data: &'a [u8]) -> Result<BlockedList<'a>, QmxError> {
+        if data.len() < FOOTER_LEN {
+            return Err(QmxError::Corrupt);
+        }
+        let footer = data.len() - FOOTER_LEN;
+        let count = read_u32(data, footer) as usize;
+        let block_size = read_u32(data, footer + 4) as usize;
+        let blocks = read_u32(data, footer + 8) as usize;
+        if block_size == 0 || blocks != (count + block_size - 1) / block_size || blocks * SKIP_ENTRY_LEN > footer {
+            return Err(QmxError::Corrupt);
+        }
+        let table = footer - blocks * SKIP_ENTRY_LEN;
+        //one byte of the blocks (a key) stands for at most MAX_INTEGERS_PER_KEY docids, so a footer claiming more is corrupt
+        if count > table.saturating_mul(MAX_INTEGERS_PER_KEY) {
+            return Err(QmxError::Corrupt);
+        }
+
+        //the decode buffer grows to the longest block decoded, so a footer claiming huge blocks allocates nothing up front
+        return Ok(BlockedList { data, table, count, block_size, blocks, block: 0, position: 0, decoded_block: usize::MAX, decoded: vec![] });
+    }
+
+    /// The number of docids in the list.
+    pub fn len(&self) -> usize {
+        return self.count;
+    }
+
+    pub fn is_empty(&self) -> bool {
+        return self.count == 0;
+    }
+
+    /// The last (largest) docid in the list, from the skip table, or `None` if the list is empty.
+    pub fn last(&self) -> Option<u32> {
+        if self.blocks == 0 {
+            return None;
+        }
+
+        return Some(self.last_docid(self.blocks - 1));
+    }
+
+    /// The number of blocks in the list.
+    pub fn block_count(&self) -> usize {
+        return self.blocks;
+    }
+
+    fn entry(&self, block: usize) -> (u32, usize, usize) {
+        let at = self.table + block * SKIP_ENTRY_LEN;
+        return (read_u32(self.data, at), read_u32(self.data, at + 4) as usize, read_u32(self.data, at + 8) as usize);
+    }
+
+    fn last_docid(&self, block: usize) -> u32 {
+        return read_u32(self.data, self.table + block * SKIP_ENTRY_LEN);
+    }
+
+    //the number of docids in block
+    fn block_len(&self, block: usize) -> usize {
+        return self.block_size.min(self.count - block * self.block_size);
     }
-    
-}
\ No newline at end of file
+
+    //the first and last byte of block, checked against the skip table entries either side of it: the blocks are back to
+    //back before the table, their last docids never go down, and no key stands for more than MAX_INTEGERS_PER_KEY docids
+    fn block_bytes(&self, block: usize) -> Result<(usize, usize), QmxError> {
+        let (last, offset, keys) = self.entry(block);
+        let (previous, end) = if block == 0 { (0, 0) } else { let (previous, _, keys) = self.entry(block - 1); (previous, keys + 1) };
+        if offset != end || keys < offset || keys >= self.table || last < previous || self.block_len(block) > (keys + 1 - offset) * MAX_INTEGERS_PER_KEY {
+            return Err(QmxError::Corrupt);
+        }
+
+        return Ok((offset, keys));
+    }
+
+    //decode block into output, which is exactly block_len(block) long
+    fn decode_block_into(&self, block: usize, output: &mut [u32]) -> Result<(), QmxError> {
+        let (offset, keys) = self.block_bytes(block)?;
+        let previous = if block == 0 { 0 } else { self.last_docid(block - 1) };
+        if decode_checked_with_base(&self.data[offset..=keys], output, previous) != output.len() {
+            return Err(QmxError::Corrupt);
+        }
+        //the searches rely on the skip table, so it has to agree with what the block holds
+        if output.last() != Some(&self.last_docid(block)) {
+            return Err(QmxError::Corrupt);
+        }
+
+        return Ok(());
+    }
+
+    /// Decode block `block` (without touching any other block), returning its docids.
+    pub fn decode_block(&mut self, block: usize) -> Result<&[u32], QmxError> {
+        assert!(block < self.blocks);
+        let integers = self.block_len(block);
+        if self.decoded_block != block {
+            //check the entry before growing the buffer to what it claims
+            self.block_bytes(block)?;
+            let mut decoded = std::mem::take(&mut self.decoded);
+            if decoded.len() < integers {
+                decoded.resize(integers, 0);
+            }
+            self.decoded_block = usize::MAX;
+            let result = self.decode_block_into(block, &mut decoded[..integers]);
+            self.decoded = decoded;
+            result?;
+            self.decoded_block = block;
+        }
+
+        return Ok(&self.decoded[..integers]);
+    }
+
+    /// Move forward to the first docid at or after `target` and return it, or `None` if there isn't one.
+    ///
+    /// Like the cursor of a conjunctive query this never moves backwards, a `target` before the current docid returns the
+    /// current docid. Only the block holding the answer is decoded, the ones skipped over are found from the skip table.
+    pub fn next_geq(&mut self, target: u32) -> Option<u32> {
+        self.skip_to(target);
+        if self.block == self.blocks {
+            return None;
+        }
+
+        let position = self.position;
+        let docids = self.decode_block(self.block).ok()?;
+        let found = position + docids[position..].partition_point(|&docid| docid < target);
+        //the block ends at or after target, unless its docids aren't sorted (which only a corrupt encoding can do)
+        let docid = *docids.get(found)?;
+        self.position = found;
+
+        return Some(docid);
+    }
+
+    //move forward to the first block ending at or after target (or blocks if there isn't one)
+    fn skip_to(&mut self, target: u32) {
+        if self.block < self.blocks && self.last_docid(self.block) < target {
+            //binary search the rest of the skip table for the first block ending at or after target
+            let mut low = self.block + 1;
+            let mut high = self.blocks;
+            while low < high {
+                let middle = low + (high - low) / 2;
+                if self.last_docid(middle) < target {
+                    low = middle + 1;
+                } else {
+                    high = middle;
+                }
+            }
+            self.block = low;
+            self.position = 0;
+        }
+    }
+
+    //append the docids of candidates (sorted, and all after any passed to an earlier call) that are in the list to output,
+    //decoding only the blocks that might hold one of them
+    fn intersect_into(&mut self, candidates: &[u32], output: &mut Vec<u32>) -> Result<(), QmxError> {
+        let mut from = 0;
+        while from < candidates.len() {
+            self.skip_to(candidates[from]);
+            if self.block == self.blocks {
+                break;
+            }
+            let last = self.last_docid(self.block);
+            let docids = self.decode_block(self.block)?;
+            intersect_append(&candidates[from..], docids, output);
+            //the next block of candidates may start in this block, so only move past it once it's used up
+            if last >= candidates[candidates.len() - 1] {
+                break;
+            }
+            from += candidates[from..].partition_point(|&docid| docid <= last);
+        }
+
+        return Ok(());
+    }
+
+    /// Go back to the start of the list.
+    pub fn reset(&mut self) {
+        self.block = 0;
+        self.position = 0;
+    }
+
+    /// [`decode_all`](BlockedList::decode_all) split across `threads` worker threads (0 for one per core), each decoding a
+    /// contiguous range of blocks straight into its part of `output`.
+    ///
+    /// The workers are OS threads spawned for the call (and joined before it returns), so this is for decoding long lists
+    /// in bulk, not for a per-query path, where the spawning would cost more than the decoding saves.
+    pub fn decode_all_parallel(&self, output: &mut Vec<u32>, threads: usize) -> Result<usize, QmxError> {
+        output.clear();
+        output.resize(self.count, 0);
+        if self.blocks == 0 {
+            return Ok(0);
+        }
+        let workers = worker_threads(threads);
+        let blocks_per_worker = (self.blocks + workers - 1) / workers;
+
+        std::thread::scope(|scope| {
+            let workers: Vec<_> = output.chunks_mut(blocks_per_worker * self.block_size).enumerate().map(|(worker, range)| {
+                scope.spawn(move || {
+                    for (at, docids) in range.chunks_mut(self.block_size).enumerate() {
+                        self.decode_block_into(worker * blocks_per_worker + at, docids)?;
+                    }
+                    return Ok(());
+                })
+            }).collect();
+            return workers.into_iter().map(|worker| worker.join().unwrap()).collect::<Result<(), QmxError>>();
+        })?;
+
+        return Ok(self.count);
+    }
+
+    /// Decode the whole list into `output`, which is resized to exactly the number of docids.
+    pub fn decode_all(&mut self, output: &mut Vec<u32>) -> Result<usize, QmxError> {
+        output.clear();
+        output.reserve(self.count);
+        for block in 0..self.blocks {
+            let docids = self.decode_block(block)?;
+            output.extend_from_slice(docids);
+        }
+
+        return Ok(self.count);
+    }
+}
+
+//the kernels write whole vectors, so the output of an intersection needs this many integers of slack
+const INTERSECT_SLACK: usize = 8;
+
+fn intersect_append(a: &[u32], b: &[u32], output: &mut Vec<u32>) {
+    output.reserve(a.len().min(b.len()) + INTERSECT_SLACK);
+    unsafe {
+        let at = output.len();
+        let found = qmx_intersect(a.as_ptr(), a.len(), b.as_ptr(), b.len(), output.as_mut_ptr().add(at));
+        output.set_len(at + found);
+    }
+}
+
+/// The docids in both `a` and `b` (each strictly increasing), compared 8 or 4 at a time with the SIMD kernels. `output`
+/// is replaced with them, and their number is returned.
+pub fn intersect_sorted(a: &[u32], b: &[u32], output: &mut Vec<u32>) -> usize {
+    output.clear();
+    intersect_append(a, b, output);
+    return output.len();
+}
+
+/// The docids in either `a` or `b` (each strictly increasing), once each, merged by a scalar branch-free loop (unlike
+/// [`intersect_sorted`] there's no SIMD kernel). `output` is replaced with them, and their number is returned.
+pub fn union_sorted(a: &[u32], b: &[u32], output: &mut Vec<u32>) -> usize {
+    output.clear();
+    union_append(a, b, output);
+    return output.len();
+}
+
+//append the docids in either a or b to output
+fn union_append(a: &[u32], b: &[u32], output: &mut Vec<u32>) {
+    output.reserve(a.len() + b.len());
+    unsafe {
+        let at = output.len();
+        let found = qmx_union(a.as_ptr(), a.len(), b.as_ptr(), b.len(), output.as_mut_ptr().add(at));
+        output.set_len(at + found);
+    }
+}
+
+//append the docids in any of runs to output, merging them in pairs, then pairs of those, and so on, so each is copied
+//about log2(runs) times. pool holds buffers for the merges in between, kept from call to call
+fn union_append_all(runs: &[&[u32]], pool: &mut Vec<Vec<u32>>, output: &mut Vec<u32>) {
+    match runs.len() {
+        0 => return,
+        1 => return output.extend_from_slice(runs[0]),
+        2 => return union_append(runs[0], runs[1], output),
+        _ => {}
+    }
+
+    let merge_pair = |pair: &[&[u32]], pool: &mut Vec<Vec<u32>>| {
+        let mut merged = pool.pop().unwrap_or_default();
+        merged.clear();
+        match pair {
+            [a, b] => union_append(a, b, &mut merged),
+            _ => merged.extend_from_slice(pair[0]),
+        }
+        return merged;
+    };
+    let mut level: Vec<Vec<u32>> = runs.chunks(2).map(|pair| merge_pair(pair, pool)).collect();
+    while level.len() > 2 {
+        let next = level.chunks(2).map(|pair| merge_pair(&pair.iter().map(|run| &run[..]).collect::<Vec<&[u32]>>(), pool)).collect();
+        pool.append(&mut level);
+        level = next;
+    }
+    union_append(&level[0], &level[1], output);
+    pool.append(&mut level);
+}
+
+/// The docids in every one of `lists` (each encoded by [`encode_blocked`]), as a conjunctive query would find them.
+///
+/// The shortest list is decoded a block at a time, and each of the others, shortest first, is searched for what's left
+/// of the block: its skip table skips the blocks that can't hold any of them, and only the rest are decoded and
+/// intersected with [`intersect_sorted`]'s kernels.
+pub fn intersect_blocked(lists: &[&[u8]]) -> Result<Vec<u32>, QmxError> {
+    let mut lists = lists.iter().map(|data| BlockedList::new(data)).collect::<Result<Vec<_>, _>>()?;
+    let mut output = vec![];
+    if lists.is_empty() {
+        return Ok(output);
+    }
+    lists.sort_by_key(|list| list.len());
+
+    let (shortest, others) = lists.split_first_mut().unwrap();
+    let mut candidates = vec![];
+    let mut survivors = vec![];
+    for block in 0..shortest.block_count() {
+        candidates.clear();
+        candidates.extend_from_slice(shortest.decode_block(block)?);
+        for other in others.iter_mut() {
+            if candidates.is_empty() {
+                break;
+            }
+            survivors.clear();
+            other.intersect_into(&candidates, &mut survivors)?;
+            std::mem::swap(&mut candidates, &mut survivors);
+        }
+        output.extend_from_slice(&candidates);
+    }
+
+    return Ok(output);
+}
+
+//a list being merged by union_blocked(): the block of it being merged, its docids, and how many of them have been merged
+struct UnionCursor<'a> {
+    list: BlockedList<'a>,
+    block: usize,
+    docids: Vec<u32>,
+    position: usize,
+}
+
+impl<'a> UnionCursor<'a> {
+    fn decode(&mut self) -> Result<(), QmxError> {
+        self.docids.resize(self.list.block_len(self.block), 0);
+        self.position = 0;
+        return self.list.decode_block_into(self.block, &mut self.docids);
+    }
+}
+
+/// The docids in any of `lists` (each encoded by [`encode_blocked`]), once each, as a disjunctive query would find them.
+///
+/// The lists are merged together a step at a time, each decoded a block at a time as the merge reaches it. Each step
+/// goes as far as the first of the blocks being merged ends (found from the skip tables), merging what each list has
+/// up to there with [`union_sorted`]'s scalar merge, or copying it straight out where only one list has any.
+pub fn union_blocked(lists: &[&[u8]]) -> Result<Vec<u32>, QmxError> {
+    let mut cursors = Vec::with_capacity(lists.len());
+    for data in lists {
+        let list = BlockedList::new(data)?;
+        if !list.is_empty() {
+            let mut cursor = UnionCursor { list, block: 0, docids: vec![], position: 0 };
+            cursor.decode()?;
+            cursors.push(cursor);
+        }
+    }
+
+    let mut output = Vec::with_capacity(cursors.iter().map(|cursor| cursor.list.len()).max().unwrap_or(0));
+    let mut pool = vec![];
+    let mut ends = Vec::with_capacity(cursors.len());
+    while !cursors.is_empty() {
+        let step_end = cursors.iter().map(|cursor| cursor.list.last_docid(cursor.block)).min().unwrap();
+        let mut runs = Vec::with_capacity(cursors.len());
+        ends.clear();
+        for cursor in &cursors {
+            let rest = &cursor.docids[cursor.position..];
+            //a block ending at the end of the step is used up (so the merge always moves on, even if a corrupt block isn't sorted)
+            let length = if cursor.list.last_docid(cursor.block) == step_end { rest.len() } else { rest.partition_point(|&docid| docid <= step_end) };
+            ends.push(cursor.position + length);
+            if length > 0 {
+                runs.push(&rest[..length]);
+            }
+        }
+        union_append_all(&runs, &mut pool, &mut output);
+
+        for (cursor, &end) in cursors.iter_mut().zip(ends.iter()) {
+            cursor.position = end;
+            if end == cursor.docids.len() {
+                cursor.block += 1;
+                if cursor.block < cursor.list.block_count() {
+                    cursor.decode()?;
+                }
+            }
+        }
+        cursors.retain(|cursor| cursor.block < cursor.list.block_count());
+    }
+
+    return Ok(output);
+}
+
+/// How well a [`BlockCache`] is doing.
+#[derive(Debug, Clone, Copy, Default, PartialEq, Eq)]
+pub struct CacheStatistics {
+    /// Lookups answered from the cache.
+    pub hits: u64,
+    /// Lookups that decoded the block.
+    pub misses: u64,
+    /// Blocks dropped to make room.
+    pub evictions: u64,
+    /// Blocks in the cache now.
+    pub blocks: u64,
+    /// Docids in the cache now.
+    pub integers: u64,
+}
+
+//the fewest docids a shard of a BlockCache is given (unless the whole cache is smaller): 16 blocks of 256
+const MIN_SHARD_CAPACITY: usize = 16 * 256;
+
+//no entry (the end of the recency list, or an empty slot)
+const NO_ENTRY: usize = usize::MAX;
+
+struct CacheEntry {
+    key: (u64, usize),
+    docids: Arc<[u32]>,
+    newer: usize,
+    older: usize,
+}
+
+//one shard of a BlockCache: the entries in a slab, threaded newest to oldest through a doubly linked list
+struct CacheShard {
+    index: HashMap<(u64, usize), usize>,
+    entries: Vec<CacheEntry>,
+    free: Vec<usize>,
+    newest: usize,
+    oldest: usize,
+    integers: usize,
+    capacity: usize,
+    statistics: CacheStatistics,
+}
+
+impl CacheShard {
+    fn new(capacity: usize) -> CacheShard {
+        return CacheShard { index: HashMap::new(), entries: vec![], free: vec![], newest: NO_ENTRY, oldest: NO_ENTRY, integers: 0, capacity, statistics: CacheStatistics::default() };
+    }
+
+    fn unlink(&mut self, slot: usize) {
+        let (newer, older) = (self.entries[slot].newer, self.entries[slot].older);
+        if newer == NO_ENTRY {
+            self.newest = older;
+        } else {
+            self.entries[newer].older = older;
+        }
+        if older == NO_ENTRY {
+            self.oldest = newer;
+        } else {
+            self.entries[older].newer = newer;
+        }
+    }
+
+    fn link_newest(&mut self, slot: usize) {
+        self.entries[slot].newer = NO_ENTRY;
+        self.entries[slot].older = self.newest;
+        if self.newest == NO_ENTRY {
+            self.oldest = slot;
+        } else {
+            self.entries[self.newest].newer = slot;
+        }
+        self.newest = slot;
+    }
+
+    fn get(&mut self, key: (u64, usize)) -> Option<Arc<[u32]>> {
+        let slot = *self.index.get(&key)?;
+        self.unlink(slot);
+        self.link_newest(slot);
+        return Some(self.entries[slot].docids.clone());
+    }
+
+    fn insert(&mut self, key: (u64, usize), docids: Arc<[u32]>) {
+        //another thread may have decoded the same block while the lock was released
+        if docids.len() > self.capacity || self.index.contains_key(&key) {
+            return;
+        }
+        while self.integers + docids.len() > self.capacity {
+            let slot = self.oldest;
+            self.unlink(slot);
+            self.index.remove(&self.entries[slot].key);
+            self.integers -= self.entries[slot].docids.len();
+            self.entries[slot].docids = Arc::new([]);
+            self.free.push(slot);
+            self.statistics.evictions += 1;
+        }
+
+        self.integers += docids.len();
+        let entry = CacheEntry { key, docids, newer: NO_ENTRY, older: NO_ENTRY };
+        let slot = match self.free.pop() {
+            Some(slot) => {
+                self.entries[slot] = entry;
+                slot
+            }
+            None => {
+                self.entries.push(entry);
+                self.entries.len() - 1
+            }
+        };
+        self.index.insert(key, slot);
+        self.link_newest(slot);
+    }
+}
+
+/// A size-bounded cache of decoded blocks of [`BlockedList`]s, shared between query threads, so that the blocks of hot
+/// terms are decoded once rather than once a query.
+///
+/// Blocks are keyed by a list id of the caller's choosing (the term id, say) and the block number. The cache is split into
+/// shards, each with its own lock and least-recently-used order, so threads looking up different blocks rarely wait for
+/// each other. Blocks are handed out as `Arc<[u32]>`, so one evicted while in use stays valid until it's dropped.
+pub struct BlockCache {
+    shards: Vec<Mutex<CacheShard>>,
+}
+
+impl BlockCache {
+    /// A cache of at most `capacity` docids (4 bytes each) split across `shards` shards (0 for 4 per core).
+    ///
+    /// Each shard gets an equal share of `capacity`, and a block bigger than its shard's share is never cached, so there
+    /// are only as many shards as leave each room for at least 16 blocks of 256 docids (and always at least one).
+    pub fn new(capacity: usize, shards: usize) -> BlockCache {
+        let shards = if shards == 0 { 4 * worker_threads(0) } else { shards };
+        let shards = shards.min(capacity / MIN_SHARD_CAPACITY).max(1);
+        return BlockCache { shards: (0..shards).map(|_| Mutex::new(CacheShard::new(capacity / shards))).collect() };
+    }
+
+    fn shard(&self, key: (u64, usize)) -> &Mutex<CacheShard> {
+        //Fibonacci hashing, so that consecutive blocks of a list land in different shards
+        let hash = (key.0 ^ (key.1 as u64).rotate_left(32)).wrapping_mul(0x9E37_79B9_7F4A_7C15);
+        return &self.shards[((hash >> 32) as usize) % self.shards.len()];
+    }
+
+    /// The docids of block `block` of `list`, which the caller calls `list_id`, decoding it only if it isn't cached.
+    pub fn block(&self, list_id: u64, list: &BlockedList, block: usize) -> Result<Arc<[u32]>, QmxError> {
+        assert!(block < list.block_count());
+        let key = (list_id, block);
+        let shard = self.shard(key);
+        {
+            let mut shard = shard.lock().unwrap();
+            if let Some(docids) = shard.get(key) {
+                shard.statistics.hits += 1;
+                return Ok(docids);
+            }
+            shard.statistics.misses += 1;
+        }
+
+        //decode without holding the lock
+        let mut docids = vec![0; list.block_len(block)];
+        list.decode_block_into(block, &mut docids)?;
+        let docids: Arc<[u32]> = docids.into();
+        shard.lock().unwrap().insert(key, docids.clone());
+
+        return Ok(docids);
+    }
+
+    /// Decode the whole of `list` into `output` (resized to exactly the number of docids) a cached block at a time.
+    pub fn decode_all(&self, list_id: u64, list: &BlockedList, output: &mut Vec<u32>) -> Result<usize, QmxError> {
+        output.clear();
+        output.reserve(list.len());
+        for block in 0..list.block_count() {
+            output.extend_from_slice(&self.block(list_id, list, block)?);
+        }
+
+        return Ok(list.len());
+    }
+
+    /// The hit, miss and eviction counts so far, and what's in the cache now, summed over the shards.
+    pub fn statistics(&self) -> CacheStatistics {
+        let mut total = CacheStatistics::default();
+        for shard in &self.shards {
+            let shard = shard.lock().unwrap();
+            total.hits += shard.statistics.hits;
+            total.misses += shard.statistics.misses;
+            total.evictions += shard.statistics.evictions;
+            total.blocks += shard.index.len() as u64;
+            total.integers += shard.integers as u64;
+        }
+
+        return total;
+    }
+
+    /// Empty the cache (the counts carry on).
+    pub fn clear(&self) {
+        for shard in &self.shards {
+            let mut shard = shard.lock().unwrap();
+            let capacity = shard.capacity;
+            let statistics = shard.statistics;
+            *shard = CacheShard::new(capacity);
+            shard.statistics = statistics;
+        }
+    }
+}
+
+/// Writes a sorted list of docids pushed one at a time to `sink`, in the same format as [`encode_blocked`].
+///
+/// Each block is encoded and written as soon as it is full, so only one block of docids (and the skip table, 12 bytes a
+/// block) is ever held in memory. [`finish`](BlockedWriter::finish) writes the skip table and footer.
+pub struct BlockedWriter<W: Write> {
+    sink: W,
+    encoder: QmxEncoder,
+    block_size: usize,
+    block: Vec<u32>,
+    encoded: Vec<u8>,
+    table: Vec<u8>,
+    written: usize,
+    count: usize,
+    previous: u32,
+}
+
+impl<W: Write> BlockedWriter<W> {
+    pub fn new(sink: W, block_size: usize) -> BlockedWriter<W> {
+        assert!(block_size > 0);
+        return BlockedWriter { sink, encoder: QmxEncoder::new(), block_size, block: Vec::with_capacity(block_size), encoded: Vec::with_capacity(max_encoded_len(block_size)), table: vec![], written: 0, count: 0, previous: 0 };
+    }
+
+    /// Add the next docid (which must be larger than the one before).
+    pub fn push(&mut self, docid: u32) -> io::Result<()> {
+        self.block.push(docid);
+        if self.block.len() == self.block_size {
+            return self.flush_block();
+        }
+        return Ok(());
+    }
+
+    /// Add the next few docids.
+    pub fn push_all(&mut self, docs: &[u32]) -> io::Result<()> {
+        for &docid in docs {
+            self.push(docid)?;
+        }
+        return Ok(());
+    }
+
+    /// The number of docids pushed so far.
+    pub fn len(&self) -> usize {
+        return self.count + self.block.len();
+    }
+
+    pub fn is_empty(&self) -> bool {
+        return self.len() == 0;
+    }
+
+    fn flush_block(&mut self) -> io::Result<()> {
+        self.encoded.clear();
+        self.encoded.reserve(max_encoded_len(self.block.len()));
+        unsafe {
+            let bytes = self.encoder.encode_raw_parts(&self.block, self.encoded.as_mut_ptr(), self.encoded.capacity(), self.previous);
+            self.encoded.set_len(bytes);
+        }
+        self.sink.write_all(&self.encoded)?;
+
+        self.previous = self.block[self.block.len() - 1];
+        write_skip_entry(&mut self.table, self.previous, self.written, self.written + self.encoded.len());
+        self.written += self.encoded.len();
+        self.count += self.block.len();
+        self.block.clear();
+
+        return Ok(());
+    }
+
+    /// Write the last (partial) block, the skip table, and the footer, returning the sink.
+    pub fn finish(mut self) -> io::Result<W> {
+        if !self.block.is_empty() {
+            self.flush_block()?;
+        }
+        let blocks = self.table.len() / SKIP_ENTRY_LEN;
+        write_blocked_footer(&mut self.table, self.count, self.block_size, blocks);
+        self.sink.write_all(&self.table)?;
+
+        return Ok(self.sink);
+    }
+}
+
+//a segment starts with the magic number, the format version, the number of terms, and a reserved (zero) word
+const SEGMENT_MAGIC: &[u8; 4] = b"QMXS";
+const SEGMENT_VERSION: u32 = 1;
+const SEGMENT_HEADER_LEN: usize = 16;
+//a dictionary entry is the term id, the number of docids, the largest docid, the length of the encoding, and its offset (a u64)
+const DICTIONARY_ENTRY_LEN: usize = 24;
+//each encoding starts on a multiple of this
+const SEGMENT_ALIGNMENT: usize = 16;
+//the fast decoders read up to this many bytes past the end of an encoding, so the last one is followed by this many bytes
+const SEGMENT_SLACK: usize = 15;
+
+fn read_u64(data: &[u8], at: usize) -> u64 {
+    return read_u32(data, at) as u64 | (read_u32(data, at + 4) as u64) << 32;
+}
+
+/// Builds a segment file: a dictionary of terms followed by the QMX encoding of each term's postings, see [`Segment`].
+pub struct SegmentWriter {
+    encoder: QmxEncoder,
+    dictionary: Vec<u8>,
+    postings: Vec<u8>,
+    terms: usize,
+    last_term: Option<u32>,
+}
+
+impl SegmentWriter {
+    pub fn new() -> SegmentWriter {
+        return SegmentWriter { encoder: QmxEncoder::new(), dictionary: vec![], postings: vec![], terms: 0, last_term: None };
+    }
+
+    /// The encoder used for the postings, e.g. to [`set_optimal`](QmxEncoder::set_optimal).
+    pub fn encoder(&mut self) -> &mut QmxEncoder {
+        return &mut self.encoder;
+    }
+
+    /// Add the sorted docids of `term`, terms must be added in increasing order.
+    pub fn add(&mut self, term: u32, docs: &[u32]) {
+        assert!(self.last_term.map_or(true, |last| term > last), "terms must be added in increasing order");
+        self.last_term = Some(term);
+
+        let offset = self.postings.len();
+        let length = self.encoder.encode_into(docs, &mut self.postings);
+        self.postings.resize((self.postings.len() + SEGMENT_ALIGNMENT - 1) / SEGMENT_ALIGNMENT * SEGMENT_ALIGNMENT, 0);
+
+        self.dictionary.extend_from_slice(&term.to_le_bytes());
+        self.dictionary.extend_from_slice(&u32::try_from(docs.len()).expect("postings list too long").to_le_bytes());
+        self.dictionary.extend_from_slice(&docs.last().copied().unwrap_or(0).to_le_bytes());
+        self.dictionary.extend_from_slice(&u32::try_from(length).expect("postings list too long").to_le_bytes());
+        //the offset is from the start of the postings, it's made absolute in finish()
+        self.dictionary.extend_from_slice(&(offset as u64).to_le_bytes());
+        self.terms += 1;
+    }
+
+    /// The finished segment.
+    pub fn finish(self) -> Vec<u8> {
+        let postings_start = (SEGMENT_HEADER_LEN + self.dictionary.len() + SEGMENT_ALIGNMENT - 1) / SEGMENT_ALIGNMENT * SEGMENT_ALIGNMENT;
+        let mut output = Vec::with_capacity(postings_start + self.postings.len() + SEGMENT_SLACK);
+
+        output.extend_from_slice(SEGMENT_MAGIC);
+        output.extend_from_slice(&SEGMENT_VERSION.to_le_bytes());
+        output.extend_from_slice(&u32::try_from(self.terms).expect("too many terms").to_le_bytes());
+        output.extend_from_slice(&0u32.to_le_bytes());
+        for entry in self.dictionary.chunks(DICTIONARY_ENTRY_LEN) {
+            output.extend_from_slice(&entry[..16]);
+            output.extend_from_slice(&((postings_start as u64) + read_u64(entry, 16)).to_le_bytes());
+        }
+        output.resize(postings_start, 0);
+        output.extend_from_slice(&self.postings);
+        output.resize(output.len() + SEGMENT_SLACK, 0);
+
+        return output;
+    }
+
+    /// Write the finished segment to `path`.
+    pub fn write_to_file<P: AsRef<Path>>(self, path: P) -> io::Result<()> {
+        return std::fs::write(path, self.finish());
+    }
+}
+
+impl Default for SegmentWriter {
+    fn default() -> SegmentWriter {
+        return SegmentWriter::new();
+    }
+}
+
+/// A read-only memory map of a whole file.
+pub struct MappedFile {
+    address: *mut c_void,
+    length: usize,
+}
+
+//the mapping is read-only, so sharing it is fine
+unsafe impl Send for MappedFile {}
+unsafe impl Sync for MappedFile {}
+
+impl MappedFile {
+    /// Map the file at `path` into memory (nothing is read until it is used).
+    pub fn open<P: AsRef<Path>>(path: P) -> io::Result<MappedFile> {
+        let file = File::open(path)?;
+        let length = usize::try_from(file.metadata()?.len()).map_err(|_| io::Error::new(io::ErrorKind::InvalidData, "file too large to map"))?;
+        if length == 0 {
+            //mmap() can't map nothing
+            return Ok(MappedFile { address: std::ptr::null_mut(), length });
+        }
+
+        let address = unsafe { libc::mmap(std::ptr::null_mut(), length, libc::PROT_READ, libc::MAP_PRIVATE, file.as_raw_fd(), 0) };
+        if address == libc::MAP_FAILED {
+            return Err(io::Error::last_os_error());
+        }
+
+        return Ok(MappedFile { address, length });
+    }
+
+    /// The contents of the file.
+    pub fn as_bytes(&self) -> &[u8] {
+        if self.length == 0 {
+            return &[];
+        }
+        return unsafe { std::slice::from_raw_parts(self.address as *const u8, self.length) };
+    }
+}
+
+impl Drop for MappedFile {
+    fn drop(&mut self) {
+        if self.length != 0 {
+            unsafe {
+                libc::munmap(self.address, self.length);
+            }
+        }
+    }
+}
+
+/// The postings of one term in a [`Segment`], borrowed straight from the segment's bytes.
+#[derive(Debug, Clone, Copy)]
+pub struct Postings<'a> {
+    /// The QMX encoding of the docids, followed in the segment by enough bytes for [`decode`] to read past its end.
+    pub data: &'a [u8],
+    /// The number of docids.
+    pub count: usize,
+    /// The largest docid (0 if there are none).
+    pub max_docid: u32,
+}
+
+impl<'a> Postings<'a> {
+    /// Decode the docids into `output`, which is resized to exactly the number of docids, returning that number.
+    ///
+    /// This uses [`decode_checked`], so a corrupt segment gives an error rather than a panic.
+    pub fn decode_into(&self, output: &mut Vec<u32>) -> Result<usize, QmxError> {
+        output.clear();
+        output.resize(self.count, 0);
+        if decode_checked(self.data, output) != self.count {
+            return Err(QmxError::Corrupt);
+        }
+
+        return Ok(self.count);
+    }
+}
+
+/// A segment made by [`SegmentWriter`], read in place (typically from a [`MappedFile`]) without copying.
+///
+/// The layout is:
+/// ```text
+/// "QMXS" | version | terms | 0 | (term, docids, max docid, length, offset: u64) * terms | padding | postings... | 32 zero bytes
+/// ```
+/// all little-endian `u32`s unless noted. The dictionary is sorted by term, and each encoding starts on a 16-byte
+/// boundary relative to the start of the segment.
+pub struct Segment<'a> {
+    data: &'a [u8],
+    terms: usize,
+}
+
+impl<'a> Segment<'a> {
+    /// Check the header and dictionary of a segment.
+    pub fn new(data: &'a [u8]) -> Result<Segment<'a>, QmxError> {
+        if data.len() < SEGMENT_HEADER_LEN || &data[..4] != SEGMENT_MAGIC || read_u32(data, 4) != SEGMENT_VERSION {
+            return Err(QmxError::Corrupt);
+        }
+        let terms = read_u32(data, 8) as usize;
+        let dictionary_end = SEGMENT_HEADER_LEN + terms * DICTIONARY_ENTRY_LEN;
+        if dictionary_end > data.len() {
+            return Err(QmxError::Corrupt);
+        }
+
+        let segment = Segment { data, terms };
+        for index in 0..terms {
+            let entry = SEGMENT_HEADER_LEN + index * DICTIONARY_ENTRY_LEN;
+            let count = read_u32(data, entry + 4) as u64;
+            let length = read_u32(data, entry + 12) as u64;
+            let offset = read_u64(data, entry + 16);
+            if offset < dictionary_end as u64 || offset.saturating_add(length + SEGMENT_SLACK as u64) > data.len() as u64 {
+                return Err(QmxError::Corrupt);
+            }
+            //as in decode_with_count(), one selector byte stands for at most 16 words of 256 integers
+            if count > length * 16 * 256 {
+                return Err(QmxError::Corrupt);
+            }
+            if index > 0 && read_u32(data, entry) <= read_u32(data, entry - DICTIONARY_ENTRY_LEN) {
+                return Err(QmxError::Corrupt);
+            }
+        }
+
+        return Ok(segment);
+    }
+
+    /// The number of terms.
+    pub fn len(&self) -> usize {
+        return self.terms;
+    }
+
+    pub fn is_empty(&self) -> bool {
+        return self.terms == 0;
+    }
+
+    fn term_at(&self, index: usize) -> u32 {
+        return read_u32(self.data, SEGMENT_HEADER_LEN + index * DICTIONARY_ENTRY_LEN);
+    }
+
+    fn postings_at(&self, index: usize) -> Postings<'a> {
+        let entry = SEGMENT_HEADER_LEN + index * DICTIONARY_ENTRY_LEN;
+        let offset = read_u64(self.data, entry + 16) as usize;
+        let length = read_u32(self.data, entry + 12) as usize;
+
+        return Postings { data: &self.data[offset..offset + length], count: read_u32(self.data, entry + 4) as usize, max_docid: read_u32(self.data, entry + 8) };
+    }
+
+    /// The postings of `term`, found by binary search of the dictionary.
+    pub fn postings(&self, term: u32) -> Option<Postings<'a>> {
+        let (mut low, mut high) = (0, self.terms);
+        while low < high {
+            let middle = low + (high - low) / 2;
+            let found = self.term_at(middle);
+            if found == term {
+                return Some(self.postings_at(middle));
+            }
+            if found < term {
+                low = middle + 1;
+            } else {
+                high = middle;
+            }
+        }
+        return None;
+    }
+
+    /// Every term and its postings, in term order.
+    pub fn iter(&self) -> impl Iterator<Item = (u32, Postings<'a>)> + '_ {
+        return (0..self.terms).map(move |index| (self.term_at(index), self.postings_at(index)));
+    }
+}
+
+/// A disagreement found by [`verify_round_trip`], [`verify_decoders`] or [`self_test`]: which check failed.
+///
+/// These checks are for tests and fuzz targets, not for use alongside other decoding (they switch the instruction set
+/// of the whole process and print native failures to stderr), so they are only built with the `fuzzing` feature.
+#[cfg(any(test, feature = "fuzzing"))]
+#[derive(Debug, Clone, PartialEq, Eq)]
+pub struct Mismatch {
+    pub check: String,
+}
+
+#[cfg(any(test, feature = "fuzzing"))]
+impl fmt::Display for Mismatch {
+    fn fmt(&self, f: &mut fmt::Formatter<'_>) -> fmt::Result {
+        write!(f, "qmx mismatch: {}", self.check)
+    }
+}
+
+#[cfg(any(test, feature = "fuzzing"))]
+impl std::error::Error for Mismatch {}
+
+#[cfg(any(test, feature = "fuzzing"))]
+fn check(passed: bool, what: &str) -> Result<(), Mismatch> {
+    if passed {
+        return Ok(());
+    }
+    return Err(Mismatch { check: what.to_string() });
+}
+
+//held while the checks below switch instruction sets, so that two of them running at once (as tests do) don't switch it
+//under each other
+#[cfg(any(test, feature = "fuzzing"))]
+static INSTRUCTION_SET_LOCK: Mutex<()> = Mutex::new(());
+
+//an instruction set of each distinct kernel this CPU can run, with the one in use restored (and the lock released) when
+//it's dropped
+#[cfg(any(test, feature = "fuzzing"))]
+struct EachInstructionSet {
+    was: InstructionSet,
+    _lock: std::sync::MutexGuard<'static, ()>,
+}
+
+#[cfg(any(test, feature = "fuzzing"))]
+impl EachInstructionSet {
+    fn new() -> EachInstructionSet {
+        //a check that panicked while holding the lock left nothing inconsistent behind it
+        let lock = INSTRUCTION_SET_LOCK.lock().unwrap_or_else(|poisoned| poisoned.into_inner());
+        return EachInstructionSet { was: instruction_set(), _lock: lock };
+    }
+
+    fn all(&self) -> Vec<InstructionSet> {
+        let mut supported: Vec<InstructionSet> = vec![];
+        for requested in [InstructionSet::Sse41, InstructionSet::Avx2, InstructionSet::Avx512] {
+            let got = use_instruction_set(requested);
+            if !supported.contains(&got) {
+                supported.push(got);
+            }
+        }
+        return supported;
+    }
+}
+
+#[cfg(any(test, feature = "fuzzing"))]
+impl Drop for EachInstructionSet {
+    fn drop(&mut self) {
+        use_instruction_set(self.was);
+    }
+}
+
+//strictly increasing docids whose d-gaps follow the shape of values (shifted down just far enough that they don't overflow)
+#[cfg(any(test, feature = "fuzzing"))]
+fn docids_like(values: &[u32]) -> Vec<u32> {
+    let mut shift = 0;
+    while values.iter().map(|&value| value.checked_shr(shift).unwrap_or(0) as u64 + 1).sum::<u64>() > u32::MAX as u64 {
+        shift += 1;
+    }
+    let mut previous = 0u32;
+    return values.iter().map(|&value| {
+        previous += value.checked_shr(shift).unwrap_or(0) + 1;
+        return previous;
+    }).collect();
+}
+
+/// Round trip `values` through every encoder (greedy and optimal, each format version, each instruction set) and every
+/// decoder, and check that they all agree with each other and with `values`.
+///
+/// The native encoders and decoders are checked against each other first, then each of the encodings this crate writes
+/// (raw, zigzag, d-gapped with and without a count, pairs, and blocked) is decoded with every decoder that reads it. Meant
+/// for property tests and fuzz targets: any `values` at all should pass, so an `Err` is a bug.
+///
+/// The instruction set is process-wide, so this switches it for every thread while it runs, and puts it back when it
+/// returns. Calls to this, [`verify_decoders`] and [`self_test`] wait for each other, but other threads decoding at the
+/// same time run whichever kernels are in use at that moment (which give the same results, perhaps more slowly).
+#[cfg(any(test, feature = "fuzzing"))]
+pub fn verify_round_trip(values: &[u32]) -> Result<(), Mismatch> {
+    let each = EachInstructionSet::new();
+    check(unsafe { qmx_unittest_one(values.as_ptr(), values.len()) } != 0, "native encoders and decoders (see stderr)")?;
+
+    let docids = docids_like(values);
+    let tfs: Vec<u32> = values.iter().map(|&value| value | 1).collect();
+    let mut output = vec![0u32; values.len()];
+    let mut slack = vec![0u32; values.len() + DECODE_SLACK];
+    for set in each.all() {
+        use_instruction_set(set);
+
+        //raw
+        let raw = encode_raw(values);
+        check(decode_raw_checked(&raw, &mut output) == values.len() && output == values, "decode_raw_checked")?;
+        check(decode_raw(&raw, &mut slack, values.len() as u32) >= values.len() && slack[..values.len()] == *values, "decode_raw")?;
+        check(QmxDecoder::raw(&raw, values.len()).eq(values.iter().copied()), "QmxDecoder::raw")?;
+        check(sum_raw(&raw, values.len()) == values.iter().map(|&value| value as u64).sum::<u64>(), "sum_raw")?;
+
+        //zigzag
+        let zigzag = encode_zigzag(values);
+        check(decode_zigzag_checked(&zigzag, &mut output) == values.len() && output == values, "decode_zigzag_checked")?;
+        check(decode_zigzag(&zigzag, &mut slack, values.len() as u32) >= values.len() && slack[..values.len()] == *values, "decode_zigzag")?;
+
+        //d-gapped docids
+        let encoded = encode(&docids);
+        check(decode_checked(&encoded, &mut output) == docids.len() && output == docids, "decode_checked")?;
+        check(decode(&encoded, &mut slack, docids.len() as u32) >= docids.len() && slack[..docids.len()] == *docids, "decode")?;
+        check(QmxDecoder::new(&encoded, docids.len()).eq(docids.iter().copied()), "QmxDecoder::new")?;
+        check(last_docid(&encoded, docids.len()) == docids.last().copied().unwrap_or(0), "last_docid")?;
+
+        let mut counted = vec![];
+        let with_count = encode_with_count(&docids);
+        check(decode_with_count(&with_count, &mut counted) == Ok(docids.len()) && counted == docids, "decode_with_count")?;
+        check(QmxDecoder::with_count(&with_count).map(|decoder| decoder.eq(docids.iter().copied())) == Ok(true), "QmxDecoder::with_count")?;
+
+        //pairs
+        let pairs = encode_pairs(&docids, &tfs);
+        let mut pair_tfs = vec![0u32; tfs.len()];
+        check(decode_pairs_checked(&pairs, &mut output, &mut pair_tfs) == Ok(docids.len()) && output == docids && pair_tfs == tfs, "decode_pairs_checked")?;
+        let totals = (docids.last().copied().unwrap_or(0), tfs.iter().map(|&tf| tf as u64).sum::<u64>());
+        check(pairs_totals(&pairs, docids.len()) == Ok(totals), "pairs_totals")?;
+
+        //blocked, with blocks that end inside a payload word, on one, and on a key
+        for block_size in [1, 7, 128, 256] {
+            let blocked = encode_blocked(&docids, block_size);
+            let mut list = BlockedList::new(&blocked).map_err(|_| Mismatch { check: "BlockedList::new".to_string() })?;
+            check(list.last() == docids.last().copied(), "BlockedList::last")?;
+            check(list.decode_all(&mut counted) == Ok(docids.len()) && counted == docids, "BlockedList::decode_all")?;
+            check(list.decode_all_parallel(&mut counted, 2) == Ok(docids.len()) && counted == docids, "BlockedList::decode_all_parallel")?;
+            for (at, &docid) in docids.iter().enumerate().step_by(1 + docids.len() / 64) {
+                //one before each docid finds it (the docids are strictly increasing, so nothing else is in between)
+                let expected = if at > 0 && docids[at - 1] == docid - 1 { docid - 1 } else { docid };
+                check(list.next_geq(docid - 1) == Some(expected), "BlockedList::next_geq")?;
+            }
+            check(list.next_geq(u32::MAX) == docids.last().copied().filter(|&last| last == u32::MAX), "BlockedList::next_geq past the end")?;
+
+            //against every other docid, the intersection is that and the union everything
+            let alternate: Vec<u32> = docids.iter().copied().step_by(2).collect();
+            let other = encode_blocked(&alternate, block_size);
+            check(intersect_blocked(&[&blocked, &other]).as_ref() == Ok(&alternate), "intersect_blocked")?;
+            check(union_blocked(&[&blocked, &other]).as_ref() == Ok(&docids), "union_blocked")?;
+            check(intersect_sorted(&docids, &alternate, &mut counted) == alternate.len() && counted == alternate, "intersect_sorted")?;
+            check(union_sorted(&docids, &alternate, &mut counted) == docids.len() && counted == docids, "union_sorted")?;
+        }
+    }
+
+    return Ok(());
+}
+
+/// Feed `data`, which needn't be (and for a fuzz target usually isn't) a valid encoding, to every decoder that checks its
+/// input, and check that none of them panic or read out of bounds and that every instruction set decodes it the same way.
+///
+/// Like [`verify_round_trip`] this switches the process-wide instruction set while it runs.
+#[cfg(any(test, feature = "fuzzing"))]
+pub fn verify_decoders(data: &[u8]) -> Result<(), Mismatch> {
+    let each = EachInstructionSet::new();
+    //an encoding can claim up to 4096 integers a byte, only look at the first few
+    let integers = encoded_integers(data).min(1 << 16);
+    let mut expected: Option<(Vec<u32>, Vec<u32>, u64)> = None;
+    for set in each.all() {
+        use_instruction_set(set);
+        let mut raw = vec![0u32; integers];
+        let raw_written = decode_raw_checked(data, &mut raw);
+        raw.truncate(raw_written);
+        let mut docids = vec![0u32; integers];
+        let written = decode_checked_with_base(data, &mut docids, 0x5EED);
+        docids.truncate(written);
+        let sum = sum_raw(data, integers);
+        match &expected {
+            None => expected = Some((raw, docids, sum)),
+            Some(first) => {
+                check(first.0 == raw, "decode_raw_checked differs between instruction sets")?;
+                check(first.1 == docids, "decode_checked differs between instruction sets")?;
+                check(first.2 == sum, "sum_raw differs between instruction sets")?;
+            }
+        }
+
+        //these only have to return (an error is fine)
+        let mut output = vec![];
+        let _ = decode_with_count(data, &mut output);
+        let _ = QmxDecoder::raw(data, integers).count();
+        let _ = QmxDecoder::with_base(data, integers, 0x5EED).last();
+        let mut tfs = vec![0u32; integers];
+        let _ = decode_pairs_checked(data, &mut output[..0], &mut tfs[..0]);
+        let mut pair_docids = vec![0u32; integers];
+        let _ = decode_pairs_checked(data, &mut pair_docids, &mut tfs);
+        let _ = pairs_totals(data, integers);
+        if let Ok(mut list) = BlockedList::new(data) {
+            let _ = list.decode_all(&mut output);
+            //search for the docids around the end of each block, as the skip table has them, to lead the search into every block
+            for block in 0..list.block_count() {
+                let last = list.last_docid(block);
+                let _ = list.next_geq(last.saturating_sub(1));
+                let _ = list.next_geq(last);
+            }
+            list.reset();
+            let _ = list.next_geq(u32::MAX);
+            let _ = intersect_blocked(&[data, data]);
+            let _ = union_blocked(&[data, data]);
+        }
+    }
+
+    return Ok(());
+}
+
+/// Run the native self test (every encoder and decoder on a few thousand awkward sequences) and then
+/// [`verify_round_trip`] on a smaller set, returning the first thing that disagrees.
+///
+/// Like [`verify_round_trip`] this switches the process-wide instruction set while it runs.
+#[cfg(any(test, feature = "fuzzing"))]
+pub fn self_test() -> Result<(), Mismatch> {
+    {
+        let _each = EachInstructionSet::new();
+        check(unsafe { qmx_unittest() } != 0, "native self test (see stderr)")?;
+    }
+
+    //lengths either side of a group of 4, a word of 8 or 16, and a run of 256
+    let mut state: u32 = 2016;
+    let mut random = move || {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        return state;
+    };
+    for length in [0, 1, 3, 4, 5, 7, 8, 9, 15, 16, 17, 255, 256, 257, 4097] {
+        verify_round_trip(&vec![0; length])?;
+        verify_round_trip(&vec![1; length])?;
+        for bits in [1, 7, 12, 21, 22, 32] {
+            let mask = (((1u64) << bits) - 1) as u32;
+            let mut values: Vec<u32> = (0..length).map(|_| random() & mask).collect();
+            verify_round_trip(&values)?;
+            //one outlier in a run of small integers, for the patches
+            values.iter_mut().for_each(|value| *value &= 3);
+            if length > 0 {
+                values[length / 2] = mask;
+            }
+            verify_round_trip(&values)?;
+        }
+    }
+
+    return Ok(());
+}
+
+#[cfg(feature = "trace")]
+extern "C" {
+    fn qmx_trace(counters: *mut TraceCounters);
+    fn qmx_reset_trace();
+}
+
+/// What the calls to one native kernel have done, see [`TraceCounters`].
+#[cfg(feature = "trace")]
+#[repr(C)]
+#[derive(Debug, Clone, Copy, Default, PartialEq, Eq)]
+pub struct KernelCounters {
+    /// Calls made.
+    pub calls: u64,
+    /// Integers written (or, by `sum`, added up).
+    pub integers: u64,
+    /// Bytes of payload and keys read.
+    pub bytes: u64,
+    /// Time spent in the kernel, in time stamp counter ticks.
+    pub cycles: u64,
+}
+
+#[cfg(feature = "trace")]
+impl KernelCounters {
+    fn since(&self, earlier: &KernelCounters) -> KernelCounters {
+        return KernelCounters {
+            calls: self.calls.wrapping_sub(earlier.calls),
+            integers: self.integers.wrapping_sub(earlier.integers),
+            bytes: self.bytes.wrapping_sub(earlier.bytes),
+            cycles: self.cycles.wrapping_sub(earlier.cycles),
+        };
+    }
+}
+
+/// What the native kernels have done in this thread since it started (or [`reset_trace_counters`] was last called), with
+/// the `trace` feature on.
+///
+/// Each field but `words` is one native kernel, named after it and documented with the functions that call it.
+#[cfg(feature = "trace")]
+#[repr(C)]
+#[derive(Debug, Clone, Copy, Default, PartialEq, Eq)]
+pub struct TraceCounters {
+    /// [`decode_raw`] and [`decode_zigzag`].
+    pub decode: KernelCounters,
+    /// [`decode`] and [`decode_with_base`]. The prefix sum is fused into this decoder, so its cycles include it.
+    pub decode_d1: KernelCounters,
+    /// [`decode_raw_checked`] and [`decode_zigzag_checked`].
+    pub decode_checked: KernelCounters,
+    /// [`decode_checked`] and [`decode_checked_with_base`] (which [`decode_with_count`] and [`BlockedList`] use).
+    pub decode_d1_checked: KernelCounters,
+    /// [`QmxDecoder`], at most 256 integers at a time.
+    pub decode_next: KernelCounters,
+    /// [`sum_raw`] and [`last_docid`], which add up the integers without decoding them.
+    pub sum: KernelCounters,
+    /// Payload words decoded with each selector, by every kernel that reads an encoding (`words[15]` counts patches).
+    pub words: [u64; 16],
+}
+
+#[cfg(feature = "trace")]
+impl TraceCounters {
+    /// Each kernel's counters with its name, for exporting as metrics.
+    pub fn kernels(&self) -> [(&'static str, KernelCounters); 6] {
+        return [
+            ("decode", self.decode),
+            ("decode_d1", self.decode_d1),
+            ("decode_checked", self.decode_checked),
+            ("decode_d1_checked", self.decode_d1_checked),
+            ("decode_next", self.decode_next),
+            ("sum", self.sum),
+        ];
+    }
+
+    /// What was done between `earlier` (counters read before, in the same thread) and these, for example by one query.
+    ///
+    /// The counts wrap rather than panic if [`reset_trace_counters`] was called in between, so the result is only
+    /// meaningful if it wasn't.
+    pub fn since(&self, earlier: &TraceCounters) -> TraceCounters {
+        let mut words = [0; 16];
+        for (word, (now, then)) in words.iter_mut().zip(self.words.iter().zip(earlier.words.iter())) {
+            *word = now.wrapping_sub(*then);
+        }
+        return TraceCounters {
+            decode: self.decode.since(&earlier.decode),
+            decode_d1: self.decode_d1.since(&earlier.decode_d1),
+            decode_checked: self.decode_checked.since(&earlier.decode_checked),
+            decode_d1_checked: self.decode_d1_checked.since(&earlier.decode_d1_checked),
+            decode_next: self.decode_next.since(&earlier.decode_next),
+            sum: self.sum.since(&earlier.sum),
+            words,
+        };
+    }
+}
+
+/// This thread's [`TraceCounters`]. Only there with the `trace` feature, without it nothing is counted and the kernels cost
+/// no more than they did.
+#[cfg(feature = "trace")]
+pub fn trace_counters() -> TraceCounters {
+    let mut counters = TraceCounters::default();
+    unsafe { qmx_trace(&mut counters) };
+    return counters;
+}
+
+/// Zero this thread's [`TraceCounters`].
+#[cfg(feature = "trace")]
+pub fn reset_trace_counters() {
+    unsafe { qmx_reset_trace() };
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    //xorshift, so that the tests need nothing outside the crate and fail the same way every run
+    struct Random(u64);
+
+    impl Random {
+        fn next(&mut self) -> u64 {
+            self.0 ^= self.0 << 13;
+            self.0 ^= self.0 >> 7;
+            self.0 ^= self.0 << 17;
+            return self.0;
+        }
+
+        fn below(&mut self, bound: u64) -> u64 {
+            return self.next() % bound;
+        }
+
+        //an integer of up to 32 bits, each width equally likely
+        fn of_width(&mut self, bits: u32) -> u32 {
+            return (self.next() as u32).checked_shr(32 - bits).unwrap_or(0);
+        }
+    }
+
+    //strictly increasing docids with gaps of up to 2^bits
+    fn docids(random: &mut Random, length: usize, bits: u32) -> Vec<u32> {
+        let mut docid = 0u32;
+        return (0..length).map(|_| {
+            docid += 1 + random.of_width(bits);
+            return docid;
+        }).collect();
+    }
+
+    #[test]
+    fn self_test_passes() {
+        self_test().unwrap();
+    }
+
+    #[test]
+    fn random_sequences_round_trip() {
+        let mut random = Random(2016);
+        for _ in 0..200 {
+            let length = random.below(700) as usize;
+            let bits = random.below(33) as u32;
+            let mut values: Vec<u32> = (0..length).map(|_| random.of_width(bits)).collect();
+            //now and then a few outliers, for the patches
+            if length > 0 && random.below(2) == 0 {
+                for _ in 0..1 + random.below(4) {
+                    let at = random.below(length as u64) as usize;
+                    values[at] = random.of_width(32);
+                }
+            }
+            verify_round_trip(&values).unwrap();
+        }
+    }
+
+    #[test]
+    fn adversarial_sequences_round_trip() {
+        for length in [0, 1, 3, 4, 5, 7, 8, 9, 15, 16, 17, 255, 256, 257, 4095, 4096, 4097] {
+            //long runs of zeros and ones (each 256 of them a single selector), broken by an integer over 2^21
+            let mut values = vec![0; length];
+            verify_round_trip(&values).unwrap();
+            if length > 0 {
+                values[length - 1] = 1 << 21;
+                verify_round_trip(&values).unwrap();
+                values[length / 2] = u32::MAX;
+                verify_round_trip(&values).unwrap();
+            }
+            verify_round_trip(&vec![1; length]).unwrap();
+            verify_round_trip(&vec![(1 << 21) + 1; length]).unwrap();
+            verify_round_trip(&vec![u32::MAX; length]).unwrap();
+            verify_round_trip(&(0..length as u32).map(|at| if at % 2 == 0 { 0 } else { u32::MAX }).collect::<Vec<u32>>()).unwrap();
+        }
+    }
+
+    #[test]
+    fn random_bytes_decode_the_same_everywhere() {
+        let mut random = Random(5);
+        for _ in 0..2000 {
+            let data: Vec<u8> = (0..random.below(300)).map(|_| random.next() as u8).collect();
+            verify_decoders(&data).unwrap();
+        }
+    }
+
+    #[test]
+    fn corrupted_encodings_decode_the_same_everywhere() {
+        let mut random = Random(7);
+        let docids: Vec<u32> = (1..2000).map(|docid| docid * 3 + docid % 7).collect();
+        let tfs: Vec<u32> = docids.iter().map(|docid| docid % 5 + 1).collect();
+        for encoded in [encode(&docids), encode_raw(&tfs), encode_with_count(&docids), encode_pairs(&docids, &tfs), encode_blocked(&docids, 128), encode_blocked(&docids, 7)] {
+            verify_decoders(&encoded).unwrap();
+            for _ in 0..100 {
+                let mut corrupt = encoded.clone();
+                for _ in 0..1 + random.below(3) {
+                    let at = random.below(corrupt.len() as u64) as usize;
+                    corrupt[at] ^= 1 << random.below(8);
+                }
+                corrupt.truncate(corrupt.len() - random.below(4) as usize);
+                verify_decoders(&corrupt).unwrap();
+            }
+        }
+    }
+
+    #[test]
+    fn fast_decoders_check_their_output_slack() {
+        let encoded = encode_raw(&vec![7; 1000]);
+        assert!(std::panic::catch_unwind(|| decode_raw(&encoded, &mut vec![0; 1000], 1000)).is_err());
+        //room for the count and slack, but the encoding holds more than that
+        assert!(std::panic::catch_unwind(|| decode_raw(&encoded, &mut vec![0; 300], 10)).is_err());
+        //16 words of 32-bit integers with no payload before them
+        assert!(std::panic::catch_unwind(|| decode_raw(&[0xE0], &mut vec![0; 1256], 0)).is_err());
+        assert!(decode_raw(&encoded, &mut vec![0; 1256], 1000) >= 1000);
+    }
+
+    #[test]
+    fn fast_decoders_reject_patches_before_the_output() {
+        //no integers, then a patch of the integer 201 back from the start
+        let patch = [200, 0xEF, 0xBE, 0xAD, 0xDE, 0xFF];
+        let mut column = vec![0u32; 2000];
+        assert!(std::panic::catch_unwind(std::panic::AssertUnwindSafe(|| decode_raw(&patch, &mut column[500..], 0))).is_err());
+        assert!(std::panic::catch_unwind(std::panic::AssertUnwindSafe(|| decode(&patch, &mut column[600..], 0))).is_err());
+        let (docids, tfs) = column.split_at_mut(1300);
+        assert!(std::panic::catch_unwind(std::panic::AssertUnwindSafe(|| decode_pairs(&[6, 0, 0, 0, 200, 0xEF, 0xBE, 0xAD, 0xDE, 0xFF], &mut docids[700..], tfs, 0))).is_err());
+        assert!(column.iter().all(|&value| value == 0));
+        assert_eq!(decode_checked(&patch, &mut column), 0);
+        verify_decoders(&patch).unwrap();
+    }
+
+    #[test]
+    fn blocked_list_rejects_a_footer_claiming_huge_blocks() {
+        //one 4-byte block of u32::MAX docids, in blocks of u32::MAX
+        let mut data = vec![0u8; 4];
+        for word in [0, 0, 3, u32::MAX, u32::MAX, 1] {
+            data.extend_from_slice(&u32::to_le_bytes(word));
+        }
+        assert_eq!(BlockedList::new(&data).err(), Some(QmxError::Corrupt));
+    }
+
+    #[test]
+    fn blocked_list_checks_the_skip_table_against_the_block() {
+        let docids: Vec<u32> = (1..=1000).map(|docid| docid * 3).collect();
+        let mut encoded = encode_blocked(&docids, 128);
+        //block 0 really ends at 384, claim it ends at 700 (still before block 1's end)
+        let table = encoded.len() - FOOTER_LEN - 8 * SKIP_ENTRY_LEN;
+        encoded[table..table + 4].copy_from_slice(&700u32.to_le_bytes());
+        let mut list = BlockedList::new(&encoded).unwrap();
+        assert_eq!(list.next_geq(600), None);
+        assert!(list.decode_block(0).is_err());
+
+        //an entry whose offset doesn't follow on from the block before is found when its block is decoded
+        let mut encoded = encode_blocked(&docids, 128);
+        let entry = encoded.len() - FOOTER_LEN - 3 * SKIP_ENTRY_LEN;
+        encoded[entry + 4..entry + 8].copy_from_slice(&1u32.to_le_bytes());
+        let mut list = BlockedList::new(&encoded).unwrap();
+        assert!(list.decode_block(4).is_ok());
+        assert_eq!(list.decode_block(5).err(), Some(QmxError::Corrupt));
+    }
+
+    #[test]
+    fn encode_batch_matches_encoding_each_list() {
+        let mut random = Random(10);
+        let lists: Vec<Vec<u32>> = (0..300).map(|at| docids(&mut random, [0, 1, 5, 130, 3000][at % 5], 1 + at as u32 % 20)).collect();
+        let slices: Vec<&[u32]> = lists.iter().map(|list| &list[..]).collect();
+
+        let (arena, offsets) = encode_batch(&slices);
+        assert_eq!(offsets.len(), lists.len() + 1);
+        assert_eq!(*offsets.last().unwrap(), arena.len());
+        for (at, list) in lists.iter().enumerate() {
+            assert_eq!(arena[offsets[at]..offsets[at + 1]], encode(list)[..]);
+        }
+    }
+
+    #[test]
+    fn encode_batch_parallel_matches_encode_batch() {
+        let mut random = Random(11);
+        let lists: Vec<Vec<u32>> = (0..300).map(|at| docids(&mut random, [0, 1, 5, 130, 3000][at % 5], 1 + at as u32 % 20)).collect();
+        let slices: Vec<&[u32]> = lists.iter().map(|list| &list[..]).collect();
+
+        let batch = encode_batch(&slices);
+        for threads in [0, 1, 2, 3, 7, 1000] {
+            assert_eq!(encode_batch_parallel(&slices, threads), batch);
+        }
+        assert_eq!(encode_batch_parallel(&[], 4), encode_batch(&[]));
+    }
+
+    #[test]
+    fn segment_round_trips_through_a_mapped_file() {
+        let mut random = Random(50);
+        let terms: Vec<(u32, Vec<u32>)> = (0..50).map(|at| (at * 3 + 1, docids(&mut random, [0, 1, 300, 5000][at as usize % 4], 1 + at % 16))).collect();
+        let mut writer = SegmentWriter::new();
+        writer.encoder().set_optimal(true);
+        for (term, list) in &terms {
+            writer.add(*term, list);
+        }
+        let path = std::env::temp_dir().join(format!("qmx_segment_test_{}.qmx", std::process::id()));
+        writer.write_to_file(&path).unwrap();
+
+        let file = MappedFile::open(&path).unwrap();
+        std::fs::remove_file(&path).unwrap();
+        let segment = Segment::new(file.as_bytes()).unwrap();
+        assert_eq!(segment.len(), terms.len());
+        let mut output = vec![];
+        for ((term, list), (found, postings)) in terms.iter().zip(segment.iter()) {
+            assert_eq!(found, *term);
+            assert_eq!(postings.count, list.len());
+            assert_eq!(postings.max_docid, list.last().copied().unwrap_or(0));
+            assert_eq!(postings.data.as_ptr() as usize % SEGMENT_ALIGNMENT, file.as_bytes().as_ptr() as usize % SEGMENT_ALIGNMENT);
+            assert_eq!(segment.postings(*term).unwrap().decode_into(&mut output), Ok(list.len()));
+            assert_eq!(output, *list);
+        }
+        assert!(segment.postings(0).is_none());
+        assert!(segment.postings(2).is_none());
+        assert!(segment.postings(u32::MAX).is_none());
+
+        //an empty file maps to nothing, which isn't a segment
+        let empty = std::env::temp_dir().join(format!("qmx_segment_test_empty_{}.qmx", std::process::id()));
+        std::fs::write(&empty, []).unwrap();
+        let file = MappedFile::open(&empty).unwrap();
+        std::fs::remove_file(&empty).unwrap();
+        assert!(file.as_bytes().is_empty());
+        assert!(Segment::new(file.as_bytes()).is_err());
+    }
+
+    #[test]
+    fn segment_rejects_a_count_its_postings_cant_hold() {
+        let mut writer = SegmentWriter::new();
+        writer.add(3, &[1, 5, 9]);
+        let mut data = writer.finish();
+        data[SEGMENT_HEADER_LEN + 4..SEGMENT_HEADER_LEN + 8].copy_from_slice(&0xFFFF_FFF0u32.to_le_bytes());
+        assert!(Segment::new(&data).is_err());
+
+        //a count that's wrong but possible is an error from decode_into()
+        data[SEGMENT_HEADER_LEN + 4..SEGMENT_HEADER_LEN + 8].copy_from_slice(&40u32.to_le_bytes());
+        let segment = Segment::new(&data).unwrap();
+        assert_eq!(segment.postings(3).unwrap().decode_into(&mut vec![]), Err(QmxError::Corrupt));
+    }
+
+    #[test]
+    fn blocked_writer_writes_what_encode_blocked_does() {
+        let mut random = Random(40);
+        for length in [0, 1, 127, 128, 129, 1000] {
+            let list = docids(&mut random, length, 12);
+            for block_size in [1, 7, 128] {
+                let mut writer = BlockedWriter::new(vec![], block_size);
+                writer.push_all(&list[..length / 2]).unwrap();
+                for &docid in &list[length / 2..] {
+                    writer.push(docid).unwrap();
+                }
+                assert_eq!(writer.len(), length);
+                assert_eq!(writer.finish().unwrap(), encode_blocked(&list, block_size));
+            }
+        }
+    }
+
+    #[test]
+    fn encode_statistics_add_up() {
+        let mut random = Random(20);
+        let mut encoder = QmxEncoder::new();
+        encoder.encode(&docids(&mut random, 100, 8));
+        assert_eq!(encoder.statistics(), EncodeStatistics::default());
+
+        encoder.set_statistics(true);
+        let (mut integers, mut bytes) = (0, 0);
+        for (at, length) in [0, 1, 7, 256, 4000].into_iter().enumerate() {
+            let list = docids(&mut random, length, 4 * at as u32);
+            integers += list.len() as u64;
+            bytes += encoder.encode(&list).len() as u64;
+        }
+        let statistics = encoder.statistics();
+        assert_eq!(statistics.sequences, 5);
+        assert_eq!(statistics.integers, integers);
+        assert_eq!(statistics.bytes(), bytes);
+        assert!(statistics.words.iter().sum::<u64>() > 0);
+
+        encoder.reset_statistics();
+        assert_eq!(encoder.statistics(), EncodeStatistics::default());
+    }
+
+    #[test]
+    fn union_blocked_is_the_sorted_union() {
+        let mut random = Random(11);
+        for round in 0..50 {
+            let lists: Vec<Vec<u32>> = (0..random.below(6)).map(|_| {
+                let (start, step) = (random.below(100_000) as u32, 1 + random.below(50) as u32);
+                return (0..random.below(3000) as u32).map(|at| start + at * step).collect();
+            }).collect();
+            let encoded: Vec<Vec<u8>> = lists.iter().map(|list| encode_blocked(list, [1, 7, 128][round % 3])).collect();
+            let mut expected = lists.concat();
+            expected.sort_unstable();
+            expected.dedup();
+            assert_eq!(union_blocked(&encoded.iter().map(|list| &list[..]).collect::<Vec<&[u8]>>()).unwrap(), expected);
+        }
+    }
+
+    #[test]
+    fn small_block_cache_still_caches() {
+        let cache = BlockCache::new(10_000, 64);
+        let encoded = encode_blocked(&(1..20_000).collect::<Vec<u32>>(), 256);
+        let list = BlockedList::new(&encoded).unwrap();
+        for _ in 0..2 {
+            for block in 0..10 {
+                cache.block(1, &list, block).unwrap();
+            }
+        }
+        assert_eq!(cache.statistics().hits, 10);
+    }
+
+    #[test]
+    fn decode_arena_decodes_into_aligned_slabs_and_stops_growing() {
+        let mut random = Random(30);
+        let lists: Vec<Vec<u32>> = (0..20).map(|at| docids(&mut random, at * 97, 10)).collect();
+        let encoded: Vec<Vec<u8>> = lists.iter().map(|list| encode(list)).collect();
+
+        let mut arena = DecodeArena::new();
+        let mut capacity = 0;
+        for round in 0..3 {
+            {
+                let decoded: Vec<&mut [u32]> = encoded.iter().zip(&lists).map(|(data, list)| arena.decode(data, list.len())).collect();
+                for (docids, list) in decoded.iter().zip(&lists) {
+                    assert_eq!(docids.as_ptr() as usize % 64, 0);
+                    assert_eq!(docids[..], list[..]);
+                }
+            }
+            arena.reset();
+            //the first query grows the arena, after that it hands out the same chunks again
+            if round > 0 {
+                assert_eq!(arena.capacity(), capacity);
+            }
+            capacity = arena.capacity();
+        }
+
+        let sum = with_decode_arena(|arena| encoded.iter().zip(&lists).map(|(data, list)| arena.decode_with_base(data, list.len(), 5).iter().map(|&docid| docid as u64).sum::<u64>()).sum::<u64>());
+        assert_eq!(sum, lists.iter().flatten().map(|&docid| docid as u64 + 5).sum::<u64>());
+    }
+
+    #[cfg(feature = "trace")]
+    #[test]
+    fn trace_counts_what_sum_added_and_survives_a_reset() {
+        let encoded = encode_raw(&[3; 20]);
+        let before = trace_counters();
+        assert_eq!(sum_raw(&encoded, 1000), 60);
+        //asked for 1000, but there are only the 20 and the padding of their word
+        let sum = trace_counters().since(&before).sum;
+        assert_eq!((sum.calls, sum.integers), (1, encoded_integers(&encoded) as u64));
+
+        //a reset between the readings wraps rather than panicking
+        let before = trace_counters();
+        reset_trace_counters();
+        let _ = trace_counters().since(&before);
+    }
+}